@@ -11,9 +11,13 @@ uint64_t get_num_hashmaps_b() {
   hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::NO, true>,              \
       hashmaps::UnalignedQuadraticProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::NO, true>,       \
       hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::NO, true>, \
-      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::NO, true>
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::NO, true>,                \
+      hashmaps::BloomFilteredHashTable<KeyT, ValueT,                                                                                   \
+                                       hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                \
+                                                                                    utils::PrefetchingLocality::NO, true>,             \
+                                       DefaultHasher, 8, 25, true>
 
-  uint64_t num_hashmaps = 4;
+  uint64_t num_hashmaps = 5;
 
 #define EXTERNAL_READ_BENCHMARK_HASHMAPS BASIC_READ_BENCHMARK_HASHMAPS
 
@@ -33,13 +33,22 @@ uint64_t get_num_hashmaps_c() {
       hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, DefaultHasher, false>,                                                      \
       hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::NO, true>,                \
       hashmaps::LinearProbingSoAHashTable<KeyT, ValueT, DefaultHasher, true>,                                                          \
+      hashmaps::LinearProbingSoAHashSet<KeyT, DefaultHasher, true>,                                                                    \
       hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, DefaultHasher, true>,                                                    \
       hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, false, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,             \
       hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,              \
       hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,             \
-      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,            \
+      hashmaps::BloomFilteredHashTable<KeyT, ValueT,                                                                                   \
+                                       hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                \
+                                                                                    utils::PrefetchingLocality::NO, true>,             \
+                                       DefaultHasher, 8, 25, true>,                                                                    \
+      hashmaps::BloomFilteredHashTable<KeyT, ValueT,                                                                                   \
+                                       hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true,                                   \
+                                                                  hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                \
+                                       DefaultHasher, 8, 25, true>
 
-  uint64_t num_hashmaps = 30;
+  uint64_t num_hashmaps = 33;
 
 #ifdef HASHMAP_BUILD_EXTERNAL
 
@@ -112,9 +121,15 @@ uint64_t get_num_hashmaps_c() {
                                        false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true>,              \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,      \
                                        false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,               \
-                                       hashing::FingerprintBucketBits::LSBMSB>
+                                       hashing::FingerprintBucketBits::LSBMSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashSet<KeyT, DefaultHasher, uint16_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,      \
+                                             false, utils::PrefetchingLocality::NO, true, true>,                                                     \
+      hashmaps::BucketingSIMDHashSet<KeyT, DefaultHasher, uint16_t, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,    \
+                                     utils::PrefetchingLocality::MEDIUM, true, true>,                                                                \
+      hashmaps::QuotientBucketingSIMDHashTable<KeyT, ValueT, uint16_t, 6, 8, 128, SIMDAlgorithm::TESTZ, true>,                                       \
+      hashmaps::QuotientBucketingSIMDHashTable<KeyT, ValueT, uint16_t, 7, 8, 128, SIMDAlgorithm::TESTZ, true>
 
-  num_hashmaps += 12;
+  num_hashmaps += 16;
 
 #ifdef __AVX2__
 #define INTERM_SIMD_READ_BENCHMARK_HASHMAPS                                                                                                        \
@@ -9,17 +9,60 @@ namespace benchmark {
 /* Hash functions we consider :
     MultShift (64B) - in other benchmarks
     MultShift (64B) - mit Modulo statt Bitmask
+    MultShift (64B) - mit Fastrange statt Bitmask
     MultShift (128B)
     MultAddShift (64B)
     MultAddShift (128B)
     MurmurHash3
     xxHash
     xxHash - mit Modulo statt Bitmask
+    MurmurHash3 - Bitmask vs. Modulo vs. Fastrange finalization
+    Simple and twisted tabulation
+    CRC32C (SSE4.2/ARMv8 CRC instruction)
+    AES rounds (AES-NI/ARMv8 AES)
 */
 
 uint64_t get_num_hashmaps_d() {
+#if defined(HASHMAP_STRINGKEYS) || defined(HASHMAP_COMPOSITEKEYS)
+// The multiply-shift and Murmur hashers only take integer keys, hence we compare the hash functions that hash arbitrary bytes
+#define STRING_HASHFUNCTION_READ_BENCHMARK_HASHMAPS(HasherT)                                                                                \
+  hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, HasherT, false, utils::PrefetchingLocality::NO, true>,                         \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, HasherT, false, utils::PrefetchingLocality::NO, true>,                           \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, HasherT, false, utils::PrefetchingLocality::NO, true>,            \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, HasherT, true>,                                                               \
+      hashmaps::ChainedHashTable<KeyT, ValueT, HasherT, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, HasherT, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                        \
+      hashmaps::ChainedHashTable<KeyT, ValueT, HasherT, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                       \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, HasherT, uint8_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, \
+                                               false, false, utils::PrefetchingLocality::NO, true, true,                                    \
+                                               hashing::FingerprintBucketBits::MSBLSB>,                                                     \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, HasherT, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,   \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                             \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, HasherT, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,   \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,      \
+                                       hashing::FingerprintBucketBits::MSBLSB>
+
+#define BENCHMARK_HASHMAPS_D                                                                                     \
+  STRING_HASHFUNCTION_READ_BENCHMARK_HASHMAPS(xxHasher), STRING_HASHFUNCTION_READ_BENCHMARK_HASHMAPS(crcHasher), \
+      STRING_HASHFUNCTION_READ_BENCHMARK_HASHMAPS(aesHasher)
+
+  return 3 * 10;
+#else
+// The cost of the finalizer for the same (well-mixing) hash function. Fastrange maps the MSBs of the hash into the range, hence we take LSB
+// fingerprints for it, while masking and modulo take MSB fingerprints.
+#define FINALIZER_READ_BENCHMARK_HASHMAPS(HasherT, fbb)                                                                                 \
+  hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, HasherT, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::ChainedHashTable<KeyT, ValueT, HasherT, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, HasherT, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true, fbb>
+
 #define BASIC_READ_BENCHMARK_HASHMAPS                                                                                                          \
-  hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, MultShift64ModuloHasher, false, utils::PrefetchingLocality::NO, true>,            \
+  FINALIZER_READ_BENCHMARK_HASHMAPS(MurmurHasher, hashing::FingerprintBucketBits::MSBLSB),                                                     \
+      FINALIZER_READ_BENCHMARK_HASHMAPS(MurmurModuloHasher, hashing::FingerprintBucketBits::MSBLSB),                                           \
+      FINALIZER_READ_BENCHMARK_HASHMAPS(MurmurFastRangeHasher, hashing::FingerprintBucketBits::LSBLSB),                                        \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, MultShift64ModuloHasher, false, utils::PrefetchingLocality::NO, true>,        \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, MultShift64FastRangeHasher, false, utils::PrefetchingLocality::NO, true>,     \
       hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, MultShift128Hasher, false, utils::PrefetchingLocality::NO, true>,             \
       hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, MultShift128Hasher, false, utils::PrefetchingLocality::NO, true>,                   \
       hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, MultShift128Hasher, false, utils::PrefetchingLocality::NO, true>,    \
@@ -41,6 +84,22 @@ uint64_t get_num_hashmaps_d() {
       hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, xxHasher, false, utils::PrefetchingLocality::NO, true>,                             \
       hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, xxHasher, false, utils::PrefetchingLocality::NO, true>,              \
       hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, xxHasher, true>,                                                                 \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, tabHasher, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, tabHasher, false, utils::PrefetchingLocality::NO, true>,                            \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, tabHasher, false, utils::PrefetchingLocality::NO, true>,             \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, tabHasher, true>,                                                                \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, twistedTabHasher, false, utils::PrefetchingLocality::NO, true>,               \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, twistedTabHasher, false, utils::PrefetchingLocality::NO, true>,                     \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, twistedTabHasher, false, utils::PrefetchingLocality::NO, true>,      \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, twistedTabHasher, true>,                                                         \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, crcHasher, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, crcHasher, false, utils::PrefetchingLocality::NO, true>,                            \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, crcHasher, false, utils::PrefetchingLocality::NO, true>,             \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, crcHasher, true>,                                                                \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, aesHasher, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, aesHasher, false, utils::PrefetchingLocality::NO, true>,                            \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, aesHasher, false, utils::PrefetchingLocality::NO, true>,             \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, aesHasher, true>,                                                                \
       hashmaps::ChainedHashTable<KeyT, ValueT, MultShift128Hasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                 \
       hashmaps::ChainedHashTable<KeyT, ValueT, MultShift128Hasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                \
       hashmaps::ChainedHashTable<KeyT, ValueT, MultShift128Hasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,               \
@@ -55,9 +114,21 @@ uint64_t get_num_hashmaps_d() {
       hashmaps::ChainedHashTable<KeyT, ValueT, MurmurHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                     \
       hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                           \
       hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                          \
-      hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>
+      hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, tabHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                          \
+      hashmaps::ChainedHashTable<KeyT, ValueT, tabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, tabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                        \
+      hashmaps::ChainedHashTable<KeyT, ValueT, twistedTabHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                   \
+      hashmaps::ChainedHashTable<KeyT, ValueT, twistedTabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                  \
+      hashmaps::ChainedHashTable<KeyT, ValueT, twistedTabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                 \
+      hashmaps::ChainedHashTable<KeyT, ValueT, crcHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                          \
+      hashmaps::ChainedHashTable<KeyT, ValueT, crcHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, crcHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                        \
+      hashmaps::ChainedHashTable<KeyT, ValueT, aesHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                          \
+      hashmaps::ChainedHashTable<KeyT, ValueT, aesHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, aesHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>
 
-  uint64_t num_hashmaps = 16 + 15;
+  uint64_t num_hashmaps = 16 + 15 + 4 * 7 + 3 * 3 + 1;
 
 #ifdef HASHMAP_BUILD_EXTERNAL
 
@@ -157,10 +228,26 @@ uint64_t get_num_hashmaps_d() {
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ, false,    \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ, false,   \
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>
 
-  num_hashmaps += 3 * 7;
+  num_hashmaps += 3 * 9;
 
 #ifdef __AVX2__
 #define INTERM_SIMD_READ_BENCHMARK_HASHMAPS                                                                                                          \
@@ -231,6 +318,22 @@ uint64_t get_num_hashmaps_d() {
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 32, 256, SIMDAlgorithm::TESTZ, false,    \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, 256, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 16, 256, SIMDAlgorithm::TESTZ, false,  \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 32, 256, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, 256, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 16, 256, SIMDAlgorithm::TESTZ, false,  \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 32, 256, SIMDAlgorithm::TESTZ, false,   \
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>
 
@@ -307,6 +410,22 @@ uint64_t get_num_hashmaps_d() {
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, 512, SIMDAlgorithm::TESTZ, true,     \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, 512, SIMDAlgorithm::TESTZ, true, false, NEONAlgo::SSE2NEON, false,  \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, 512, SIMDAlgorithm::TESTZ, true,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, 512, SIMDAlgorithm::TESTZ, true,    \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, 512, SIMDAlgorithm::TESTZ, true, false, NEONAlgo::SSE2NEON, false,  \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, 512, SIMDAlgorithm::TESTZ, true,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, 512, SIMDAlgorithm::TESTZ, true,    \
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>
 
@@ -386,9 +505,27 @@ uint64_t get_num_hashmaps_d() {
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, utils::sve_register_size,            \
                                        SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
                                        true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, utils::sve_register_size, SIMDAlgorithm::TESTZ, false, true,        \
+                                               NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, true, true,                         \
+                                               hashing::FingerprintBucketBits::MSBLSB>,                                                              \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, utils::sve_register_size,          \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, utils::sve_register_size,           \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, utils::sve_register_size, SIMDAlgorithm::TESTZ, false, true,        \
+                                               NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, true, true,                         \
+                                               hashing::FingerprintBucketBits::MSBLSB>,                                                              \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, utils::sve_register_size,          \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, utils::sve_register_size,           \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
       INTERM_SIMD_READ_BENCHMARK_HASHMAPS
 
-  num_hashmaps += 3 * 7;
+  num_hashmaps += 3 * 9;
 
 #else
 #define FULL_SIMD_READ_BENCHMARK_HASHMAPS INTERM_SIMD_READ_BENCHMARK_HASHMAPS
@@ -398,6 +535,7 @@ uint64_t get_num_hashmaps_d() {
 #define BENCHMARK_HASHMAPS_D FULL_SIMD_READ_BENCHMARK_HASHMAPS, EXTERNAL_READ_BENCHMARK_HASHMAPS
 
   return num_hashmaps;
+#endif
 }
 
 }  // namespace benchmark
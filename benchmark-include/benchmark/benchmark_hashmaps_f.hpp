@@ -1,7 +1,7 @@
 #pragma once
 #include <cstdint>
 
-// Hashmaps for stringkeys
+// Hashmaps for stringkeys and composite keys
 
 namespace benchmark {
 
@@ -13,6 +13,9 @@ namespace benchmark {
     MultAddShift (128B)
     MurmurHash3
     xxHash
+    Simple and twisted tabulation
+    CRC32C (SSE4.2/ARMv8 CRC instruction)
+    AES rounds (AES-NI/ARMv8 AES)
 */
 
 uint64_t get_num_hashmaps_g() {
@@ -41,6 +44,22 @@ uint64_t get_num_hashmaps_g() {
       hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, xxHasher, false, utils::PrefetchingLocality::NO, true>,                             \
       hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, xxHasher, false, utils::PrefetchingLocality::NO, true>,              \
       hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, xxHasher, true>,                                                                 \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, tabHasher, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, tabHasher, false, utils::PrefetchingLocality::NO, true>,                            \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, tabHasher, false, utils::PrefetchingLocality::NO, true>,             \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, tabHasher, true>,                                                                \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, twistedTabHasher, false, utils::PrefetchingLocality::NO, true>,               \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, twistedTabHasher, false, utils::PrefetchingLocality::NO, true>,                     \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, twistedTabHasher, false, utils::PrefetchingLocality::NO, true>,      \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, twistedTabHasher, true>,                                                         \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, crcHasher, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, crcHasher, false, utils::PrefetchingLocality::NO, true>,                            \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, crcHasher, false, utils::PrefetchingLocality::NO, true>,             \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, crcHasher, true>,                                                                \
+      hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, aesHasher, false, utils::PrefetchingLocality::NO, true>,                      \
+      hashmaps::StoringRobinHoodAoSHashTable<KeyT, ValueT, aesHasher, false, utils::PrefetchingLocality::NO, true>,                            \
+      hashmaps::UnalignedRecalculatingRobinHoodAoSHashTable<KeyT, ValueT, aesHasher, false, utils::PrefetchingLocality::NO, true>,             \
+      hashmaps::LinearProbingPackedSoAHashTable<KeyT, ValueT, aesHasher, true>,                                                                \
       hashmaps::ChainedHashTable<KeyT, ValueT, MultShift64Hasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                  \
       hashmaps::ChainedHashTable<KeyT, ValueT, MultShift64Hasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                 \
       hashmaps::ChainedHashTable<KeyT, ValueT, MultShift64Hasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                \
@@ -58,9 +77,27 @@ uint64_t get_num_hashmaps_g() {
       hashmaps::ChainedHashTable<KeyT, ValueT, MurmurHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                     \
       hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                           \
       hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                          \
-      hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>
+      hashmaps::ChainedHashTable<KeyT, ValueT, xxHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, tabHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                          \
+      hashmaps::ChainedHashTable<KeyT, ValueT, tabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, tabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                        \
+      hashmaps::ChainedHashTable<KeyT, ValueT, twistedTabHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                   \
+      hashmaps::ChainedHashTable<KeyT, ValueT, twistedTabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                  \
+      hashmaps::ChainedHashTable<KeyT, ValueT, twistedTabHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                 \
+      hashmaps::ChainedHashTable<KeyT, ValueT, crcHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                          \
+      hashmaps::ChainedHashTable<KeyT, ValueT, crcHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, crcHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                        \
+      hashmaps::ChainedHashTable<KeyT, ValueT, aesHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                          \
+      hashmaps::ChainedHashTable<KeyT, ValueT, aesHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, aesHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                        \
+      hashmaps::PerfectHashTable<KeyT, ValueT, MultShift64Hasher, uint16_t, true>,                                                             \
+      hashmaps::PerfectHashTable<KeyT, ValueT, xxHasher, uint16_t, true>,                                                                      \
+      hashmaps::PerfectHashTable<KeyT, ValueT, tabHasher, uint16_t, true>,                                                                     \
+      hashmaps::PerfectHashTable<KeyT, ValueT, twistedTabHasher, uint16_t, true>,                                                              \
+      hashmaps::PerfectHashTable<KeyT, ValueT, crcHasher, uint16_t, true>,                                                                     \
+      hashmaps::PerfectHashTable<KeyT, ValueT, aesHasher, uint16_t, true>
 
-  uint64_t num_hashmaps = 16;
+  uint64_t num_hashmaps = 18 + 4 * 8;
 
 #ifdef HASHMAP_BUILD_EXTERNAL
 
@@ -178,10 +215,26 @@ uint64_t get_num_hashmaps_g() {
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ, false,    \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ, false,   \
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>
 
-  num_hashmaps += 3 * 7;
+  num_hashmaps += 3 * 9;
 
 #ifdef __AVX2__
 #define INTERM_SIMD_READ_BENCHMARK_HASHMAPS                                                                                                          \
@@ -270,6 +323,22 @@ uint64_t get_num_hashmaps_g() {
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 32, 256, SIMDAlgorithm::TESTZ, false,    \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, 256, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 16, 256, SIMDAlgorithm::TESTZ, false,  \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 32, 256, SIMDAlgorithm::TESTZ, false,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, 256, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 16, 256, SIMDAlgorithm::TESTZ, false,  \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 32, 256, SIMDAlgorithm::TESTZ, false,   \
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>
 
@@ -363,6 +432,22 @@ uint64_t get_num_hashmaps_g() {
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, 512, SIMDAlgorithm::TESTZ, true,     \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, 512, SIMDAlgorithm::TESTZ, true, false, NEONAlgo::SSE2NEON, false,  \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, 512, SIMDAlgorithm::TESTZ, true,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, 512, SIMDAlgorithm::TESTZ, true,    \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, 512, SIMDAlgorithm::TESTZ, true, false, NEONAlgo::SSE2NEON, false,  \
+                                               false, utils::PrefetchingLocality::NO, true, true, hashing::FingerprintBucketBits::MSBLSB>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, 512, SIMDAlgorithm::TESTZ, true,   \
+                                       false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                       hashing::FingerprintBucketBits::MSBLSB>,                                                                      \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, 512, SIMDAlgorithm::TESTZ, true,    \
                                        false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
                                        hashing::FingerprintBucketBits::MSBLSB>
 
@@ -460,9 +545,27 @@ uint64_t get_num_hashmaps_g() {
       hashmaps::BucketingSIMDHashTable<KeyT, ValueT, xxHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, utils::sve_register_size,            \
                                        SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
                                        true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, crcHasher, uint8_t, utils::sve_register_size, SIMDAlgorithm::TESTZ, false, true,        \
+                                               NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, true, true,                         \
+                                               hashing::FingerprintBucketBits::MSBLSB>,                                                              \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, utils::sve_register_size,          \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, crcHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, utils::sve_register_size,           \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::FingerprintingSIMDSoAHashTable<KeyT, ValueT, aesHasher, uint8_t, utils::sve_register_size, SIMDAlgorithm::TESTZ, false, true,        \
+                                               NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, true, true,                         \
+                                               hashing::FingerprintBucketBits::MSBLSB>,                                                              \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 32, utils::sve_register_size,          \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, aesHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 64, utils::sve_register_size,           \
+                                       SIMDAlgorithm::TESTZ, false, true, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM,      \
+                                       true, true, hashing::FingerprintBucketBits::MSBLSB>,                                                          \
       INTERM_SIMD_READ_BENCHMARK_HASHMAPS
 
-  num_hashmaps += 3 * 7;
+  num_hashmaps += 3 * 9;
 
 #else
 #define FULL_SIMD_READ_BENCHMARK_HASHMAPS INTERM_SIMD_READ_BENCHMARK_HASHMAPS
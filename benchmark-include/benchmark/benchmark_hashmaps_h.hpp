@@ -110,7 +110,135 @@ uint64_t get_num_hashmaps_h() {
 #endif
 #endif
 
-#define BENCHMARK_HASHMAPS_H FULL_SIMD_READ_BENCHMARK_HASHMAPS, EXTERNAL_READ_BENCHMARK_HASHMAPS
+// Large values stored inline vs. 32-bit slot ids pointing into a value arena
+#if defined(HASHMAP_LARGEVALUES) && !defined(HASHMAP_POINTERVALUES)
+#define ARENA_VALUE_READ_BENCHMARK_HASHMAPS                                                                                                       \
+  hashmaps::ArenaValueHashTable<KeyT, ValueT,                                                                                                     \
+                                hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, uint32_t, DefaultHasher, false,                                \
+                                                                             utils::PrefetchingLocality::NO, true>,                               \
+                                true>,                                                                                                            \
+      hashmaps::ArenaValueHashTable<KeyT, ValueT,                                                                                                 \
+                                    hashmaps::BucketingSIMDHashTable<KeyT, uint32_t, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, \
+                                                                     8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,       \
+                                                                     false, utils::PrefetchingLocality::MEDIUM, true, true,                       \
+                                                                     hashing::FingerprintBucketBits::LSBMSB>,                                     \
+                                    true>,
+
+  num_hashmaps += 2;
+#else
+#define ARENA_VALUE_READ_BENCHMARK_HASHMAPS
+#endif
+
+// Hot-key caches in front of the tables above, compare with the uncached runs via the CacheSpeedup column
+#ifdef HASHMAP_ZIPF
+#define HOT_KEY_CACHE_READ_BENCHMARK_HASHMAPS                                                                                                     \
+  hashmaps::HotKeyCachedHashTable<KeyT, ValueT,                                                                                                   \
+                                  hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                                \
+                                                                               utils::PrefetchingLocality::NO, true>,                             \
+                                  DefaultHasher>,                                                                                                 \
+      hashmaps::HotKeyCachedHashTable<KeyT, ValueT,                                                                                               \
+                                      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true,                                               \
+                                                                 hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                            \
+                                      DefaultHasher>,                                                                                             \
+      hashmaps::HotKeyCachedHashTable<KeyT, ValueT,                                                                                               \
+                                      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, \
+                                                                       8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,     \
+                                                                       false, utils::PrefetchingLocality::MEDIUM, true, true,                     \
+                                                                       hashing::FingerprintBucketBits::LSBMSB>,                                   \
+                                      DefaultHasher>,
+
+  num_hashmaps += 3;
+#else
+#define HOT_KEY_CACHE_READ_BENCHMARK_HASHMAPS
+#endif
+
+// Self-organizing buckets that move frequently hit entries towards the first slots of their home bucket. With NEXT_BUCKET, hits in overflow
+// buckets also move back into the home bucket, the stash policy only reorders within buckets and is compared against the plain stash table.
+// Reorganizing lookups write to the table, hence these are not part of the multi-threaded benchmarks.
+#if defined(HASHMAP_ZIPF) && !defined(HASHMAP_MT)
+#define SELF_ORGANIZING_READ_BENCHMARK_HASHMAPS                                                                                                   \
+  hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,       \
+                                   false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,                \
+                                   hashing::FingerprintBucketBits::LSBMSB, 0, hashmaps::BucketOverflowPolicy::NEXT_BUCKET, uint32_t, 16>,         \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,   \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,            \
+                                       hashing::FingerprintBucketBits::LSBMSB, 0, hashmaps::BucketOverflowPolicy::STASH, uint32_t, 16>,           \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,   \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, true,            \
+                                       hashing::FingerprintBucketBits::LSBMSB, 0, hashmaps::BucketOverflowPolicy::STASH>,
+
+  num_hashmaps += 3;
+#else
+#define SELF_ORGANIZING_READ_BENCHMARK_HASHMAPS
+#endif
+
+// Probe keys partitioned into cache-sized groups of the table before probing, the batch sizes bracket the break-even point against the
+// plain tables above. The partitioning is part of the measured runtime.
+#ifdef HASHMAP_SORTED_BATCH
+#define SORTED_BATCH_READ_BENCHMARK_HASHMAPS                                                                                                      \
+  hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                    \
+                                 hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                                 \
+                                                                              utils::PrefetchingLocality::NO, true>,                              \
+                                 DefaultHasher, 1024>,                                                                                            \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                             \
+                                                                                  utils::PrefetchingLocality::NO, true>,                          \
+                                     DefaultHasher, 16384>,                                                                                       \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                             \
+                                                                                  utils::PrefetchingLocality::NO, true>,                          \
+                                     DefaultHasher, 262144>,                                                                                      \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::UnalignedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false,                             \
+                                                                                  utils::PrefetchingLocality::NO, true>,                          \
+                                     DefaultHasher, 4194304>,                                                                                     \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket,  \
+                                                                      8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,      \
+                                                                      false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                                                      hashing::FingerprintBucketBits::LSBMSB>,                                    \
+                                     DefaultHasher, 1024>,                                                                                        \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket,  \
+                                                                      8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,      \
+                                                                      false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                                                      hashing::FingerprintBucketBits::LSBMSB>,                                    \
+                                     DefaultHasher, 16384>,                                                                                       \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket,  \
+                                                                      8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,      \
+                                                                      false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                                                      hashing::FingerprintBucketBits::LSBMSB>,                                    \
+                                     DefaultHasher, 262144>,                                                                                      \
+      hashmaps::SortedBatchHashTable<KeyT, ValueT,                                                                                                \
+                                     hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket,  \
+                                                                      8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false,      \
+                                                                      false, utils::PrefetchingLocality::MEDIUM, true, true,                      \
+                                                                      hashing::FingerprintBucketBits::LSBMSB>,                                    \
+                                     DefaultHasher, 4194304>,
+
+  num_hashmaps += 8;
+#else
+#define SORTED_BATCH_READ_BENCHMARK_HASHMAPS
+#endif
+
+// Vertically vectorized batch lookups, where every SIMD lane probes for a different key, next to the scalar lookups on the same table layout.
+// Values need to fit into 64-bit lanes.
+#if defined(HASHMAP_VERTICAL_PROBING) && !defined(HASHMAP_LARGEVALUES)
+#define VERTICAL_PROBING_READ_BENCHMARK_HASHMAPS                                                                                                  \
+  hashmaps::LinearProbingSoAHashTable<KeyT, ValueT, DefaultHasher>,                                                                               \
+      hashmaps::VerticalLinearProbingSoAHashTable<KeyT, ValueT, DefaultHasher, false, 1024>,                                                      \
+      hashmaps::VerticalLinearProbingSoAHashTable<KeyT, ValueT, DefaultHasher>,
+
+  num_hashmaps += 3;
+#else
+#define VERTICAL_PROBING_READ_BENCHMARK_HASHMAPS
+#endif
+
+#define BENCHMARK_HASHMAPS_H                                                                                                          \
+  FULL_SIMD_READ_BENCHMARK_HASHMAPS, ARENA_VALUE_READ_BENCHMARK_HASHMAPS HOT_KEY_CACHE_READ_BENCHMARK_HASHMAPS                        \
+      SELF_ORGANIZING_READ_BENCHMARK_HASHMAPS SORTED_BATCH_READ_BENCHMARK_HASHMAPS VERTICAL_PROBING_READ_BENCHMARK_HASHMAPS           \
+      EXTERNAL_READ_BENCHMARK_HASHMAPS
 
   return num_hashmaps;
 }
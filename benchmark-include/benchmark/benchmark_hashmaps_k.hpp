@@ -2,18 +2,34 @@
 #include <cstdint>
 
 /* READ BENCHMARK HASHMAPS K */
-/* Chaining hashmaps */
+/* Chaining hashmaps, with and without tags in the directory pointers (compare at the low successful query rates) */
+/* Growing chaining hashmaps starting from 1024 directory slots, with and without chain relocation */
+/* Bucketized chaining with SIMD chain nodes of 16-bit and 8-bit fingerprints vs. SIMD bucketing at the same memory budget */
 
 namespace benchmark {
 
 uint64_t get_num_hashmaps_k() {
-#define BENCHMARK_HASHMAPS_K                                                                                               \
-  hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, false, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,     \
-      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,  \
-      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>, \
-      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>
+#define BENCHMARK_HASHMAPS_K                                                                                                                      \
+  hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, false, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                            \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true>,                         \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                        \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                       \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, false, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true, true>,                  \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::KeyValue, 10, true, true>,                   \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true, true>,                  \
+      hashmaps::ChainedHashTable<KeyT, ValueT, DefaultHasher, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true, true>,                 \
+      hashmaps::GrowingChainedHashTable<KeyT, ValueT, DefaultHasher, true, true>,                                                                 \
+      hashmaps::GrowingChainedHashTable<KeyT, ValueT, DefaultHasher, true, false>,                                                                \
+      hashmaps::BucketChainedSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, \
+                                           false, true, hashmap::hashmaps::MemoryBudget::Bucket16FP, 10, true>,                                   \
+      hashmaps::BucketChainedSIMDHashTable<KeyT, ValueT, DefaultHasher, uint8_t, 14, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, \
+                                           false, true, hashmap::hashmaps::MemoryBudget::Bucket8FP, 10, true>,                                    \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,   \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, false>,          \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,   \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, false>
 
-  uint64_t num_hashmaps = 4;
+  uint64_t num_hashmaps = 14;
 
   return num_hashmaps;
 }
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+
+/* READ BENCHMARK HASHMAPS L */
+/* Huge scale: SIMD bucketing with 16-bit and 8-bit fingerprints, using 32-bit and 64-bit bucket indices */
+/* The 32-bit variants are skipped for tables with more than 2^32 buckets, linear probing serves as baseline */
+
+namespace benchmark {
+
+uint64_t get_num_hashmaps_l() {
+#define BENCHMARK_HASHMAPS_L                                                                                                                         \
+  hashmaps::AutoPaddedLinearProbingAoSHashTable<KeyT, ValueT, DefaultHasher, false, utils::PrefetchingLocality::MEDIUM, true>,                       \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,      \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, false>,             \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint16_t, hashmaps::KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,      \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, false,              \
+                                       hashing::FingerprintBucketBits::MSBLSB, 0, hashmaps::BucketOverflowPolicy::NEXT_BUCKET, uint64_t>,            \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,      \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, false>,             \
+      hashmaps::BucketingSIMDHashTable<KeyT, ValueT, DefaultHasher, uint8_t, hashmaps::KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,      \
+                                       false, false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::MEDIUM, true, false,              \
+                                       hashing::FingerprintBucketBits::MSBLSB, 0, hashmaps::BucketOverflowPolicy::NEXT_BUCKET, uint64_t>
+
+  uint64_t num_hashmaps = 5;
+
+  return num_hashmaps;
+}
+
+}  // namespace benchmark
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cmath>
 #include <cstdint>
 #include <filesystem>
@@ -15,6 +16,8 @@
 
 #include "benchmark/benchmark_utils.hpp"
 #include "fmt/format.h"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/misc/compositekey.hpp"
 #include "hashmap/misc/stringkey.hpp"
 #include "hashmap/utils.hpp"
 #include "hedley.h"
@@ -183,6 +186,22 @@ std::string get_distribution_name(DataDistribution distribution);
 
 std::vector<uint8_t> parse_thread_counts(int argc, char** argv);
 
+// Draws every column of composite keys independently, such that all columns contribute to uniqueness
+template <class KeyT>
+KeyT generate_uniform_integer_key() {
+  if constexpr (hashmap::utils::is_composite_key_v<KeyT>) {
+    static std::uniform_int_distribution<uint64_t> column_dis(0, std::numeric_limits<uint64_t>::max());
+    KeyT key;
+    for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+      key.columns[column] = column_dis(reproducible_gen());
+    }
+    return key;
+  } else {
+    static std::uniform_int_distribution<KeyT> uniform_dis(0, std::numeric_limits<KeyT>::max());
+    return uniform_dis(reproducible_gen());
+  }
+}
+
 template <class KeyT>
 std::vector<KeyT> generate_n_unique_integer_keys(uint64_t n, DataDistribution distribution, std::optional<std::vector<KeyT>*> keys_to_exclude) {
   std::vector<KeyT> keys;
@@ -190,15 +209,13 @@ std::vector<KeyT> generate_n_unique_integer_keys(uint64_t n, DataDistribution di
   spdlog::info(fmt::format("Generating {} unique integer keys...", n));
 
   if (distribution == DataDistribution::UNIFORM || distribution == DataDistribution::ZIPF) {
-    std::uniform_int_distribution<KeyT> uniform_dis(0, std::numeric_limits<KeyT>::max());
-
     while (keys.size() < n) {
       uint64_t missing_keys = n - keys.size();
       std::vector<KeyT> temporary_vector;
       temporary_vector.reserve(missing_keys);
 
       for (uint64_t i = 0; i < missing_keys; ++i) {
-        temporary_vector.push_back(uniform_dis(reproducible_gen()));
+        temporary_vector.push_back(generate_uniform_integer_key<KeyT>());
         if (i == 0 || i % 1000 == 0) {
           printProgress(static_cast<double>(i) / static_cast<double>(missing_keys));
         }
@@ -296,7 +313,7 @@ std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>> generat
 
   entries_to_insert = (entries_to_insert / 100) + (entries_to_insert % 100 > 0);
   std::vector<KeyT> keys;
-  if constexpr (std::is_arithmetic<KeyT>::value) {
+  if constexpr (std::is_arithmetic<KeyT>::value || hashmap::utils::is_composite_key_v<KeyT>) {
     keys = generate_n_unique_integer_keys<KeyT>(entries_to_insert, distribution, std::nullopt);
   } else if constexpr (std::is_same_v<KeyT, StringKey>) {
     keys = generate_fill_strings_on_heap(entries_to_insert, std::nullopt);
@@ -355,4 +372,76 @@ std::vector<std::vector<std::pair<KeyT, ValueT>>> generate_prefault_data(uint64_
   return result;
 }
 
+// Key-only sets are benchmarked on the same data as maps, they just do not get the values
+template <class HashtableT, class KeyT, class ValueT>
+void prefault_pregenerated(HashtableT& hashtable, const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+  if constexpr (hashmap::hashmaps::KeyOnlyHashSet<HashtableT>) {
+    std::vector<std::pair<KeyT, hashmap::hashmaps::NoValue>> key_data;
+    key_data.reserve(prefault_data.size());
+    for (const auto& entry : prefault_data) {
+      key_data.push_back({entry.first, hashmap::hashmaps::NoValue{}});
+    }
+    hashtable.prefault_pregenerated(key_data);
+  } else {
+    hashtable.prefault_pregenerated(prefault_data);
+  }
+}
+
+// Capacity and target load factor such that a table of type HashtableT holding num_elements entries allocates at most memory_budget bytes.
+// Most tables allocate memory linear in their capacity, hence we derive the bytes per slot and the fixed overhead from two small tables.
+// Budget-sized tables (e.g., chained tables) and tables that support arbitrary capacities via modulo or fastrange finalization get the full
+// budget, all other tables need a power of two. Tables whose memory does not grow with the capacity (e.g., growing or static tables, which
+// allocate on insert or build) keep table_size. Returns std::nullopt if num_elements entries do not fit into the budget.
+template <class HashtableT>
+std::optional<std::pair<uint64_t, uint8_t>> table_size_for_memory_budget(uint64_t table_size, uint8_t load_factor, uint64_t num_elements,
+                                                                         uint64_t memory_budget) {
+  constexpr uint64_t probe_capacity = 1ULL << 16U;
+  const uint64_t small_usage = hashmap::hashmaps::construct_hashtable<HashtableT>(probe_capacity, load_factor, false).memory_usage();
+  const uint64_t large_usage = hashmap::hashmaps::construct_hashtable<HashtableT>(2 * probe_capacity, load_factor, false).memory_usage();
+
+  if (large_usage <= small_usage) {
+    spdlog::warn("The memory usage of the hash table does not grow with its capacity, cannot size it by the memory budget.");
+    return std::make_pair(table_size, load_factor);
+  }
+
+  const double bytes_per_slot = static_cast<double>(large_usage - small_usage) / static_cast<double>(probe_capacity);
+  const double fixed_bytes = std::max(static_cast<double>(small_usage) - bytes_per_slot * static_cast<double>(probe_capacity), 0.0);
+  uint64_t capacity = static_cast<uint64_t>(std::max(static_cast<double>(memory_budget) - fixed_bytes, 0.0) / bytes_per_slot);
+
+  constexpr bool arbitrary_capacity =
+      requires { HashtableT::calculate_memory_budget(capacity); } || requires { requires HashtableT::supports_arbitrary_capacity; };
+  if constexpr (!arbitrary_capacity) {
+    capacity = std::bit_floor(capacity);
+  }
+
+  if (capacity < num_elements || capacity == 0) {
+    spdlog::warn(fmt::format("A memory budget of {} bytes fits {} slots ({} bytes per slot), which cannot hold {} entries.", memory_budget, capacity,
+                             bytes_per_slot, num_elements));
+    return std::nullopt;
+  }
+
+  const uint64_t capacity_load_factor = (num_elements * 100 + capacity - 1) / capacity;
+  return std::make_pair(capacity, static_cast<uint8_t>(std::min(capacity_load_factor, static_cast<uint64_t>(100))));
+}
+
+// Tables with narrow indices (e.g., BucketingSIMDHashTables with 32-bit bucket indices) cannot address arbitrarily many slots
+template <class HashtableT>
+bool exceeds_max_capacity(uint64_t table_size) {
+  if constexpr (requires { HashtableT::max_capacity; }) {
+    return table_size > HashtableT::max_capacity;
+  } else {
+    return false;
+  }
+}
+
+// Throughput per GiB of memory allocated by the hash table(s), as memory is what we pay for
+inline double throughput_per_gb(uint64_t operations, uint64_t runtime_ms, uint64_t memory_usage) {
+  if (runtime_ms == 0 || memory_usage == 0) {
+    return 0;
+  }
+
+  const double throughput = static_cast<double>(operations) / (static_cast<double>(runtime_ms) / 1000.0);
+  return throughput / (static_cast<double>(memory_usage) / static_cast<double>(1ULL << 30U));
+}
+
 }  // namespace benchmark
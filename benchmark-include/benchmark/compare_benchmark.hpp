@@ -0,0 +1,87 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace benchmark::compare {
+
+/**
+ * Rows of the read and write result CSVs are grouped by all columns that describe the benchmarked configuration, as several sweeps (e.g., zipf
+ * factors, memory budgets, table sizes and batch sizes) write rows with the same hashmap identifier into one file. Columns that a result file
+ * does not have, e.g., the successful query rate in write results, are empty strings.
+ */
+struct ConfigurationKey {
+  std::string hashmap;
+  std::string load_factor;
+  std::string successful_query_rate;
+  std::string thread_count;
+  std::string hashtable_size;
+  std::string distribution;
+  std::string workload;
+  std::string zipf_factor;
+  std::string memory_budget;
+  std::string batch_size;
+
+  auto operator<=>(const ConfigurationKey&) const = default;
+};
+
+/** The columns of the configuration besides hashmap, load factor, successful query rate and thread count, e.g., "Size=1000 Distribution=dense". */
+std::string configuration_details(const ConfigurationKey& configuration);
+
+/** Successful runtimes (in milliseconds) of one result CSV, grouped by configuration. */
+using RuntimeSamples = std::map<ConfigurationKey, std::vector<double>>;
+
+/** Reads a CSV written by ReadBenchmarkResultCollector or WriteBenchmarkResultCollector. Unsuccessful runs are skipped. */
+RuntimeSamples read_result_csv(const std::filesystem::path& path);
+
+enum class Verdict { WIN, REGRESSION, UNCHANGED, INSUFFICIENT_DATA };
+
+std::string verdict_to_str(Verdict verdict);
+
+struct ComparisonResult {
+  ConfigurationKey configuration;
+  uint64_t baseline_runs = 0;
+  uint64_t candidate_runs = 0;
+  double baseline_median = 0;
+  double candidate_median = 0;
+  /** Ratio of the candidate median to the baseline median, i.e., values below 1 are faster. */
+  double ratio = 0;
+  /** Percentile bootstrap confidence interval of the ratio. */
+  double ratio_ci_low = 0;
+  double ratio_ci_high = 0;
+  /** Two-sided permutation test of the difference of medians. */
+  double p_value = 1;
+  /** Smallest p-value the permutation test can report for these run counts. If it is not below alpha, the verdict is INSUFFICIENT_DATA. */
+  double min_p_value = 1;
+  Verdict verdict = Verdict::INSUFFICIENT_DATA;
+};
+
+struct ComparisonOptions {
+  /** Minimum relative change of the median that is flagged, e.g., 0.05 = 5%. */
+  double threshold = 0.05;
+  /** Significance level of the permutation test and 1 - confidence level of the bootstrap interval. */
+  double alpha = 0.05;
+  uint64_t bootstrap_resamples = 10000;
+  /** Exact permutation tests are used up to this number of permutations, otherwise they are sampled. */
+  uint64_t max_exact_permutations = 100000;
+  uint64_t sampled_permutations = 10000;
+  uint32_t seed = 42;
+};
+
+double median(std::vector<double> values);
+
+/** Smallest p-value the permutation test can reach with the given run counts, independent of the measured runtimes. */
+double min_p_value(uint64_t baseline_runs, uint64_t candidate_runs, const ComparisonOptions& options);
+
+/**
+ * Compares all configurations that occur in both sample sets. A configuration is flagged as regression (win) if the median ratio is above
+ * 1 + threshold (below 1 - threshold) and the change is significant, i.e., the permutation test rejects at alpha and the bootstrap confidence
+ * interval of the ratio does not contain 1.
+ */
+std::vector<ComparisonResult> compare(const RuntimeSamples& baseline, const RuntimeSamples& candidate, const ComparisonOptions& options);
+
+}  // namespace benchmark::compare
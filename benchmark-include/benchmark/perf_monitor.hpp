@@ -6,11 +6,15 @@
 #include <sys/resource.h>
 
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "fmt/format.h"
 #include "spdlog/spdlog.h"
@@ -72,6 +76,74 @@ static constexpr std::array<std::array<uint64_t, 6>, NUM_PERF_RAW_EVENTS> SUPPOR
      {0x0129, PERF_TYPE_RAW, AMD_ANY_CPU, AMD_PID0, AMD_EXCLUDE_KERNEL, AMD_EXCLUDE_HV},
      {0x0429, PERF_TYPE_RAW, AMD_ANY_CPU, AMD_PID0, AMD_EXCLUDE_KERNEL, AMD_EXCLUDE_HV}}};
 #endif
+/**
+ * Top-down microarchitecture analysis (TMA) breakdown of the pipeline slots. Level 1 splits all slots into retiring, bad speculation, frontend
+ * bound, and backend bound. Level 2 splits each of them further; we report one child per level 1 category (the other child is the remainder).
+ * All values are fractions of the total slots. Metrics that are not supported by the CPU/kernel are NaN.
+ */
+struct TopdownResult {
+  /** How the metrics were obtained: intel-perf-metrics (Ice Lake+), intel-topdown-slots (Skylake-style), amd-pipeline-utilization, or unavailable. */
+  std::string method = "unavailable";
+
+  double retiring = std::numeric_limits<double>::quiet_NaN();
+  double bad_speculation = std::numeric_limits<double>::quiet_NaN();
+  double frontend_bound = std::numeric_limits<double>::quiet_NaN();
+  double backend_bound = std::numeric_limits<double>::quiet_NaN();
+
+  /** Level 2: part of retiring spent on microcoded/multi-uop instructions. */
+  double heavy_operations = std::numeric_limits<double>::quiet_NaN();
+  /** Level 2: part of bad speculation caused by branch mispredictions (the remainder are machine clears). */
+  double branch_mispredicts = std::numeric_limits<double>::quiet_NaN();
+  /** Level 2: part of frontend bound caused by fetch latency (the remainder is fetch bandwidth). */
+  double fetch_latency = std::numeric_limits<double>::quiet_NaN();
+  /** Level 2: part of backend bound caused by the memory subsystem (the remainder is core bound). */
+  double memory_bound = std::numeric_limits<double>::quiet_NaN();
+
+  std::string to_string() const {
+    return fmt::format(
+        "\n -- TMA Info ({}) --\nretiring: {:.3f}\n  heavy_operations: {:.3f}\nbad_speculation: {:.3f}\n  branch_mispredicts: {:.3f}\n"
+        "frontend_bound: {:.3f}\n  fetch_latency: {:.3f}\nbackend_bound: {:.3f}\n  memory_bound: {:.3f}",
+        method, retiring, heavy_operations, bad_speculation, branch_mispredicts, frontend_bound, fetch_latency, backend_bound, memory_bound);
+  }
+
+  /** Columns of to_csv() in the read and write result CSVs. */
+  static constexpr const char* csv_header =
+      "TMAMethod,TMARetiring,TMAHeavyOperations,TMABadSpeculation,TMABranchMispredicts,TMAFrontendBound,TMAFetchLatency,TMABackendBound,"
+      "TMAMemoryBound";
+
+  std::string to_csv() const {
+    return fmt::format("{},{},{},{},{},{},{},{},{}", method, retiring, heavy_operations, bad_speculation, branch_mispredicts, frontend_bound,
+                       fetch_latency, backend_bound, memory_bound);
+  }
+
+  /** Mean of the per-thread breakdowns, as every thread counts its own slots. All threads use the same method. */
+  static TopdownResult average(const std::vector<TopdownResult>& results) {
+    TopdownResult mean;
+    if (results.empty()) {
+      return mean;
+    }
+
+    mean = {results[0].method, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (const TopdownResult& result : results) {
+      mean.retiring += result.retiring;
+      mean.bad_speculation += result.bad_speculation;
+      mean.frontend_bound += result.frontend_bound;
+      mean.backend_bound += result.backend_bound;
+      mean.heavy_operations += result.heavy_operations;
+      mean.branch_mispredicts += result.branch_mispredicts;
+      mean.fetch_latency += result.fetch_latency;
+      mean.memory_bound += result.memory_bound;
+    }
+
+    const auto num_results = static_cast<double>(results.size());
+    for (double* metric : {&mean.retiring, &mean.bad_speculation, &mean.frontend_bound, &mean.backend_bound, &mean.heavy_operations,
+                           &mean.branch_mispredicts, &mean.fetch_latency, &mean.memory_bound}) {
+      *metric /= num_results;
+    }
+    return mean;
+  }
+};
+
 /**
  * Represents the result of custom performance monitoring class. Uses rusage (cf.
  * https://man7.org/linux/man-pages/man2/getrusage.2.html) and perf (cf.
@@ -207,6 +279,9 @@ struct PerfResult {
   /** AMD: ls_dispatch.ld_st_dispatch - from perf. */
   uint64_t ld_st_dispatch;
 
+  /** Top-down breakdown - from perf, with events discovered from sysfs. */
+  TopdownResult topdown;
+
   std::string to_string() {
     return fmt::format(
         "\n -- RUSAGE Info --\nuser_time: {}\nsystem_time: {}\npage_faults: {}\nnv_context_switches: {}\n\n -- PERF Info --\ncycles: {}\ncycles "
@@ -224,7 +299,8 @@ struct PerfResult {
         branch_misses, sw_page_faults, minor_page_faults, major_page_faults, alignment_faults, l1d_read_misses, l1d_read_accesses, l1d_write_accesses,
         llc_read_misses, llc_read_accesses, llc_write_misses, llc_write_accesses, data_tlb_read_misses, data_tlb_read_accesses, data_tlb_write_misses,
         data_tlb_write_accesses, other_l3_miss_typs, request_miss, all_l3_req_typs, caching_l3_cache_accesses, all_l3_miss_req_typs, ls_dc_accesses,
-        ls_dispatch, ld_st_dispatch);
+        ls_dispatch, ld_st_dispatch) +
+           topdown.to_string();
   }
 
   void benchmark_print() {
@@ -243,6 +319,48 @@ struct PerfResult {
   }
 };
 
+/**
+ * Measures the top-down breakdown of the calling thread. The available events are discovered at runtime from the sysfs event list of the core
+ * PMU (/sys/bus/event_source/devices/{cpu,cpu_core}/events), and encoded using the PMU's format description. On Intel, the topdown-* events are
+ * used (perf metrics on Ice Lake and newer, slot counters before). On AMD Zen, the pipeline utilization events are not exported in sysfs, hence
+ * we use raw encodings from the PPR of the CPU family, which we select by the family and model in /proc/cpuinfo. AMD CPUs without known encodings
+ * (currently everything but Zen 4) report the metrics as unavailable. Each category of events is opened as one perf group, such that the ratios
+ * are computed from counts that were scheduled together.
+ */
+class TopdownMonitor {
+ public:
+  TopdownMonitor();
+  ~TopdownMonitor();
+
+  TopdownMonitor(const TopdownMonitor& other) = delete;
+  TopdownMonitor& operator=(const TopdownMonitor& other) = delete;
+  TopdownMonitor(TopdownMonitor&& other) noexcept = delete;
+  TopdownMonitor& operator=(TopdownMonitor&& other) noexcept = delete;
+
+  void start();
+  void stop();
+  [[nodiscard]] TopdownResult get_result() const;
+
+ private:
+  struct Event {
+    std::string name;
+    uint64_t config;
+    /** Factor from the sysfs events/<name>.scale file, 1 if there is none. */
+    double scale;
+  };
+
+  void open_group(uint32_t pmu_type, const std::vector<Event>& events);
+
+  std::string method_ = "unavailable";
+  /** Dispatch width of AMD CPUs, i.e., the number of pipeline slots per cycle. */
+  double amd_slots_per_cycle_ = 0;
+  std::vector<std::vector<std::pair<std::string, int>>> groups_;
+  /** Sysfs scale per opened event name. */
+  std::map<std::string, double> event_scales_;
+  /** Scaled counts per event name, filled by stop(). */
+  std::map<std::string, double> counts_;
+};
+
 class PerfMonitor {
  public:
   PerfMonitor() : rusage_begin_(), rusage_end_(), event_fds_{-1} {};
@@ -264,6 +382,64 @@ class PerfMonitor {
   rusage rusage_begin_;
   rusage rusage_end_;
   std::array<int, NUM_PERF_TOTAL_EVENTS> event_fds_;
+  TopdownMonitor topdown_;
+};
+
+/** Number of counters in the per-phase counter group (cycles, instructions, LLC read misses, DTLB read misses, branch misses). */
+static const uint8_t NUM_PHASE_COUNTERS = 5;
+
+/**
+ * Hardware counters of a single benchmark phase (e.g., filling the table or running the lookups) of a single thread or, after summing
+ * them up, of all threads. The counts are scaled by time_enabled / time_running to correct for multiplexing. A count is NaN if its counter
+ * could not be opened (e.g., due to perf_event_paranoid or on non-Linux systems), such that the derived metrics are NaN in the CSVs as well.
+ */
+struct PhaseCounters {
+  double cycles = std::numeric_limits<double>::quiet_NaN();
+  double instructions = std::numeric_limits<double>::quiet_NaN();
+  double llc_misses = std::numeric_limits<double>::quiet_NaN();
+  double dtlb_misses = std::numeric_limits<double>::quiet_NaN();
+  double branch_misses = std::numeric_limits<double>::quiet_NaN();
+
+  PhaseCounters& operator+=(const PhaseCounters& other) {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    llc_misses += other.llc_misses;
+    dtlb_misses += other.dtlb_misses;
+    branch_misses += other.branch_misses;
+    return *this;
+  }
+
+  [[nodiscard]] double ipc() const { return instructions / cycles; }
+
+  /** Divides a count by the number of operations (lookups/inserts) of the phase. */
+  [[nodiscard]] static double per_operation(double count, uint64_t operations) {
+    return operations == 0 ? std::numeric_limits<double>::quiet_NaN() : count / static_cast<double>(operations);
+  }
+};
+
+/**
+ * Lightweight counter group that is always compiled into the read and write benchmarks, in contrast to the PerfMonitor of the perf profile
+ * build. The counters are opened for the calling thread only, i.e., each worker thread constructs its own group. All counters are in one perf
+ * event group such that they are scheduled together and read with a single read() call.
+ */
+class PhaseCounterGroup {
+ public:
+  PhaseCounterGroup();
+  ~PhaseCounterGroup();
+
+  PhaseCounterGroup(const PhaseCounterGroup& other) = delete;
+  PhaseCounterGroup& operator=(const PhaseCounterGroup& other) = delete;
+  PhaseCounterGroup(PhaseCounterGroup&& other) noexcept = delete;
+  PhaseCounterGroup& operator=(PhaseCounterGroup&& other) noexcept = delete;
+
+  /** Resets and enables all counters of the group. */
+  void start();
+
+  /** Disables all counters and returns the scaled counts since the last start(). */
+  PhaseCounters stop();
+
+ private:
+  std::array<int, NUM_PHASE_COUNTERS> event_fds_;
 };
 
 }  // namespace benchmark
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <random>
@@ -19,6 +20,7 @@
 
 #include "benchmark/benchmark_shared.hpp"
 #include "benchmark/benchmark_utils.hpp"
+#include "benchmark/perf_monitor.hpp"
 #include "fmt/format.h"
 #include "hashmap/misc/stringkey.hpp"
 #include "hashmap/utils.hpp"
@@ -36,10 +38,6 @@
 #include <AMDProfileController.h>
 #endif
 
-#ifdef HASHMAP_IS_PERFPROFILE_BUILD
-#include "benchmark/perf_monitor.hpp"
-#endif
-
 namespace benchmark::read {
 
 struct IncrementMap {
@@ -60,6 +58,18 @@ struct SpecialPrint {
   std::ostream& m_str;
 };
 
+/** Lookups that checked a filter (a Bloom filter or the tags of a chained directory) before probing the table, and how many it rejected. */
+struct FilterCounters {
+  uint64_t checks = 0;
+  uint64_t rejections = 0;
+
+  FilterCounters& operator+=(const FilterCounters& other) {
+    checks += other.checks;
+    rejections += other.rejections;
+    return *this;
+  }
+};
+
 struct ReadBenchmarkResult {
   std::string hashmap_identifier = "";
   uint8_t load_factor = 0;
@@ -81,6 +91,18 @@ struct ReadBenchmarkResult {
   bool successful = true;
   bool zipf = false;
   uint64_t zipf_factor = 0;
+  uint64_t memory_budget = 0;     // per thread, 0 if every table gets threadtable_size slots
+  uint64_t memory_usage = 0;      // in bytes, summed up over all threads
+  uint64_t entries_filled = 0;    // summed up over all threads
+  PhaseCounters fill_counters;    // summed up over all threads
+  PhaseCounters lookup_counters;  // summed up over all threads
+  // Only for tables with a hot-key cache: the cache hits summed up over all threads, and the identifier of the table behind the cache
+  uint64_t cache_hits = 0;
+  std::string uncached_identifier = "";
+  uint64_t batch_size = 0;  // keys per batch of tables with batch lookups, 0 if keys are looked up one by one
+  // Only for tables with a filter, summed up over all threads. Every rejection saves the probe into the table.
+  FilterCounters filter_counters;
+  TopdownResult lookup_topdown;  // averaged over all threads, "unavailable" if the CPU has no supported top-down events
 };
 
 class ReadBenchmarkResultCollector {
@@ -90,6 +112,8 @@ class ReadBenchmarkResultCollector {
   void to_csv(std::filesystem::path path);
 
  private:
+  double cache_speedup(const ReadBenchmarkResult& result) const;
+
   std::vector<ReadBenchmarkResult> benchmark_results_;
 };
 
@@ -223,13 +247,26 @@ std::vector<KeyT> generate_queries(uint8_t successful_query_rate, uint32_t workl
   return result_queries;
 }
 
+// Result buffer for one batch of a table with batch lookups, value-initialized such that its pages are faulted in before the measurement
+template <class HashtableT>
+auto make_batch_results() {
+  if constexpr (requires { typename HashtableT::BatchResultT; }) {
+    return std::make_unique<typename HashtableT::BatchResultT[]>(HashtableT::batch_size);
+  } else {
+    return std::unique_ptr<uint8_t[]>{};
+  }
+}
+
 template <class KeyT, class ValueT, class HashtableT>
-void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
+void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor, uint64_t memory_budget,
              std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>>* fill_data_ptr, const std::vector<KeyT>* query_data_ptr,
              const std::vector<std::pair<KeyT, ValueT>>* prefault_data_ptr, bool warmup_run, std::atomic<bool>* result_success,
              std::atomic<uint64_t>* result_runtime, std::atomic<uint64_t>* sum_ptr, std::string* result_hashmap_identifier,
-             std::atomic<uint64_t>* result_entry_size, std::atomic<uint64_t>* result_entries_processed, std::string* result_data_ptr,
-             std::atomic<bool>* result_is_aligned, std::barrier<std::__empty_completion>* barrier, [[maybe_unused]] void* meta_collector_ptr) {
+             std::atomic<uint64_t>* result_entry_size, std::atomic<uint64_t>* result_memory_usage, std::atomic<uint64_t>* result_entries_processed,
+             std::string* result_data_ptr,
+             std::atomic<bool>* result_is_aligned, PhaseCounters* result_fill_counters, PhaseCounters* result_lookup_counters,
+             std::atomic<uint64_t>* result_cache_hits, std::string* result_uncached_identifier, FilterCounters* result_filter_counters,
+             TopdownResult* result_lookup_topdown, std::barrier<std::__empty_completion>* barrier, [[maybe_unused]] void* meta_collector_ptr) {
 #ifdef HASHMAP_COLLECT_META_INFO
   MetadataBenchmarkResult meta_result;
   meta_result.hashmap_identifier = hashtable.get_identifier();
@@ -250,8 +287,46 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
   const std::vector<KeyT>& query_data = *query_data_ptr;
   const std::vector<std::pair<KeyT, ValueT>>& prefault_data = *prefault_data_ptr;
 
+  auto skip_benchmark = [&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    *result_success = false;
+    *result_runtime = 0;
+    *sum_ptr = 0;
+
+    if (barrier != nullptr) {
+      barrier->arrive_and_wait();
+      barrier->arrive_and_wait();
+    }
+  };
+
+  // With a memory budget, the number of entries stays the same for all tables, but every table gets as many slots as fit into the budget
+  uint64_t table_size = hashtable_size;
+  uint8_t table_load_factor = load_factor;
+  if (memory_budget > 0) {
+    const auto budget_size = table_size_for_memory_budget<HashtableT>(hashtable_size, load_factor, fill_data.size(), memory_budget);
+    if (!budget_size.has_value()) {
+      spdlog::error(fmt::format("[Thread {}] Hashtable does not fit the memory budget. Skipping the benchmark (sleeping for a second to avoid file "
+                                "naming problems).",
+                                thread_id));
+      skip_benchmark();
+      return;
+    }
+
+    std::tie(table_size, table_load_factor) = budget_size.value();
+    spdlog::info(fmt::format("[Thread {}] Memory budget of {} bytes gives {} slots, i.e., a load factor of {}%", thread_id, memory_budget, table_size,
+                             table_load_factor));
+  }
+
+  if (exceeds_max_capacity<HashtableT>(table_size)) {
+    spdlog::error(fmt::format("[Thread {}] Hashtable cannot address {} slots. Skipping the benchmark (sleeping for a second to avoid file naming "
+                              "problems).",
+                              thread_id, table_size));
+    skip_benchmark();
+    return;
+  }
+
   spdlog::info(fmt::format("[Thread {}] Allocating hashtable memory for read benchmark.", thread_id));
-  HashtableT hashtable(hashtable_size, load_factor);
+  HashtableT hashtable(table_size, table_load_factor);
   spdlog::info(fmt::format("[Thread {}] Hash table identifier is {}", thread_id, hashtable.get_identifier()));
 
   *result_hashmap_identifier = hashtable.get_identifier();
@@ -259,6 +334,9 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
   *result_entries_processed = query_data.size();
   *result_data_ptr = hashtable.get_data_pointer_string();
   *result_is_aligned = hashtable.is_data_aligned_to(hashmap::utils::hugepage_size);
+  if constexpr (requires { hashtable.get_uncached_identifier(); }) {
+    *result_uncached_identifier = hashtable.get_uncached_identifier();
+  }
 
   if (!hashtable.can_be_used()) {
     spdlog::error(
@@ -266,31 +344,32 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
                     "for a second to avoid "
                     "file naming problems).",
                     thread_id));
-    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
-    *result_success = false;
-    *result_runtime = 0;
-    *sum_ptr = 0;
-
-    if (barrier != nullptr) {
-      barrier->arrive_and_wait();
-      barrier->arrive_and_wait();
-    }
+    skip_benchmark();
     return;
   }
 
   // 1. Prefault table
-  spdlog::info(fmt::format("[Thread {}] Prefaulting hash table of size {}...", thread_id, hashtable_size));
+  spdlog::info(fmt::format("[Thread {}] Prefaulting hash table of size {}...", thread_id, table_size));
   if (prefault_data.empty()) {
     ASSERT(std::is_arithmetic<KeyT>::value, "Cannot use hashmap.prefault for non-numeric keys. Please provide custom prefault data.");
     hashtable.prefault();
   } else {
-    hashtable.prefault_pregenerated(prefault_data);
+    prefault_pregenerated(hashtable, prefault_data);
   }
 
+  // Counters are per thread, hence they are opened by the worker itself
+  PhaseCounterGroup counters;
+  TopdownMonitor topdown;
+
   // 2. Fill the table up to desired load factor
   spdlog::info(fmt::format("[Thread {}] Filling hash table...", thread_id));
+  counters.start();
 
-  if constexpr (std::is_pointer_v<ValueT>) {
+  if constexpr (hashmap::hashmaps::KeyOnlyHashSet<HashtableT>) {
+    for (const auto& entry : fill_data) {
+      hashtable.insert(entry.first);
+    }
+  } else if constexpr (std::is_pointer_v<ValueT>) {
     for (auto& entry : fill_data) {
       hashtable.insert(entry.first, &entry.second);
     }
@@ -300,7 +379,21 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
     }
   }
 
-  spdlog::info(fmt::format("[Thread {}] Hashmap load is now {}", thread_id, hashtable.get_current_load()));
+  // Static tables (e.g., the perfect hash table) construct their hash function once all keys are known
+  if constexpr (requires { hashtable.build(); }) {
+    hashtable.build();
+  }
+
+  *result_fill_counters = counters.stop();
+
+  // Inserts may check the filter as well (e.g., the directory tags), hence we only count the checks of the lookup phase
+  FilterCounters fill_filter_counters;
+  if constexpr (requires { hashtable.get_num_filter_checks(); }) {
+    fill_filter_counters = {hashtable.get_num_filter_checks(), hashtable.get_num_filter_rejections()};
+  }
+  *result_memory_usage = hashtable.memory_usage();
+  spdlog::info(
+      fmt::format("[Thread {}] Hashmap load is now {}, it uses {} bytes", thread_id, hashtable.get_current_load(), hashtable.memory_usage()));
   ClobberMemory();
   if (barrier != nullptr) {
     barrier->arrive_and_wait();
@@ -330,10 +423,42 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
   hashtable.start_measurement();
 #endif
 
+  [[maybe_unused]] auto batch_results = make_batch_results<HashtableT>();
+
+  topdown.start();
+  counters.start();
   auto start = std::chrono::high_resolution_clock::now();
   uint64_t sum = 0;
 
-  if constexpr (std::is_pointer_v<ValueT>) {
+  if constexpr (requires { typename HashtableT::BatchResultT; }) {
+    // Any per-batch work, e.g., partitioning or hashing the keys up front, is part of the measurement
+    for (uint64_t offset = 0; offset < query_data.size(); offset += HashtableT::batch_size) {
+      const uint64_t count = std::min(HashtableT::batch_size, query_data.size() - offset);
+      if constexpr (requires { hashtable.lookup_sorted_batch(&query_data[offset], count, batch_results.get()); }) {
+        hashtable.lookup_sorted_batch(&query_data[offset], count, batch_results.get());
+      } else {
+        hashtable.lookup_batch(&query_data[offset], count, batch_results.get());
+      }
+
+      for (uint64_t i = 0; i < count; ++i) {
+        if constexpr (hashmap::hashmaps::KeyOnlyHashSet<HashtableT>) {
+          sum += batch_results[i] ? 1 : 0;
+        } else if constexpr (std::is_pointer_v<ValueT>) {
+          const uint64_t constant_addition = 42;
+          sum += (batch_results[i] != nullptr) ? *batch_results[i] : constant_addition;
+        } else {
+          sum += batch_results[i];
+        }
+        doNotOptimize(sum);
+      }
+    }
+  } else if constexpr (hashmap::hashmaps::KeyOnlyHashSet<HashtableT>) {
+    // Sets only answer existence checks, i.e., we count the hits
+    for (const KeyT& key : query_data) {
+      sum += hashtable.contains(key) ? 1 : 0;
+      doNotOptimize(sum);
+    }
+  } else if constexpr (std::is_pointer_v<ValueT>) {
     const uint64_t constant_addition = 42;
 
     for (const KeyT& key : query_data) {
@@ -341,6 +466,13 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
       sum += (result != nullptr) ? *result : constant_addition;
       doNotOptimize(sum);
     }
+  } else if constexpr (requires(const KeyT& key) { hashtable.lookup_ref(key); }) {
+    // Tables with external value storage hand out references, i.e., we do not copy large values
+    for (const KeyT& key : query_data) {
+      const ValueT* result = hashtable.lookup_ref(key);
+      sum += (result != nullptr) ? static_cast<uint64_t>(*result) : 0;
+      doNotOptimize(sum);
+    }
   } else {
     for (const KeyT& key : query_data) {
       sum += hashtable.lookup(key);
@@ -351,6 +483,9 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
   ClobberMemory();
 
   auto end = std::chrono::high_resolution_clock::now();
+  *result_lookup_counters = counters.stop();
+  topdown.stop();
+  *result_lookup_topdown = topdown.get_result();
 
 #ifdef HASHMAP_IS_VTUNEPROFILE_BUILD
   __itt_task_end(hashmap::utils::vtune_domain);
@@ -381,6 +516,24 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
   meta_result.minfo = *(hashtable.get_minfo());
 #endif
 
+  if constexpr (requires { hashtable.get_num_filter_checks(); }) {
+    *result_filter_counters = {hashtable.get_num_filter_checks() - fill_filter_counters.checks,
+                               hashtable.get_num_filter_rejections() - fill_filter_counters.rejections};
+    spdlog::info(fmt::format("[Thread {}] Filter rejected {} of {} checked lookups", thread_id, result_filter_counters->rejections,
+                             result_filter_counters->checks));
+  }
+
+  if constexpr (requires { hashtable.is_filter_skipped(); }) {
+    spdlog::info(fmt::format("[Thread {}] Bloom filter is {} at the end of the run", thread_id,
+                             hashtable.is_filter_skipped() ? "skipped" : "active"));
+  }
+
+  // The fill phase does not look up keys, i.e., all cache hits stem from the lookup phase
+  if constexpr (requires { hashtable.get_num_cache_hits(); }) {
+    *result_cache_hits = hashtable.get_num_cache_hits();
+    spdlog::info(fmt::format("[Thread {}] Hot-key cache answered {} of {} lookups", thread_id, hashtable.get_num_cache_hits(), query_data.size()));
+  }
+
   *result_runtime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
   *sum_ptr = sum;
   *result_success = true;
@@ -396,7 +549,7 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
 }
 
 template <class KeyT, class ValueT, class HashtableT>
-void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_t load_factor, uint8_t successful_query_rate,
+void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_t load_factor, uint64_t memory_budget, uint8_t successful_query_rate,
                      DataDistribution distribution, uint32_t workload, uint8_t thread_count,
                      std::vector<std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>>>& fill_data,
                      const std::vector<std::vector<KeyT>>& query_data, ReadBenchmarkResultCollector* collector, bool warmup_run, bool zipf_requests,
@@ -423,6 +576,13 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
   result.successful = false;
   result.zipf = zipf_requests;
   result.zipf_factor = zipf_factor;
+  result.memory_budget = memory_budget;
+  if constexpr (requires { HashtableT::batch_size; }) {
+    result.batch_size = HashtableT::batch_size;
+  }
+  for (uint8_t thread = 0; thread < thread_count; ++thread) {
+    result.entries_filled += fill_data[thread].size();
+  }
 
   if (warmup_run) {
     spdlog::info("Doing warmup run...");
@@ -438,21 +598,27 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
     std::atomic<uint64_t> runtime = 0;
     std::atomic<uint64_t> atomic_sum = 0;
     std::atomic<uint64_t> entry_size = 0;
+    std::atomic<uint64_t> memory_usage = 0;
     std::atomic<uint64_t> entries_processed = 0;
     std::atomic<bool> is_aligned_to_hp = false;
+    std::atomic<uint64_t> cache_hits = 0;
 
     // single-thread = do everything in main thread
-    do_work<KeyT, ValueT, HashtableT>(thread_table_size, 0, load_factor, &fill_data[0], &query_data[0], &prefault_data[0], warmup_run, &successful,
-                                      &runtime, &atomic_sum, &result.hashmap_identifier, &entry_size, &entries_processed, &result.data_ptr,
-                                      &is_aligned_to_hp, nullptr, meta_collector_ptr);
+    do_work<KeyT, ValueT, HashtableT>(thread_table_size, 0, load_factor, memory_budget, &fill_data[0], &query_data[0], &prefault_data[0], warmup_run,
+                                      &successful, &runtime, &atomic_sum, &result.hashmap_identifier, &entry_size, &memory_usage, &entries_processed,
+                                      &result.data_ptr, &is_aligned_to_hp, &result.fill_counters, &result.lookup_counters, &cache_hits,
+                                      &result.uncached_identifier, &result.filter_counters, &result.lookup_topdown, nullptr,
+                                      meta_collector_ptr);
     result.successful = successful.load();
     result.runtime = runtime.load();
     result.thread_avg_runtime = static_cast<double>(result.runtime);
     result.thread_max_runtime = result.runtime;
     sum = atomic_sum.load();
     result.entry_size = entry_size.load();
+    result.memory_usage = memory_usage.load();
     result.entries_processed = entries_processed.load();
     result.is_aligned_to_hp = is_aligned_to_hp.load();
+    result.cache_hits = cache_hits.load();
 
     if (!result.successful) {
       spdlog::error("Got no success!");
@@ -473,16 +639,25 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
     std::vector<std::atomic<uint64_t>> sums(thread_count);
     std::vector<std::string> identifiers(thread_count);
     std::vector<std::atomic<uint64_t>> entry_sizes(thread_count);
+    std::vector<std::atomic<uint64_t>> memory_usages(thread_count);
     std::vector<std::atomic<uint64_t>> entries_processed(thread_count);
     std::vector<std::string> data_ptrs(thread_count);
     std::vector<std::atomic<uint8_t>> is_aligneds(thread_count);
+    std::vector<PhaseCounters> fill_counters(thread_count);
+    std::vector<PhaseCounters> lookup_counters(thread_count);
+    std::vector<std::atomic<uint64_t>> cache_hits(thread_count);
+    std::vector<std::string> uncached_identifiers(thread_count);
+    std::vector<FilterCounters> filter_counters(thread_count);
+    std::vector<TopdownResult> lookup_topdowns(thread_count);
 
     for (uint8_t thread = 0; thread < thread_count; ++thread) {
-      workers.push_back(std::thread(do_work<KeyT, ValueT, HashtableT>, thread_table_size, thread, load_factor, &fill_data[thread],
+      workers.push_back(std::thread(do_work<KeyT, ValueT, HashtableT>, thread_table_size, thread, load_factor, memory_budget, &fill_data[thread],
                                     &query_data[thread], &prefault_data[thread], warmup_run,
                                     reinterpret_cast<std::atomic<bool>*>(&successfuls[thread]), &runtimes[thread], &sums[thread],
-                                    &identifiers[thread], &entry_sizes[thread], &entries_processed[thread], &data_ptrs[thread],
-                                    reinterpret_cast<std::atomic<bool>*>(&is_aligneds[thread]), &sync_point, meta_collector_ptr));
+                                    &identifiers[thread], &entry_sizes[thread], &memory_usages[thread], &entries_processed[thread],
+                                    &data_ptrs[thread], reinterpret_cast<std::atomic<bool>*>(&is_aligneds[thread]), &fill_counters[thread],
+                                    &lookup_counters[thread], &cache_hits[thread], &uncached_identifiers[thread], &filter_counters[thread],
+                                    &lookup_topdowns[thread], &sync_point, meta_collector_ptr));
     }
 
     // 2. wait until all threads have signaled they are ready, start clock (or if any thread is not successful, then skip)
@@ -536,6 +711,19 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
       spdlog::error("inconsistent entry sizes");
     }
 
+    for (const auto& memory_usage : memory_usages) {
+      result.memory_usage += memory_usage.load();
+    }
+
+    for (const auto& thread_cache_hits : cache_hits) {
+      result.cache_hits += thread_cache_hits.load();
+    }
+    result.uncached_identifier = uncached_identifiers[0];
+
+    for (const FilterCounters& thread_filter_counters : filter_counters) {
+      result.filter_counters += thread_filter_counters;
+    }
+
     result.entries_processed = entries_processed[0].load();
     bool consistent_ep = true;
     for (const auto& entries_proc : entries_processed) {
@@ -565,6 +753,14 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
     double thread_avg_runtime = static_cast<double>(total_runtime) / static_cast<double>(thread_count);
     result.thread_avg_runtime = thread_avg_runtime;
     result.thread_max_runtime = max_runtime;
+
+    result.fill_counters = fill_counters[0];
+    result.lookup_counters = lookup_counters[0];
+    for (uint8_t thread = 1; thread < thread_count; ++thread) {
+      result.fill_counters += fill_counters[thread];
+      result.lookup_counters += lookup_counters[thread];
+    }
+    result.lookup_topdown = TopdownResult::average(lookup_topdowns);
   }
 
   if (result.successful) {
@@ -576,7 +772,13 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
 
     double lookup_throughput = static_cast<double>(total_data) / runtime_in_seconds;
 
-    spdlog::info(fmt::format("Benchmark finished in {} milliseconds, i.e. {} Lookups/s. (temp value={})", result.runtime, lookup_throughput, sum));
+    spdlog::info(fmt::format("Benchmark finished in {} milliseconds, i.e. {} Lookups/s, {} Lookups/s per GiB of {} bytes. (temp value={})",
+                             result.runtime, lookup_throughput, throughput_per_gb(total_data, result.runtime, result.memory_usage),
+                             result.memory_usage, sum));
+    spdlog::info(fmt::format("Lookup phase: IPC = {:.2f}, LLC misses/lookup = {:.3f}, DTLB misses/lookup = {:.3f}, branch misses/lookup = {:.3f}",
+                             result.lookup_counters.ipc(), PhaseCounters::per_operation(result.lookup_counters.llc_misses, total_data),
+                             PhaseCounters::per_operation(result.lookup_counters.dtlb_misses, total_data),
+                             PhaseCounters::per_operation(result.lookup_counters.branch_misses, total_data)));
     std::cout << std::endl;
   }
 
@@ -589,21 +791,21 @@ void read_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8_
 
 template <class KeyT, class ValueT, class HashtableT>
 void read_bench_loop_impl(uint8_t runs_per_hashmap, uint64_t hashtable_size, uint64_t thread_table_size, uint8_t load_factor,
-                          uint8_t successful_query_rate, DataDistribution distribution, uint32_t workload, uint8_t thread_count,
-                          std::vector<std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>>>& fill_data,
+                          uint64_t memory_budget, uint8_t successful_query_rate, DataDistribution distribution, uint32_t workload,
+                          uint8_t thread_count, std::vector<std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>>>& fill_data,
                           const std::vector<std::vector<KeyT>>& query_data, ReadBenchmarkResultCollector* collector, bool store_intermediate_results,
                           bool warmup_run, bool zipf_requests, uint64_t zipf_factor,
                           const std::vector<std::vector<std::pair<KeyT, ValueT>>>& prefault_data, [[maybe_unused]] void* meta_collector_ptr) {
   if (warmup_run) {
-    read_bench_impl<KeyT, ValueT, HashtableT>(hashtable_size, thread_table_size, load_factor, successful_query_rate, distribution, workload,
-                                              thread_count, fill_data, query_data, collector, true, zipf_requests, zipf_factor, prefault_data,
-                                              meta_collector_ptr);
+    read_bench_impl<KeyT, ValueT, HashtableT>(hashtable_size, thread_table_size, load_factor, memory_budget, successful_query_rate, distribution,
+                                              workload, thread_count, fill_data, query_data, collector, true, zipf_requests, zipf_factor,
+                                              prefault_data, meta_collector_ptr);
   }
 
   for (uint8_t i = 0; i < runs_per_hashmap; ++i) {
-    read_bench_impl<KeyT, ValueT, HashtableT>(hashtable_size, thread_table_size, load_factor, successful_query_rate, distribution, workload,
-                                              thread_count, fill_data, query_data, collector, false, zipf_requests, zipf_factor, prefault_data,
-                                              meta_collector_ptr);
+    read_bench_impl<KeyT, ValueT, HashtableT>(hashtable_size, thread_table_size, load_factor, memory_budget, successful_query_rate, distribution,
+                                              workload, thread_count, fill_data, query_data, collector, false, zipf_requests, zipf_factor,
+                                              prefault_data, meta_collector_ptr);
   }
 
   if (store_intermediate_results) {
@@ -854,7 +1056,8 @@ void read_bench(uint8_t load_factor, uint8_t successful_query_rate, uint64_t has
                 uint32_t workload /* in MB w.r.t. sizeof(KeyT) */, uint8_t runs_per_hashmap, uint8_t thread_count,
                 ReadBenchmarkResultCollector* collector, bool store_intermediate_results, bool warmup_run,
                 const std::vector<std::vector<std::pair<KeyT, ValueT>>>& prefault_data, bool zipf_requests, uint64_t zipf_factor,
-                std::optional<std::string> external_benchmark_data_folder = std::nullopt, [[maybe_unused]] void* meta_collector_ptr = nullptr) {
+                std::optional<std::string> external_benchmark_data_folder = std::nullopt, [[maybe_unused]] void* meta_collector_ptr = nullptr,
+                uint64_t memory_budget = 0) {
   ASSERT(successful_query_rate >= 0 && successful_query_rate <= 100, "Invalid SQR");
   ASSERT(load_factor >= 0 && load_factor <= 100, "Invalid LF");
   ASSERT(hashmap::utils::is_power_of_two(thread_count), "Invalid thread count");
@@ -863,12 +1066,15 @@ void read_bench(uint8_t load_factor, uint8_t successful_query_rate, uint64_t has
   constexpr std::size_t number_of_hashtables = sizeof...(Types);
   uint64_t thread_table_size = hashtable_size / static_cast<uint64_t>(thread_count);
   uint32_t thread_workload_size = workload / static_cast<uint32_t>(thread_count);
+  uint64_t thread_memory_budget = memory_budget / static_cast<uint64_t>(thread_count);
 
   spdlog::info(fmt::format(
       "Hello, this is the hashmap read benchmark. Running for {} hash tables, {} times per hashtable. "
-      "LF={}, SQR={}, Size={}, Distribution={}, Workload={}, Workload/Thread={}, thread_count={}, size_per_thread={}, use_zipf={}, zipf_factor={}",
+      "LF={}, SQR={}, Size={}, Distribution={}, Workload={}, Workload/Thread={}, thread_count={}, size_per_thread={}, use_zipf={}, zipf_factor={}, "
+      "memory_budget_per_thread={}",
       number_of_hashtables, static_cast<int>(runs_per_hashmap), static_cast<int>(load_factor), static_cast<int>(successful_query_rate),
-      hashtable_size, static_cast<int>(distribution), workload, thread_workload_size, thread_count, thread_table_size, zipf_requests, zipf_factor));
+      hashtable_size, static_cast<int>(distribution), workload, thread_workload_size, thread_count, thread_table_size, zipf_requests, zipf_factor,
+      thread_memory_budget));
 
   typedef typename std::remove_pointer<ValueT>::type ValueTNoPtr;
 
@@ -894,9 +1100,9 @@ void read_bench(uint8_t load_factor, uint8_t successful_query_rate, uint64_t has
 
   spdlog::info("Query data obtained, calling benchmark loop.");
 
-  (read_bench_loop_impl<KeyT, ValueT, Types>(runs_per_hashmap, hashtable_size, thread_table_size, load_factor, successful_query_rate, distribution,
-                                             workload, thread_count, fill_data, query_data, collector, store_intermediate_results, warmup_run,
-                                             zipf_requests, zipf_factor, prefault_data, meta_collector_ptr),
+  (read_bench_loop_impl<KeyT, ValueT, Types>(runs_per_hashmap, hashtable_size, thread_table_size, load_factor, thread_memory_budget,
+                                             successful_query_rate, distribution, workload, thread_count, fill_data, query_data, collector,
+                                             store_intermediate_results, warmup_run, zipf_requests, zipf_factor, prefault_data, meta_collector_ptr),
    ...);
 
   if constexpr (std::is_same_v<KeyT, StringKey>) {
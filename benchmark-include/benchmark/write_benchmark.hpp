@@ -12,6 +12,7 @@
 
 #include "benchmark/benchmark_shared.hpp"
 #include "benchmark/benchmark_utils.hpp"
+#include "benchmark/perf_monitor.hpp"
 #include "fmt/format.h"
 #include "hashmap/utils.hpp"
 #include "spdlog/spdlog.h"
@@ -28,6 +29,7 @@ struct WriteBenchmarkResult {
   double key_size = 0;
   double value_size = 0;
   uint64_t entry_size = 0;
+  uint64_t memory_usage = 0;  // in bytes, summed up over all threads
   uint64_t entries_processed = 0;
   uint64_t runtime = 0;  // in milliseconds
   double thread_avg_runtime = 0;
@@ -35,6 +37,8 @@ struct WriteBenchmarkResult {
   std::string data_ptr = "";
   bool is_aligned_to_hp = false;
   bool successful = true;
+  PhaseCounters insert_counters;  // summed up over all threads
+  TopdownResult insert_topdown;   // averaged over all threads, "unavailable" if the CPU has no supported top-down events
 };
 
 class WriteBenchmarkResultCollector {
@@ -94,11 +98,27 @@ template <class KeyT, class ValueT, class HashtableT>
 void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
              std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>>* query_data_ptr,
              const std::vector<std::pair<KeyT, ValueT>>* prefault_data_ptr, std::atomic<bool>* result_success, std::atomic<uint64_t>* result_runtime,
-             std::string* result_hashmap_identifier, std::atomic<uint64_t>* result_entry_size, std::atomic<uint64_t>* result_entries_processed,
-             std::string* result_data_ptr, std::atomic<bool>* result_is_aligned, std::barrier<std::__empty_completion>* barrier) {
+             std::string* result_hashmap_identifier, std::atomic<uint64_t>* result_entry_size, std::atomic<uint64_t>* result_memory_usage,
+             std::atomic<uint64_t>* result_entries_processed, std::string* result_data_ptr, std::atomic<bool>* result_is_aligned,
+             PhaseCounters* result_counters, TopdownResult* result_topdown, std::barrier<std::__empty_completion>* barrier) {
   std::vector<std::pair<KeyT, typename std::remove_pointer<ValueT>::type>>& query_data = *query_data_ptr;
   const std::vector<std::pair<KeyT, ValueT>>& prefault_data = *prefault_data_ptr;
 
+  if (exceeds_max_capacity<HashtableT>(hashtable_size)) {
+    spdlog::error(fmt::format("[Thread {}] Hashtable cannot address {} slots. Skipping the benchmark (sleeping for a second to avoid file naming "
+                              "problems).",
+                              thread_id, hashtable_size));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    *result_success = false;
+    *result_runtime = 0;
+
+    if (barrier != nullptr) {
+      barrier->arrive_and_wait();
+      barrier->arrive_and_wait();
+    }
+    return;
+  }
+
   spdlog::info(fmt::format("[Thread {}] Allocating hashtable memory for write benchmark.", thread_id));
   HashtableT hashtable(hashtable_size, load_factor);
   spdlog::info(fmt::format("[Thread {}] Hash table identifier is {}", thread_id, hashtable.get_identifier()));
@@ -128,18 +148,33 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
 
   // 1. Prefault table
   spdlog::info(fmt::format("[Thread {}] Prefaulting hash table of size {}...", thread_id, hashtable_size));
-  hashtable.prefault_pregenerated(prefault_data);
+  if (prefault_data.empty()) {
+    ASSERT(std::is_arithmetic<KeyT>::value, "Cannot use hashmap.prefault for non-numeric keys. Please provide custom prefault data.");
+    hashtable.prefault();
+  } else {
+    prefault_pregenerated(hashtable, prefault_data);
+  }
   spdlog::info(fmt::format("[Thread {}] Hashmap load is {} (should be 0!)", thread_id, hashtable.get_current_load()));
 
+  // Counters are per thread, hence they are opened by the worker itself
+  PhaseCounterGroup counters;
+  TopdownMonitor topdown;
+
   ClobberMemory();
   if (barrier != nullptr) {
     barrier->arrive_and_wait();
   }
   ClobberMemory();
 
+  topdown.start();
+  counters.start();
   auto start = std::chrono::high_resolution_clock::now();
 
-  if constexpr (std::is_pointer_v<ValueT>) {
+  if constexpr (hashmap::hashmaps::KeyOnlyHashSet<HashtableT>) {
+    for (const auto& entry : query_data) {
+      hashtable.insert(entry.first);
+    }
+  } else if constexpr (std::is_pointer_v<ValueT>) {
     for (auto& entry : query_data) {
       hashtable.insert(entry.first, &entry.second);
     }
@@ -149,11 +184,20 @@ void do_work(uint64_t hashtable_size, uint8_t thread_id, uint8_t load_factor,
     }
   }
 
+  // Static tables (e.g., the perfect hash table) construct their hash function once all keys are known, which is part of the insertion cost
+  if constexpr (requires { hashtable.build(); }) {
+    hashtable.build();
+  }
+
   ClobberMemory();
 
   auto end = std::chrono::high_resolution_clock::now();
+  *result_counters = counters.stop();
+  topdown.stop();
+  *result_topdown = topdown.get_result();
 
   *result_runtime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+  *result_memory_usage = hashtable.memory_usage();
   *result_success = true;
 
   if (barrier != nullptr) {
@@ -197,18 +241,21 @@ void write_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8
     std::atomic<bool> successful = false;
     std::atomic<uint64_t> runtime = 0;
     std::atomic<uint64_t> entry_size = 0;
+    std::atomic<uint64_t> memory_usage = 0;
     std::atomic<uint64_t> entries_processed = 0;
     std::atomic<bool> is_aligned_to_hp = false;
 
     // single-thread = do everything in main thread
     do_work<KeyT, ValueT, HashtableT>(thread_table_size, 0, load_factor, &query_data[0], &prefault_data[0], &successful, &runtime,
-                                      &result.hashmap_identifier, &entry_size, &entries_processed, &result.data_ptr, &is_aligned_to_hp, nullptr);
+                                      &result.hashmap_identifier, &entry_size, &memory_usage, &entries_processed, &result.data_ptr,
+                                      &is_aligned_to_hp, &result.insert_counters, &result.insert_topdown, nullptr);
 
     result.successful = successful.load();
     result.runtime = runtime.load();
     result.thread_avg_runtime = static_cast<double>(result.runtime);
     result.thread_max_runtime = result.runtime;
     result.entry_size = entry_size.load();
+    result.memory_usage = memory_usage.load();
     result.entries_processed = entries_processed.load();
     result.is_aligned_to_hp = is_aligned_to_hp.load();
 
@@ -227,15 +274,19 @@ void write_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8
     std::vector<std::atomic<uint64_t>> runtimes(thread_count);
     std::vector<std::string> identifiers(thread_count);
     std::vector<std::atomic<uint64_t>> entry_sizes(thread_count);
+    std::vector<std::atomic<uint64_t>> memory_usages(thread_count);
     std::vector<std::atomic<uint64_t>> entries_processed(thread_count);
     std::vector<std::string> data_ptrs(thread_count);
     std::vector<std::atomic<uint8_t>> is_aligneds(thread_count);
+    std::vector<PhaseCounters> insert_counters(thread_count);
+    std::vector<TopdownResult> insert_topdowns(thread_count);
 
     for (uint8_t thread = 0; thread < thread_count; ++thread) {
       workers.push_back(std::thread(do_work<KeyT, ValueT, HashtableT>, thread_table_size, thread, load_factor, &query_data[thread],
                                     &prefault_data[thread], reinterpret_cast<std::atomic<bool>*>(&successfuls[thread]), &runtimes[thread],
-                                    &identifiers[thread], &entry_sizes[thread], &entries_processed[thread], &data_ptrs[thread],
-                                    reinterpret_cast<std::atomic<bool>*>(&is_aligneds[thread]), &sync_point));
+                                    &identifiers[thread], &entry_sizes[thread], &memory_usages[thread], &entries_processed[thread],
+                                    &data_ptrs[thread], reinterpret_cast<std::atomic<bool>*>(&is_aligneds[thread]), &insert_counters[thread],
+                                    &insert_topdowns[thread], &sync_point));
     }
 
     // 2. wait until all threads have signaled they are ready, start clock (or if any thread is not successful, then skip)
@@ -284,6 +335,10 @@ void write_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8
       spdlog::error("inconsistent entry sizes");
     }
 
+    for (const auto& memory_usage : memory_usages) {
+      result.memory_usage += memory_usage.load();
+    }
+
     result.entries_processed = entries_processed[0].load();
     bool consistent_ep = true;
     for (const auto& entries_proc : entries_processed) {
@@ -313,6 +368,12 @@ void write_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8
     double thread_avg_runtime = static_cast<double>(total_runtime) / static_cast<double>(thread_count);
     result.thread_avg_runtime = thread_avg_runtime;
     result.thread_max_runtime = max_runtime;
+
+    result.insert_counters = insert_counters[0];
+    for (uint8_t thread = 1; thread < thread_count; ++thread) {
+      result.insert_counters += insert_counters[thread];
+    }
+    result.insert_topdown = TopdownResult::average(insert_topdowns);
   }
   if (result.successful) {
     double runtime_in_seconds = static_cast<double>(result.runtime) / 1000.0;
@@ -323,7 +384,12 @@ void write_bench_impl(uint64_t hashtable_size, uint64_t thread_table_size, uint8
 
     double lookup_throughput = static_cast<double>(total_data) / runtime_in_seconds;
 
-    spdlog::info(fmt::format("Benchmark finished in {} milliseconds, i.e. {} Inserts/s.", result.runtime, lookup_throughput));
+    spdlog::info(fmt::format("Benchmark finished in {} milliseconds, i.e. {} Inserts/s, {} Inserts/s per GiB of {} bytes.", result.runtime,
+                             lookup_throughput, throughput_per_gb(total_data, result.runtime, result.memory_usage), result.memory_usage));
+    spdlog::info(fmt::format("Insert phase: IPC = {:.2f}, LLC misses/insert = {:.3f}, DTLB misses/insert = {:.3f}, branch misses/insert = {:.3f}",
+                             result.insert_counters.ipc(), PhaseCounters::per_operation(result.insert_counters.llc_misses, total_data),
+                             PhaseCounters::per_operation(result.insert_counters.dtlb_misses, total_data),
+                             PhaseCounters::per_operation(result.insert_counters.branch_misses, total_data)));
 
     std::cout << std::endl;
   }
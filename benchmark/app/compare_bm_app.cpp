@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/compare_benchmark.hpp"
+#include "fmt/format.h"
+#include "spdlog/spdlog.h"
+
+using namespace benchmark::compare;
+
+// Compares result CSVs of the read or write benchmark app. The first CSV is the baseline, every further CSV is compared against it.
+// Usage: ./hashmap-compare-benchmark [--threshold=<percent>] [--alpha=<level>] baseline.csv candidate.csv [candidate.csv ...]
+// Exits with a non-zero status if any configuration regressed, such that the tool can gate upgrades.
+int main(int argc, char** argv) {
+  ComparisonOptions options;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string argument(argv[i]);
+    if (argument.rfind("--threshold=", 0) == 0) {
+      options.threshold = std::stod(argument.substr(12)) / 100.0;
+    } else if (argument.rfind("--alpha=", 0) == 0) {
+      options.alpha = std::stod(argument.substr(8));
+    } else {
+      files.push_back(argument);
+    }
+  }
+
+  if (files.size() < 2) {
+    spdlog::error("Usage: compare_bm [--threshold=<percent>] [--alpha=<level>] baseline.csv candidate.csv [candidate.csv ...]");
+    return EXIT_FAILURE;
+  }
+
+  spdlog::info(fmt::format("Comparing against baseline {} (threshold = {}%, alpha = {})", files[0], options.threshold * 100, options.alpha));
+  const RuntimeSamples baseline = read_result_csv(files[0]);
+
+  uint64_t regressions = 0;
+  for (uint64_t file = 1; file < files.size(); ++file) {
+    const RuntimeSamples candidate = read_result_csv(files[file]);
+    const std::vector<ComparisonResult> results = compare(baseline, candidate, options);
+    spdlog::info(fmt::format("{}: {} common configurations", files[file], results.size()));
+
+    std::cout << fmt::format("{:<80} {:>4} {:>4} {:>7} {:>10} {:>10} {:>8} {:>19} {:>8}  {:<17}  {}", "Hashmap", "LF", "SQR", "Threads",
+                             "Base [ms]", "Cand [ms]", "Ratio", "95% CI", "p", "Verdict", "Configuration")
+              << std::endl;
+    for (const ComparisonResult& result : results) {
+      const ConfigurationKey& configuration = result.configuration;
+      std::cout << fmt::format("{:<80} {:>4} {:>4} {:>7} {:>10.1f} {:>10.1f} {:>8.3f} [{:>7.3f}, {:>7.3f}] {:>8.4f}  {:<17}  {}",
+                               configuration.hashmap, configuration.load_factor, configuration.successful_query_rate, configuration.thread_count,
+                               result.baseline_median, result.candidate_median, result.ratio, result.ratio_ci_low, result.ratio_ci_high,
+                               result.p_value, verdict_to_str(result.verdict), configuration_details(configuration))
+                << std::endl;
+      regressions += result.verdict == Verdict::REGRESSION ? 1 : 0;
+    }
+    std::cout << std::endl;
+
+    // Too few runs are not a pass, make sure that nobody mistakes them for one
+    uint64_t underpowered = 0;
+    for (const ComparisonResult& result : results) {
+      underpowered += result.min_p_value >= options.alpha ? 1 : 0;
+    }
+    if (underpowered > 0) {
+      spdlog::warn(fmt::format("{}: {} configurations have too few runs to reach p < {} and were not judged. Run the benchmarks at least 5 "
+                               "times per table (runs_per_hashmap) on both sides.",
+                               files[file], underpowered, options.alpha));
+    }
+  }
+
+  if (regressions > 0) {
+    spdlog::error(fmt::format("Found {} regressions.", regressions));
+    return EXIT_FAILURE;
+  }
+  spdlog::info("No regressions found.");
+  return EXIT_SUCCESS;
+}
@@ -9,6 +9,10 @@
 #include "benchmark/benchmark_hashmaps_b.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_B
 
+#else
+#ifdef HASHMAP_HUGE_SCALE
+#include "benchmark/benchmark_hashmaps_l.hpp"
+#define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_L
 #else
 #ifdef HASHMAP_LARGE_MATRIX
 #include "benchmark/benchmark_hashmaps_a.hpp"
@@ -19,7 +23,7 @@
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_D
 #else
 
-#ifdef HASHMAP_STRINGKEYS
+#if defined(HASHMAP_STRINGKEYS) || defined(HASHMAP_COMPOSITEKEYS)
 #include "benchmark/benchmark_hashmaps_f.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_F
 #else
@@ -29,7 +33,8 @@
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_G
 #else
 
-#if defined(HASHMAP_LARGEVALUES) || defined(HASHMAP_POINTERVALUES) || defined(HASHMAP_MT) || defined(HASHMAP_ZIPF)
+#if defined(HASHMAP_LARGEVALUES) || defined(HASHMAP_POINTERVALUES) || defined(HASHMAP_MT) || defined(HASHMAP_ZIPF) || \
+    defined(HASHMAP_SORTED_BATCH) || defined(HASHMAP_VERTICAL_PROBING)
 #include "benchmark/benchmark_hashmaps_h.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_H
 #else
@@ -56,6 +61,7 @@
 #include "benchmark/benchmark_hashmaps_c.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_C
 #endif
+#endif
 
 #endif
 
@@ -75,21 +81,34 @@
 #include "benchmark/read_benchmark.hpp"
 #include "fmt/format.h"
 #include "gcem.hpp"
+#include "hashmap/hashes/aeshasher.hpp"
+#include "hashmap/hashes/crc32hasher.hpp"
 #include "hashmap/hashes/multaddshifthasher.hpp"
 #include "hashmap/hashes/multshifthasher.hpp"
 #include "hashmap/hashes/murmurhasher.hpp"
 #include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/tabulationhasher.hpp"
 #include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/arena_value.hpp"
+#include "hashmap/hashmaps/bloom_filtered.hpp"
+#include "hashmap/hashmaps/bucket_chained_simd.hpp"
 #include "hashmap/hashmaps/bucketing_simd.hpp"
 #include "hashmap/hashmaps/chained.hpp"
 #include "hashmap/hashmaps/fingerprinting_simd_soa.hpp"
+#include "hashmap/hashmaps/growing_chained.hpp"
+#include "hashmap/hashmaps/hot_key_cached.hpp"
 #include "hashmap/hashmaps/linear_probing_aos.hpp"
 #include "hashmap/hashmaps/linear_probing_soa.hpp"
 #include "hashmap/hashmaps/linear_probing_soa_packed.hpp"
+#include "hashmap/hashmaps/perfect_hashing.hpp"
 #include "hashmap/hashmaps/quadratic_probing_aos.hpp"
+#include "hashmap/hashmaps/quotient_bucketing_simd.hpp"
 #include "hashmap/hashmaps/recalc_robin_hood_aos.hpp"
 #include "hashmap/hashmaps/simple_simd_soa.hpp"
+#include "hashmap/hashmaps/sorted_batch.hpp"
 #include "hashmap/hashmaps/storing_robin_hood_aos.hpp"
+#include "hashmap/hashmaps/vertical_linear_probing_soa.hpp"
+#include "hashmap/misc/compositekey.hpp"
 #include "hashmap/misc/stringkey.hpp"
 #include "hashmap/utils.hpp"
 #include "spdlog/spdlog.h"
@@ -121,6 +140,11 @@ int main(int argc, char** argv) {
   std::vector<uint64_t> hashtable_sizes{gcem::pow<uint64_t, uint64_t>(2, 27)};
   std::vector<uint8_t> thread_counts = parse_thread_counts(argc, argv);
 
+#ifdef HASHMAP_HUGE_SCALE
+  // 2^36 slots exceed 2^32 buckets for both 8 and 16 fingerprints per bucket, i.e., only tables with 64-bit bucket indices can address them
+  hashtable_sizes = {gcem::pow<uint64_t, uint64_t>(2, 33), gcem::pow<uint64_t, uint64_t>(2, 36)};
+#endif
+
   std::vector<uint32_t> workloads{utils::default_workload};  // 256 on ARM, 1024 on x86/Power - in MB
 
 #ifdef HASHMAP_REPR
@@ -129,12 +153,25 @@ int main(int argc, char** argv) {
   }
 #endif
 
+#ifdef HASHMAP_BENCHMARK_CHAINED_ONLY
+  // The directory tags only pay off for misses, hence we resolve the low successful query rates more finely
+  successful_query_rates = {100, 25, 10, 5, 0};
+#endif
+
+#ifdef HASHMAP_EQUAL_MEMORY
+  // Every table gets as many slots as fit into the budget, i.e., 1.5x and 2x the memory of hashtable_size densely stored key/value pairs
+  std::vector<uint16_t> memory_budget_percentages{150, 200};
+#else
+  std::vector<uint16_t> memory_budget_percentages{0};
+#endif
+
 #ifdef HASHMAP_ZIPF
   bool zipf_requests = true;
-  uint64_t zipf_factor = 150;  // divided by 100 later
+  // Divided by 100 later, the hot-key caches should pay off more the more skewed the requests are
+  std::vector<uint64_t> zipf_factors{125, 150, 200};
 #else
   bool zipf_requests = false;
-  uint64_t zipf_factor = 0;
+  std::vector<uint64_t> zipf_factors{0};
 #endif
 
 #ifndef HASHMAP_DENSEKEYS
@@ -156,6 +193,8 @@ int main(int argc, char** argv) {
 
 #ifdef HASHMAP_STRINGKEYS
   using KeyT = StringKey;
+#elif defined(HASHMAP_COMPOSITEKEYS)
+  using KeyT = Key128;
 #else
   using KeyT = uint64_t;
 #endif
@@ -176,22 +215,32 @@ int main(int argc, char** argv) {
 
 #if !defined(HASHMAP_HASHFUNCTIONS) && !defined(HASHMAP_DENSEKEYS)
 
-#ifdef HASHMAP_STRINGKEYS
+#if defined(HASHMAP_STRINGKEYS) || defined(HASHMAP_COMPOSITEKEYS)
   using DefaultHasher = hashmap::hashing::XXHasher<KeyT, false>;
 #else
   using DefaultHasher = hashing::MultShift64BHasher<KeyT, false>;
 #endif
 
 #else
+// String and composite keys only benchmark the hash functions that take arbitrary bytes
+#if !defined(HASHMAP_STRINGKEYS) && !defined(HASHMAP_COMPOSITEKEYS)
 #ifndef HASHMAP_DENSEKEYS
   using MultShift64ModuloHasher = hashmap::hashing::MultShift64BHasher<KeyT, true>;
+  using MultShift64FastRangeHasher = hashmap::hashing::MultShift64BHasher<KeyT, hashing::finalizer::FASTRANGE>;
+  using MurmurModuloHasher = hashmap::hashing::MurmurHasher<KeyT, true>;
+  using MurmurFastRangeHasher = hashmap::hashing::MurmurHasher<KeyT, hashing::finalizer::FASTRANGE>;
 #endif
 
   using MultShift128Hasher = hashmap::hashing::MultShift128BHasher<KeyT, false>;
   using MultAddShift64Hasher = hashmap::hashing::MultAddShift64BHasher<KeyT, false>;
   using MultAddShift128Hasher = hashmap::hashing::MultAddShift128BHasher<KeyT, false>;
   using MurmurHasher = hashmap::hashing::MurmurHasher<KeyT, false>;
+  using tabHasher = hashmap::hashing::TabulationHasher<KeyT, false>;
+  using twistedTabHasher = hashmap::hashing::TabulationHasher<KeyT, false, true>;
+#endif
   using xxHasher = hashmap::hashing::XXHasher<KeyT, false>;
+  using crcHasher = hashmap::hashing::CRC32Hasher<KeyT, false>;
+  using aesHasher = hashmap::hashing::AESHasher<KeyT, false>;
 
 #endif
 
@@ -209,6 +258,10 @@ int main(int argc, char** argv) {
   MetadataBenchmarkResultCollector meta_collector;
   void* meta_collector_ptr = static_cast<void*>(&meta_collector);
 #else
+#ifdef HASHMAP_HUGE_SCALE
+  uint64_t num_hashmaps = get_num_hashmaps_l();
+  spdlog::info("Huge scale benchmark.");
+#else
 #ifdef HASHMAP_LARGE_MATRIX
   uint64_t num_hashmaps = get_num_hashmaps_a();
   spdlog::info("Large matrix benchmark.");
@@ -222,12 +275,16 @@ int main(int argc, char** argv) {
 #ifdef HASHMAP_STRINGKEYS
   spdlog::info("Stringkey benchmark.");
   uint64_t num_hashmaps = get_num_hashmaps_f();
+#elif defined(HASHMAP_COMPOSITEKEYS)
+  spdlog::info("Composite key benchmark.");
+  uint64_t num_hashmaps = get_num_hashmaps_f();
 #else
 #ifdef HASHMAP_DENSEKEYS
   spdlog::info("Densekey benchmark.");
   uint64_t num_hashmaps = get_num_hashmaps_g();
 #else
-#if defined(HASHMAP_LARGEVALUES) || defined(HASHMAP_POINTERVALUES) || defined(HASHMAP_MT) || defined(HASHMAP_ZIPF)
+#if defined(HASHMAP_LARGEVALUES) || defined(HASHMAP_POINTERVALUES) || defined(HASHMAP_MT) || defined(HASHMAP_ZIPF) || \
+    defined(HASHMAP_SORTED_BATCH) || defined(HASHMAP_VERTICAL_PROBING)
   uint64_t num_hashmaps = get_num_hashmaps_h();
 #else
 #ifdef HASHMAP_PREFETCHING
@@ -252,6 +309,7 @@ int main(int argc, char** argv) {
   uint64_t num_hashmaps = get_num_hashmaps_c();
 #endif
 #endif
+#endif
 
 #endif
 #endif
@@ -265,7 +323,7 @@ int main(int argc, char** argv) {
 #endif
 
   uint64_t total_runs = thread_counts.size() * workloads.size() * hashtable_sizes.size() * data_distributions.size() * load_factors.size() *
-                        successful_query_rates.size() * runs_per_hashmap * num_hashmaps;
+                        successful_query_rates.size() * memory_budget_percentages.size() * zipf_factors.size() * runs_per_hashmap * num_hashmaps;
 
   bool is_generate_run = false;
 
@@ -285,20 +343,31 @@ int main(int argc, char** argv) {
       for (const auto& thread_count : thread_counts) {
         uint64_t thread_table_size = hashtable_size / static_cast<uint64_t>(thread_count);
         spdlog::info(fmt::format("Generating prefault data for hashtable size {} (thread table size = {})", hashtable_size, thread_table_size));
+#ifdef HASHMAP_HUGE_SCALE
+        // Pregenerated prefault data would double the memory footprint, hence the tables prefault themselves
+        std::vector<std::vector<std::pair<KeyT, ValueT>>> prefault_data(thread_count);
+#else
         std::vector<std::vector<std::pair<KeyT, ValueT>>> prefault_data = generate_prefault_data<KeyT, ValueT>(thread_table_size, thread_count);
+#endif
 
         for (const auto& data_distribution : data_distributions) {
           for (const auto& load_factor : load_factors) {
             for (const auto& sucessful_query_rate : successful_query_rates) {
-              if (is_generate_run) {
-                ASSERT(benchmark_data_dir.has_value(), "Need value for storage directory when doing generation run.");
-                benchmark::read::write_benchmark_data_to_file<KeyT, ValueT>(load_factor, hashtable_size, data_distribution,
-                                                                            benchmark_data_dir.value(), sucessful_query_rate, workload, thread_count,
-                                                                            zipf_requests, zipf_factor);
-              } else {
-                read::read_bench<KeyT, ValueT, BENCHMARK_HASHMAPS>(load_factor, sucessful_query_rate, hashtable_size, data_distribution, workload,
-                                                                   runs_per_hashmap, thread_count, &collector, store_intermediate_results, warmup_run,
-                                                                   prefault_data, zipf_requests, zipf_factor, benchmark_data_dir, meta_collector_ptr);
+              for (const auto& zipf_factor : zipf_factors) {
+                if (is_generate_run) {
+                  ASSERT(benchmark_data_dir.has_value(), "Need value for storage directory when doing generation run.");
+                  benchmark::read::write_benchmark_data_to_file<KeyT, ValueT>(load_factor, hashtable_size, data_distribution,
+                                                                              benchmark_data_dir.value(), sucessful_query_rate, workload,
+                                                                              thread_count, zipf_requests, zipf_factor);
+                } else {
+                  for (const auto& memory_budget_percentage : memory_budget_percentages) {
+                    const uint64_t memory_budget = hashtable_size * (sizeof(KeyT) + sizeof(ValueT)) * memory_budget_percentage / 100;
+                    read::read_bench<KeyT, ValueT, BENCHMARK_HASHMAPS>(load_factor, sucessful_query_rate, hashtable_size, data_distribution,
+                                                                       workload, runs_per_hashmap, thread_count, &collector,
+                                                                       store_intermediate_results, warmup_run, prefault_data, zipf_requests,
+                                                                       zipf_factor, benchmark_data_dir, meta_collector_ptr, memory_budget);
+                  }
+                }
               }
             }
           }
@@ -0,0 +1,297 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_utils.hpp"
+#include "benchmark/perf_monitor.hpp"
+#include "fmt/format.h"
+#include "hashmap/simd_utils.hpp"
+#include "hashmap/utils.hpp"
+#include "spdlog/spdlog.h"
+
+// Isolated microbenchmark of the SIMDHelper compare/movemask/iterator kernels. In the table benchmarks, the cost of these kernels is hidden
+// behind the memory latency of the table. Here, all vectors are L1-resident, such that we measure the kernel itself, per instantiation,
+// fingerprint width, SIMDAlgorithm, and match density.
+
+using namespace hashmap;
+using namespace benchmark;
+
+namespace {
+
+/** Size of the vector buffer. Half of a typical 32-48 KiB L1d cache, such that the buffer stays resident. */
+constexpr uint64_t l1_buffer_bytes = 16 * 1024;
+constexpr uint64_t compares_per_run = 8 * 1024 * 1024;
+constexpr uint8_t runs_per_kernel = 5;
+
+enum class MatchDensity { NONE, ONE, MANY };
+
+std::string density_to_str(MatchDensity density) {
+  switch (density) {
+    case MatchDensity::NONE:
+      return "none";
+    case MatchDensity::ONE:
+      return "one";
+    case MatchDensity::MANY:
+      return "many";
+    default:
+      FAIL("Unknown match density.");
+  }
+}
+
+std::string simd_algo_to_str(SIMDAlgorithm simd_algo) {
+  switch (simd_algo) {
+    case SIMDAlgorithm::TESTZ:
+      return "TESTZ";
+    case SIMDAlgorithm::NO_TESTZ:
+      return "NO_TESTZ";
+    case SIMDAlgorithm::MANUAL_ON_MATCH:
+      return "MANUAL_ON_MATCH";
+    default:
+      FAIL("Unknown SIMD algorithm.");
+  }
+}
+
+std::string neon_algo_to_str(NEONAlgo neon_algo) {
+  switch (neon_algo) {
+    case NEONAlgo::SSE2NEON:
+      return "SSE2NEON";
+    case NEONAlgo::AARCH64:
+      return "AARCH64";
+    case NEONAlgo::UMINV:
+      return "UMINV";
+    default:
+      FAIL("Unknown NEON algorithm.");
+  }
+}
+
+struct SIMDBenchmarkResult {
+  std::string helper_identifier = "";
+  std::string key_type = "";
+  uint16_t simd_size = 0;
+  std::string simd_algo = "";
+  std::string density = "";
+  uint64_t compares = 0;
+  double ns_per_compare = 0;  // minimum over all runs
+  PhaseCounters counters;     // of the fastest run
+  uint64_t checksum = 0;
+};
+
+template <typename KeyT, uint16_t simd_size, SIMDAlgorithm simd_algo, bool use_avx512_features, bool use_sve, NEONAlgo neon_algo>
+SIMDBenchmarkResult simd_bench_impl(MatchDensity density) {
+  using SIMDH = SIMDHelper<KeyT, simd_size, simd_algo, use_avx512_features, false, use_sve, neon_algo, false>;
+  using vector_type = typename SIMDH::vector_type;
+  using MaskOrVectorInputType = typename SIMDH::MaskOrVectorInputType;
+  using LoadPtrT = typename SIMDH::LoadPtrT;
+  using CompareT = typename SIMDH::CompareT;
+  using CompareResultIterator = typename SIMDH::CompareResultIterator;
+  using MaskIteratorT = typename CompareResultIterator::MaskIteratorT;
+
+  constexpr uint64_t elements_per_vector = (simd_size / 8) / sizeof(KeyT);
+  constexpr uint64_t num_vectors = l1_buffer_bytes / (simd_size / 8);
+  constexpr uint64_t passes = compares_per_run / num_vectors;
+  const KeyT needle = 42;
+
+  // 1. Generate the vectors with the requested number of matches per vector, and the checksum a correct kernel has to produce
+  std::vector<KeyT, utils::AlignedAllocator<KeyT, SIMDH::_vector_alignment()>> keys(num_vectors * elements_per_vector);
+  std::uniform_int_distribution<uint64_t> value_dist(0, std::numeric_limits<KeyT>::max());
+  std::uniform_int_distribution<uint64_t> lane_dist(0, elements_per_vector - 1);
+  for (KeyT& key : keys) {
+    do {
+      key = static_cast<KeyT>(value_dist(reproducible_gen()));
+    } while (key == needle);
+  }
+
+  uint64_t expected_checksum = 0;
+  for (uint64_t vector = 0; vector < num_vectors; ++vector) {
+    if (density == MatchDensity::ONE) {
+      const uint64_t lane = lane_dist(reproducible_gen());
+      keys[vector * elements_per_vector + lane] = needle;
+      expected_checksum += lane;
+    } else if (density == MatchDensity::MANY) {
+      // Every other lane matches, i.e., the iterator has to visit half of the lanes
+      for (uint64_t lane = vector % 2; lane < elements_per_vector; lane += 2) {
+        keys[vector * elements_per_vector + lane] = needle;
+        expected_checksum += lane;
+      }
+    }
+  }
+
+  vector_type index_vector;
+#if defined(__ARM_FEATURE_SVE)
+  if constexpr (use_sve) {
+    index_vector = SIMDH::index_creation_func_();
+  }
+#else
+  (void)index_vector;
+#endif
+
+  SIMDBenchmarkResult result;
+  result.key_type = utils::data_type_to_str<KeyT>();
+  result.simd_size = simd_size;
+  result.simd_algo = simd_algo_to_str(simd_algo);
+  result.density = density_to_str(density);
+  result.compares = passes * num_vectors;
+  result.ns_per_compare = std::numeric_limits<double>::max();
+  result.helper_identifier = fmt::format("SIMDHelper<{},{},{},{},{},{}>", result.key_type, simd_size, result.simd_algo,
+                                         use_avx512_features ? "AVX512" : "NoAVX512", use_sve ? "SVE" : "NoSVE", neon_algo_to_str(neon_algo));
+
+  PhaseCounterGroup counters;
+  for (uint8_t run = 0; run < runs_per_kernel; ++run) {
+    uint64_t checksum = 0;
+    ClobberMemory();
+    counters.start();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint64_t pass = 0; pass < passes; ++pass) {
+      const CompareT compare_vector = SIMDH::vector_broadcast_func_(needle);
+      for (uint64_t vector = 0; vector < num_vectors; ++vector) {
+        KeyT* vector_start = &keys[vector * elements_per_vector];
+        const vector_type data = SIMDH::vector_load_func_(reinterpret_cast<LoadPtrT>(vector_start));
+
+        MaskOrVectorInputType cmp_result;
+        if constexpr (utils::is_power) {
+          cmp_result = SIMDH::vector_cmp_func_(data, compare_vector, false);
+        } else {
+          cmp_result = SIMDH::vector_cmp_func_(data, compare_vector);
+        }
+
+        if constexpr (simd_algo == SIMDAlgorithm::TESTZ) {
+          if (SIMDH::vector_any_nonzero(cmp_result)) {
+            MaskIteratorT iterator = CompareResultIterator::initialize(cmp_result);
+            do {
+              uint16_t next_match = 0;
+              if constexpr (use_sve) {
+                next_match = CompareResultIterator::sve_next_match(iterator, index_vector);
+              } else {
+                next_match = CompareResultIterator::next_match(iterator);
+              }
+              iterator = CompareResultIterator::next_it(iterator, next_match);
+              checksum += next_match;
+            } while (CompareResultIterator::has_next(iterator));
+          }
+        } else if constexpr (simd_algo == SIMDAlgorithm::NO_TESTZ) {
+          MaskIteratorT iterator = CompareResultIterator::initialize(cmp_result);
+          while (CompareResultIterator::has_next(iterator)) {
+            uint16_t next_match = 0;
+            if constexpr (use_sve) {
+              next_match = CompareResultIterator::sve_next_match(iterator, index_vector);
+            } else {
+              next_match = CompareResultIterator::next_match(iterator);
+            }
+            iterator = CompareResultIterator::next_it(iterator, next_match);
+            checksum += next_match;
+          }
+        } else {
+          // As in the SIMD SoA tables: the vector only tells whether there is a match, the matches are then searched in memory
+          if (SIMDH::vector_any_nonzero(cmp_result)) {
+            for (uint16_t lane = 0; lane < elements_per_vector; ++lane) {
+              checksum += (vector_start[lane] == needle) ? lane : 0;
+            }
+          }
+        }
+      }
+      doNotOptimize(checksum);
+    }
+
+    ClobberMemory();
+    auto end = std::chrono::high_resolution_clock::now();
+    const PhaseCounters run_counters = counters.stop();
+
+    ASSERT(checksum == expected_checksum * passes,
+           fmt::format("{} computed wrong matches for density {} ({} vs {})", result.helper_identifier, result.density, checksum,
+                       expected_checksum * passes));
+
+    const double ns_per_compare =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / static_cast<double>(result.compares);
+    if (ns_per_compare < result.ns_per_compare) {
+      result.ns_per_compare = ns_per_compare;
+      result.counters = run_counters;
+      result.checksum = checksum;
+    }
+  }
+
+  return result;
+}
+
+template <typename KeyT, uint16_t simd_size, SIMDAlgorithm simd_algo, bool use_avx512_features, bool use_sve, NEONAlgo neon_algo>
+void run_densities(std::vector<SIMDBenchmarkResult>* results) {
+  fail_if_system_is_incompatible<KeyT, simd_size, simd_algo, use_avx512_features, use_sve, neon_algo, false>();
+  for (const MatchDensity density : {MatchDensity::NONE, MatchDensity::ONE, MatchDensity::MANY}) {
+    results->push_back(simd_bench_impl<KeyT, simd_size, simd_algo, use_avx512_features, use_sve, neon_algo>(density));
+    const SIMDBenchmarkResult& result = results->back();
+    spdlog::info(fmt::format("{} ({} matches): {:.3f} ns/compare, {:.2f} cycles/compare", result.helper_identifier, result.density,
+                             result.ns_per_compare, PhaseCounters::per_operation(result.counters.cycles, result.compares)));
+  }
+}
+
+template <typename KeyT, uint16_t simd_size, bool use_avx512_features, bool use_sve, NEONAlgo neon_algo>
+void run_algorithms(std::vector<SIMDBenchmarkResult>* results) {
+  run_densities<KeyT, simd_size, SIMDAlgorithm::TESTZ, use_avx512_features, use_sve, neon_algo>(results);
+  run_densities<KeyT, simd_size, SIMDAlgorithm::NO_TESTZ, use_avx512_features, use_sve, neon_algo>(results);
+  run_densities<KeyT, simd_size, SIMDAlgorithm::MANUAL_ON_MATCH, use_avx512_features, use_sve, neon_algo>(results);
+}
+
+template <typename KeyT>
+void run_helpers(std::vector<SIMDBenchmarkResult>* results) {
+#if defined(HASHMAP_IS_X86) && !defined(HASHMAP_USE_SCALAR_IMPL)
+  run_algorithms<KeyT, 128, false, false, NEONAlgo::SSE2NEON>(results);
+#ifdef __AVX2__
+  run_algorithms<KeyT, 256, false, false, NEONAlgo::SSE2NEON>(results);
+#endif
+#ifdef __AVX512F__
+  run_algorithms<KeyT, 128, true, false, NEONAlgo::SSE2NEON>(results);
+  run_algorithms<KeyT, 256, true, false, NEONAlgo::SSE2NEON>(results);
+  run_algorithms<KeyT, 512, true, false, NEONAlgo::SSE2NEON>(results);
+#endif
+#elif defined(HASHMAP_IS_ARM) && !defined(HASHMAP_USE_SCALAR_IMPL)
+  run_algorithms<KeyT, 128, false, false, NEONAlgo::SSE2NEON>(results);
+  run_algorithms<KeyT, 128, false, false, NEONAlgo::AARCH64>(results);
+  run_algorithms<KeyT, 128, false, false, NEONAlgo::UMINV>(results);
+#if defined(SVE_REGISTER_SIZE) && defined(__ARM_FEATURE_SVE)
+  run_algorithms<KeyT, utils::sve_register_size, false, true, NEONAlgo::SSE2NEON>(results);
+#endif
+#else
+  // Power and the scalar implementation only support 128 bit
+  run_algorithms<KeyT, 128, false, false, NEONAlgo::SSE2NEON>(results);
+#endif
+}
+
+void to_csv(const std::vector<SIMDBenchmarkResult>& results, const std::string& path) {
+  ASSERT(!std::filesystem::exists(path), "File to write to already exists!");
+  std::ofstream result_file;
+  result_file.open(path);
+  result_file << "Helper,Compiler,SystemHostname,KeyType,SIMDSize,SIMDAlgorithm,MatchDensity,Compares,NsPerCompare,CyclesPerCompare,"
+                 "InstructionsPerCompare,BranchMissesPerCompare,Checksum"
+              << std::endl;
+
+  for (const SIMDBenchmarkResult& result : results) {
+    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{}", result.helper_identifier, get_compiler_identifier(), get_hostname(),
+                               result.key_type, result.simd_size, result.simd_algo, result.density, result.compares, result.ns_per_compare,
+                               PhaseCounters::per_operation(result.counters.cycles, result.compares),
+                               PhaseCounters::per_operation(result.counters.instructions, result.compares),
+                               PhaseCounters::per_operation(result.counters.branch_misses, result.compares), result.checksum)
+                << std::endl;
+  }
+
+  result_file.close();
+}
+
+}  // namespace
+
+int main() {
+  std::vector<SIMDBenchmarkResult> results;
+
+  run_helpers<uint8_t>(&results);
+  run_helpers<uint16_t>(&results);
+  run_helpers<uint32_t>(&results);
+  run_helpers<uint64_t>(&results);
+
+  to_csv(results, fmt::format("finalsimdresult_{}.csv", timeSinceEpochMillisec()));
+
+  return 0;
+}
@@ -4,6 +4,10 @@
 #include <random>
 #include <tuple>
 
+#ifdef HASHMAP_HUGE_SCALE
+#include "benchmark/benchmark_hashmaps_l.hpp"
+#define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_L
+#else
 #ifdef HASHMAP_LARGE_MATRIX
 #include "benchmark/benchmark_hashmaps_a.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_A
@@ -13,7 +17,7 @@
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_D
 #else
 
-#ifdef HASHMAP_STRINGKEYS
+#if defined(HASHMAP_STRINGKEYS) || defined(HASHMAP_COMPOSITEKEYS)
 #include "benchmark/benchmark_hashmaps_f.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_F
 #else
@@ -47,6 +51,7 @@
 #include "benchmark/benchmark_hashmaps_c.hpp"
 #define BENCHMARK_HASHMAPS BENCHMARK_HASHMAPS_C
 #endif
+#endif
 
 #endif
 #endif
@@ -63,21 +68,33 @@
 #include "benchmark/write_benchmark.hpp"
 #include "fmt/format.h"
 #include "gcem.hpp"
+#include "hashmap/hashes/aeshasher.hpp"
+#include "hashmap/hashes/crc32hasher.hpp"
 #include "hashmap/hashes/multaddshifthasher.hpp"
 #include "hashmap/hashes/multshifthasher.hpp"
 #include "hashmap/hashes/murmurhasher.hpp"
 #include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/tabulationhasher.hpp"
 #include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/arena_value.hpp"
+#include "hashmap/hashmaps/bloom_filtered.hpp"
+#include "hashmap/hashmaps/bucket_chained_simd.hpp"
 #include "hashmap/hashmaps/bucketing_simd.hpp"
 #include "hashmap/hashmaps/chained.hpp"
 #include "hashmap/hashmaps/fingerprinting_simd_soa.hpp"
+#include "hashmap/hashmaps/growing_chained.hpp"
+#include "hashmap/hashmaps/hot_key_cached.hpp"
 #include "hashmap/hashmaps/linear_probing_aos.hpp"
 #include "hashmap/hashmaps/linear_probing_soa.hpp"
 #include "hashmap/hashmaps/linear_probing_soa_packed.hpp"
+#include "hashmap/hashmaps/perfect_hashing.hpp"
 #include "hashmap/hashmaps/quadratic_probing_aos.hpp"
+#include "hashmap/hashmaps/quotient_bucketing_simd.hpp"
 #include "hashmap/hashmaps/recalc_robin_hood_aos.hpp"
 #include "hashmap/hashmaps/simple_simd_soa.hpp"
+#include "hashmap/hashmaps/sorted_batch.hpp"
 #include "hashmap/hashmaps/storing_robin_hood_aos.hpp"
+#include "hashmap/hashmaps/vertical_linear_probing_soa.hpp"
 #include "hashmap/utils.hpp"
 #include "spdlog/spdlog.h"
 
@@ -103,6 +120,11 @@ int main(int argc, char** argv) {
   std::vector<uint64_t> hashtable_sizes{gcem::pow<uint64_t, uint64_t>(2, 27)};
   std::vector<uint8_t> thread_counts = parse_thread_counts(argc, argv);
 
+#ifdef HASHMAP_HUGE_SCALE
+  // 2^36 slots exceed 2^32 buckets for both 8 and 16 fingerprints per bucket, i.e., only tables with 64-bit bucket indices can address them
+  hashtable_sizes = {gcem::pow<uint64_t, uint64_t>(2, 33), gcem::pow<uint64_t, uint64_t>(2, 36)};
+#endif
+
 #ifdef HASHMAP_REPR
   if (thread_counts.size() > 1) {
     load_factors = {90};
@@ -121,6 +143,8 @@ int main(int argc, char** argv) {
 
 #ifdef HASHMAP_STRINGKEYS
   using KeyT = StringKey;
+#elif defined(HASHMAP_COMPOSITEKEYS)
+  using KeyT = Key128;
 #else
   using KeyT = uint64_t;
 #endif
@@ -141,22 +165,32 @@ int main(int argc, char** argv) {
 
 #if !defined(HASHMAP_HASHFUNCTIONS) && !defined(HASHMAP_DENSEKEYS)
 
-#ifdef HASHMAP_STRINGKEYS
+#if defined(HASHMAP_STRINGKEYS) || defined(HASHMAP_COMPOSITEKEYS)
   using DefaultHasher = hashmap::hashing::XXHasher<KeyT, false>;
 #else
   using DefaultHasher = hashing::MultShift64BHasher<KeyT, false>;
 #endif
 
 #else
+// String and composite keys only benchmark the hash functions that take arbitrary bytes
+#if !defined(HASHMAP_STRINGKEYS) && !defined(HASHMAP_COMPOSITEKEYS)
 #ifndef HASHMAP_DENSEKEYS
   using MultShift64ModuloHasher = hashmap::hashing::MultShift64BHasher<KeyT, true>;
+  using MultShift64FastRangeHasher = hashmap::hashing::MultShift64BHasher<KeyT, hashing::finalizer::FASTRANGE>;
+  using MurmurModuloHasher = hashmap::hashing::MurmurHasher<KeyT, true>;
+  using MurmurFastRangeHasher = hashmap::hashing::MurmurHasher<KeyT, hashing::finalizer::FASTRANGE>;
 #endif
 
   using MultShift128Hasher = hashmap::hashing::MultShift128BHasher<KeyT, false>;
   using MultAddShift64Hasher = hashmap::hashing::MultAddShift64BHasher<KeyT, false>;
   using MultAddShift128Hasher = hashmap::hashing::MultAddShift128BHasher<KeyT, false>;
   using MurmurHasher = hashmap::hashing::MurmurHasher<KeyT, false>;
+  using tabHasher = hashmap::hashing::TabulationHasher<KeyT, false>;
+  using twistedTabHasher = hashmap::hashing::TabulationHasher<KeyT, false, true>;
+#endif
   using xxHasher = hashmap::hashing::XXHasher<KeyT, false>;
+  using crcHasher = hashmap::hashing::CRC32Hasher<KeyT, false>;
+  using aesHasher = hashmap::hashing::AESHasher<KeyT, false>;
 
 #endif
 
@@ -168,6 +202,10 @@ int main(int argc, char** argv) {
   using MultShift64Hasher = hashmap::hashing::MultShift64BHasher<KeyT, false>;
 #endif
 
+#ifdef HASHMAP_HUGE_SCALE
+  uint64_t num_hashmaps = get_num_hashmaps_l();
+  spdlog::info("Huge scale benchmark.");
+#else
 #ifdef HASHMAP_LARGE_MATRIX
   uint64_t num_hashmaps = get_num_hashmaps_a();
   spdlog::info("Large matrix benchmark.");
@@ -180,6 +218,9 @@ int main(int argc, char** argv) {
 #ifdef HASHMAP_STRINGKEYS
   uint64_t num_hashmaps = get_num_hashmaps_f();
   spdlog::info("Stringkey benchmark.");
+#elif defined(HASHMAP_COMPOSITEKEYS)
+  uint64_t num_hashmaps = get_num_hashmaps_f();
+  spdlog::info("Composite key benchmark.");
 #else
 #ifdef HASHMAP_DENSEKEYS
   uint64_t num_hashmaps = get_num_hashmaps_g();
@@ -214,6 +255,7 @@ int main(int argc, char** argv) {
 #endif
 #endif
 #endif
+#endif
 
 #endif
 #endif
@@ -239,7 +281,12 @@ int main(int argc, char** argv) {
       spdlog::info(fmt::format("Generating prefault data for hashtable size {}", hashtable_size));
       uint64_t thread_table_size = hashtable_size / static_cast<uint64_t>(thread_count);
       spdlog::info(fmt::format("Generating prefault data for hashtable size {} (thread table size = {})", hashtable_size, thread_table_size));
+#ifdef HASHMAP_HUGE_SCALE
+      // Pregenerated prefault data would double the memory footprint, hence the tables prefault themselves
+      std::vector<std::vector<std::pair<KeyT, ValueT>>> prefault_data(thread_count);
+#else
       std::vector<std::vector<std::pair<KeyT, ValueT>>> prefault_data = generate_prefault_data<KeyT, ValueT>(thread_table_size, thread_count);
+#endif
 
       for (const auto& data_distribution : data_distributions) {
         for (const auto& load_factor : load_factors) {
@@ -131,17 +131,18 @@ void MetadataBenchmarkResultCollector::to_csv(std::filesystem::path path) {
       << "Timestamp,Hashmap,Compiler,SystemHostname,PageSize,HugePageSize,DataPointer,IsAlignedToHPSize,LoadFactor,SQR,Size,Distribution,Workload,"
          "KeySize,ValueSize,"
          "EntrySize,EntriesProcessed,NumFinds,ProbedElements,TotalProbedElements,SIMDLoads,NumCollisions,NumOverflowsFollowed,NumOverflows,"
-         "NumBuckets,MinProbingSequence,MaxProbingSequence"
+         "NumOverflowHits,NumFilterChecks,NumFilterRejections,NumBuckets,MinProbingSequence,MaxProbingSequence"
       << std::endl;
 
   for (const MetadataBenchmarkResult& result : benchmark_results_) {
-    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}",
+    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}",
                                benchmark::timeSinceEpochMillisec(), result.hashmap_identifier, get_compiler_identifier(), get_hostname(),
                                hashmap::utils::page_size, hashmap::utils::hugepage_size, result.data_ptr, result.is_aligned_to_hp, result.load_factor,
                                result.successful_query_rate, result.hashtable_size, result.distribution_name, result.workload, result.key_size,
                                result.value_size, result.entry_size, result.entries_processed, result.minfo.num_finds, result.minfo.probed_elements,
                                result.minfo.probed_elements_total, result.minfo.simd_loads, result.minfo.num_collision,
-                               result.minfo.num_overflows_followed, result.minfo.num_overflows, result.minfo.num_buckets,
+                               result.minfo.num_overflows_followed, result.minfo.num_overflows, result.minfo.num_overflow_hits,
+                               result.minfo.num_filter_checks, result.minfo.num_filter_rejections, result.minfo.num_buckets,
                                result.minfo.min_probing_sequence, result.minfo.max_probing_sequence)
                 << std::endl;
   }
@@ -0,0 +1,260 @@
+#include "benchmark/compare_benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <tuple>
+
+#include "benchmark/benchmark_utils.hpp"
+#include "fmt/format.h"
+#include "hashmap/utils.hpp"
+#include "spdlog/spdlog.h"
+
+namespace benchmark::compare {
+
+namespace {
+
+std::vector<std::string> split_csv_line(const std::string& line) {
+  std::vector<std::string> fields;
+  std::stringstream stream(line);
+  std::string field;
+  while (std::getline(stream, field, ',')) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+double median_ratio(const std::vector<double>& baseline, const std::vector<double>& candidate) { return median(candidate) / median(baseline); }
+
+/** Absolute difference of the medians of the values of pooled that mask assigns to the baseline group (mask[i] == true) and the others. */
+double split_statistic(const std::vector<double>& pooled, const std::vector<bool>& mask) {
+  std::vector<double> first;
+  std::vector<double> second;
+  for (uint64_t i = 0; i < pooled.size(); ++i) {
+    (mask[i] ? first : second).push_back(pooled[i]);
+  }
+  return std::abs(median(first) - median(second));
+}
+
+double binomial_coefficient(uint64_t n, uint64_t k) {
+  double result = 1;
+  for (uint64_t i = 1; i <= k; ++i) {
+    result = result * static_cast<double>(n - k + i) / static_cast<double>(i);
+  }
+  return result;
+}
+
+bool uses_exact_test(uint64_t baseline_runs, uint64_t candidate_runs, const ComparisonOptions& options) {
+  return binomial_coefficient(baseline_runs + candidate_runs, baseline_runs) <= static_cast<double>(options.max_exact_permutations);
+}
+
+double permutation_test(const std::vector<double>& baseline, const std::vector<double>& candidate, const ComparisonOptions& options,
+                        std::mt19937& gen) {
+  std::vector<double> pooled = baseline;
+  pooled.insert(pooled.end(), candidate.begin(), candidate.end());
+
+  // mask[i] == true means pooled[i] is assigned to the baseline group
+  std::vector<bool> mask(pooled.size(), false);
+  std::fill(mask.begin(), mask.begin() + static_cast<int64_t>(baseline.size()), true);
+  const double observed = split_statistic(pooled, mask);
+  // Guards against floating point noise when comparing the statistic of permutations to the observed one
+  const double tolerance = 1e-9 * std::max(1.0, observed);
+
+  if (uses_exact_test(baseline.size(), candidate.size(), options)) {
+    // Exact test: enumerate all assignments. std::prev_permutation starts at the lexicographically largest mask (all trues first).
+    uint64_t total = 0;
+    uint64_t extreme = 0;
+    do {
+      ++total;
+      extreme += split_statistic(pooled, mask) >= observed - tolerance ? 1 : 0;
+    } while (std::prev_permutation(mask.begin(), mask.end()));
+    return static_cast<double>(extreme) / static_cast<double>(total);
+  }
+
+  uint64_t extreme = 0;
+  for (uint64_t i = 0; i < options.sampled_permutations; ++i) {
+    std::shuffle(mask.begin(), mask.end(), gen);
+    extreme += split_statistic(pooled, mask) >= observed - tolerance ? 1 : 0;
+  }
+  return static_cast<double>(extreme + 1) / static_cast<double>(options.sampled_permutations + 1);
+}
+
+std::pair<double, double> bootstrap_ratio_ci(const std::vector<double>& baseline, const std::vector<double>& candidate,
+                                             const ComparisonOptions& options, std::mt19937& gen) {
+  std::uniform_int_distribution<uint64_t> baseline_dist(0, baseline.size() - 1);
+  std::uniform_int_distribution<uint64_t> candidate_dist(0, candidate.size() - 1);
+  std::vector<double> baseline_resample(baseline.size());
+  std::vector<double> candidate_resample(candidate.size());
+
+  std::vector<double> ratios;
+  ratios.reserve(options.bootstrap_resamples);
+  for (uint64_t i = 0; i < options.bootstrap_resamples; ++i) {
+    std::generate(baseline_resample.begin(), baseline_resample.end(), [&]() { return baseline[baseline_dist(gen)]; });
+    std::generate(candidate_resample.begin(), candidate_resample.end(), [&]() { return candidate[candidate_dist(gen)]; });
+    ratios.push_back(median_ratio(baseline_resample, candidate_resample));
+  }
+
+  std::sort(ratios.begin(), ratios.end());
+  const auto quantile = [&](double q) {
+    const double position = q * static_cast<double>(ratios.size() - 1);
+    return ratios[static_cast<uint64_t>(std::llround(position))];
+  };
+  return {quantile(options.alpha / 2), quantile(1 - options.alpha / 2)};
+}
+
+}  // namespace
+
+RuntimeSamples read_result_csv(const std::filesystem::path& path) {
+  std::ifstream file(path);
+  ASSERT(file.is_open(), fmt::format("Could not open result file {}", path.string()));
+
+  std::string line;
+  ASSERT(static_cast<bool>(std::getline(file, line)), fmt::format("Result file {} is empty", path.string()));
+  const std::vector<std::string> header = split_csv_line(line);
+
+  const auto column = [&](const std::string& name) -> int64_t {
+    const auto it = std::find(header.begin(), header.end(), name);
+    return it == header.end() ? -1 : std::distance(header.begin(), it);
+  };
+
+  const int64_t hashmap_col = column("Hashmap");
+  const int64_t load_factor_col = column("LoadFactor");
+  const int64_t thread_count_col = column("ThreadCount");
+  const int64_t size_col = column("Size");
+  const int64_t distribution_col = column("Distribution");
+  // only in read results
+  const int64_t sqr_col = column("SQR");
+  const int64_t workload_col = column("Workload");
+  const int64_t zipf_factor_col = column("ZipfFactor");
+  const int64_t memory_budget_col = column("MemoryBudget");
+  const int64_t batch_size_col = column("BatchSize");
+  const int64_t runtime_col = column("Runtime");
+  const int64_t successful_col = column("Successful");
+  ASSERT(hashmap_col >= 0 && load_factor_col >= 0 && thread_count_col >= 0 && runtime_col >= 0 && successful_col >= 0,
+         fmt::format("{} is not a read or write benchmark result file", path.string()));
+
+  RuntimeSamples samples;
+  uint64_t skipped = 0;
+  while (std::getline(file, line)) {
+    const std::vector<std::string> fields = split_csv_line(line);
+    if (fields.size() < header.size()) {
+      continue;
+    }
+
+    if (fields[successful_col] != "true" && fields[successful_col] != "1") {
+      ++skipped;
+      continue;
+    }
+
+    const auto field = [&](int64_t col) { return col >= 0 ? fields[col] : std::string(); };
+    const ConfigurationKey key{fields[hashmap_col], fields[load_factor_col], field(sqr_col), fields[thread_count_col], field(size_col),
+                               field(distribution_col), field(workload_col), field(zipf_factor_col), field(memory_budget_col),
+                               field(batch_size_col)};
+    samples[key].push_back(std::stod(fields[runtime_col]));
+  }
+
+  if (skipped > 0) {
+    spdlog::warn(fmt::format("Skipped {} unsuccessful runs in {}", skipped, path.string()));
+  }
+  return samples;
+}
+
+std::string configuration_details(const ConfigurationKey& configuration) {
+  std::string details;
+  const auto append = [&](const std::string& name, const std::string& value) {
+    if (!value.empty()) {
+      details += fmt::format("{}{}={}", details.empty() ? "" : " ", name, value);
+    }
+  };
+  append("Size", configuration.hashtable_size);
+  append("Distribution", configuration.distribution);
+  append("Workload", configuration.workload);
+  append("ZipfFactor", configuration.zipf_factor);
+  append("MemoryBudget", configuration.memory_budget);
+  append("BatchSize", configuration.batch_size);
+  return details;
+}
+
+std::string verdict_to_str(Verdict verdict) {
+  switch (verdict) {
+    case Verdict::WIN:
+      return "WIN";
+    case Verdict::REGRESSION:
+      return "REGRESSION";
+    case Verdict::UNCHANGED:
+      return "unchanged";
+    case Verdict::INSUFFICIENT_DATA:
+      return "insufficient data";
+    default:
+      FAIL("Unknown verdict.");
+  }
+}
+
+double median(std::vector<double> values) {
+  ASSERT(!values.empty(), "Cannot compute the median of no values.");
+  const uint64_t middle = values.size() / 2;
+  std::nth_element(values.begin(), values.begin() + static_cast<int64_t>(middle), values.end());
+  if (values.size() % 2 == 1) {
+    return values[middle];
+  }
+  const double upper = values[middle];
+  const double lower = *std::max_element(values.begin(), values.begin() + static_cast<int64_t>(middle));
+  return (lower + upper) / 2;
+}
+
+double min_p_value(uint64_t baseline_runs, uint64_t candidate_runs, const ComparisonOptions& options) {
+  if (!uses_exact_test(baseline_runs, candidate_runs, options)) {
+    return 1.0 / static_cast<double>(options.sampled_permutations + 1);
+  }
+  // The observed split is among the extreme ones. For groups of equal size, so is its mirror image, which has the same statistic.
+  const double extreme = baseline_runs == candidate_runs ? 2 : 1;
+  return extreme / binomial_coefficient(baseline_runs + candidate_runs, baseline_runs);
+}
+
+std::vector<ComparisonResult> compare(const RuntimeSamples& baseline, const RuntimeSamples& candidate, const ComparisonOptions& options) {
+  std::mt19937 gen = CustomSeededEngine(options.seed);
+  std::vector<ComparisonResult> results;
+
+  for (const auto& [configuration, baseline_runtimes] : baseline) {
+    const auto candidate_it = candidate.find(configuration);
+    if (candidate_it == candidate.end()) {
+      continue;
+    }
+    const std::vector<double>& candidate_runtimes = candidate_it->second;
+
+    ComparisonResult result;
+    result.configuration = configuration;
+    result.baseline_runs = baseline_runtimes.size();
+    result.candidate_runs = candidate_runtimes.size();
+    result.baseline_median = median(baseline_runtimes);
+    result.candidate_median = median(candidate_runtimes);
+    result.ratio = result.candidate_median / result.baseline_median;
+
+    // With a single run per side, neither resampling nor permuting tells us anything. With too few runs overall, the permutation test cannot
+    // reject at alpha, however large the difference, e.g., 3 runs per side give at least p = 0.1.
+    result.min_p_value = min_p_value(result.baseline_runs, result.candidate_runs, options);
+    if (result.baseline_runs < 2 || result.candidate_runs < 2 || result.baseline_median <= 0 || result.min_p_value >= options.alpha) {
+      results.push_back(result);
+      continue;
+    }
+
+    std::tie(result.ratio_ci_low, result.ratio_ci_high) = bootstrap_ratio_ci(baseline_runtimes, candidate_runtimes, options, gen);
+    result.p_value = permutation_test(baseline_runtimes, candidate_runtimes, options, gen);
+
+    const bool significant = result.p_value < options.alpha && (result.ratio_ci_low > 1 || result.ratio_ci_high < 1);
+    if (significant && result.ratio > 1 + options.threshold) {
+      result.verdict = Verdict::REGRESSION;
+    } else if (significant && result.ratio < 1 - options.threshold) {
+      result.verdict = Verdict::WIN;
+    } else {
+      result.verdict = Verdict::UNCHANGED;
+    }
+    results.push_back(result);
+  }
+
+  return results;
+}
+
+}  // namespace benchmark::compare
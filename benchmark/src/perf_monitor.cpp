@@ -6,6 +6,12 @@
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+
 #include "hashmap/utils.hpp"
 #include "spdlog/spdlog.h"
 
@@ -93,6 +99,8 @@ void PerfMonitor::start() {
     spdlog::error(fmt::format("Could not get resource usage: {}", std::strerror(errno)));
   }
 
+  topdown_.start();
+
   spdlog::info("Perf measurement started.");
 }
 
@@ -105,6 +113,7 @@ void PerfMonitor::stop() {
   for (const auto& fd : event_fds_) {
     ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
   }
+  topdown_.stop();
 
   spdlog::info("Perf measurement stopped.");
 }
@@ -267,6 +276,8 @@ PerfResult PerfMonitor::get_result() const {
     spdlog::error(fmt::format("Could not obtain `ld_st_dispatch` HW counter: {}", std::strerror(errno)));
   }
 
+  result.topdown = topdown_.get_result();
+
   return result;
 }
 
@@ -275,5 +286,430 @@ uint64_t PerfMonitor::rusage_timeval_diff(const timeval& end, const timeval& beg
   return ((end.tv_sec * 1'000'000) + end.tv_usec) - ((begin.tv_sec * 1'000'000) + begin.tv_usec);
 }
 
+// Order determines the member order of the group, the first event is the group leader
+static constexpr std::array<std::pair<uint32_t, uint64_t>, NUM_PHASE_COUNTERS> PHASE_COUNTER_EVENTS{
+    {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+     {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+     {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}}};
+
+PhaseCounterGroup::PhaseCounterGroup() : event_fds_{} {
+  event_fds_.fill(-1);
+
+  perf_event_attr pe;
+  std::memset(&pe, 0, sizeof(pe));
+  pe.size = sizeof(pe);
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+  pe.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  for (uint8_t i = 0; i < NUM_PHASE_COUNTERS; ++i) {
+    const bool is_leader = i == 0;
+    // Only the leader is disabled, the members follow the state of the leader
+    pe.disabled = is_leader ? 1 : 0;
+    pe.type = PHASE_COUNTER_EVENTS[i].first;
+    pe.config = PHASE_COUNTER_EVENTS[i].second;
+
+    // pid = 0 and cpu = -1 counts the calling thread on any CPU
+    event_fds_[i] = static_cast<int>(::syscall(__NR_perf_event_open, &pe, 0, -1, is_leader ? -1 : event_fds_[0], 0));
+    if (event_fds_[i] < 0) {
+      spdlog::warn(fmt::format("Could not open phase counter {} (type = {}, config = {}): {}", i, pe.type, pe.config, std::strerror(errno)));
+      if (is_leader) {
+        return;
+      }
+    }
+  }
+}
+
+PhaseCounterGroup::~PhaseCounterGroup() {
+  for (const int fd : event_fds_) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+}
+
+void PhaseCounterGroup::start() {
+  if (event_fds_[0] < 0) {
+    return;
+  }
+
+  ::ioctl(event_fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ::ioctl(event_fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PhaseCounters PhaseCounterGroup::stop() {
+  PhaseCounters result{};
+  if (event_fds_[0] < 0) {
+    return result;
+  }
+
+  ::ioctl(event_fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+  // Layout of PERF_FORMAT_GROUP with both time fields: nr, time_enabled, time_running, value[nr]
+  std::array<uint64_t, 3 + NUM_PHASE_COUNTERS> buffer{};
+  const ssize_t bytes_read = ::read(event_fds_[0], buffer.data(), sizeof(buffer));
+  if (bytes_read < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+    spdlog::error(fmt::format("Could not read phase counter group: {}", std::strerror(errno)));
+    return result;
+  }
+
+  const uint64_t time_enabled = buffer[1];
+  const uint64_t time_running = buffer[2];
+  if (time_running == 0) {
+    spdlog::warn("Phase counter group was never scheduled, returning no counts.");
+    return result;
+  }
+
+  // Multiplexing correction: extrapolate the counts to the time the group was enabled
+  const double scale = static_cast<double>(time_enabled) / static_cast<double>(time_running);
+  std::array<double*, NUM_PHASE_COUNTERS> targets{&result.cycles, &result.instructions, &result.llc_misses, &result.dtlb_misses,
+                                                  &result.branch_misses};
+
+  // Members that could not be opened are not part of the group, i.e., values only contains the opened ones
+  uint64_t value_idx = 3;
+  for (uint8_t i = 0; i < NUM_PHASE_COUNTERS && value_idx < 3 + buffer[0]; ++i) {
+    if (event_fds_[i] >= 0) {
+      *targets[i] = static_cast<double>(buffer[value_idx]) * scale;
+      ++value_idx;
+    }
+  }
+
+  return result;
+}
+
+namespace {
+
+const std::filesystem::path SYSFS_PMU_DIRECTORY = "/sys/bus/event_source/devices";
+
+std::optional<std::string> read_first_line(const std::filesystem::path& path) {
+  std::ifstream file(path);
+  std::string line;
+  if (!file.is_open() || !std::getline(file, line)) {
+    return std::nullopt;
+  }
+  return line;
+}
+
+/** Returns the core PMU directory. Hybrid Intel CPUs export the P-core PMU as cpu_core instead of cpu. */
+std::optional<std::filesystem::path> find_core_pmu() {
+  for (const char* name : {"cpu_core", "cpu"}) {
+    const std::filesystem::path pmu = SYSFS_PMU_DIRECTORY / name;
+    if (std::filesystem::exists(pmu / "type")) {
+      return pmu;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * Encodes a sysfs event description (e.g., "event=0xc2,umask=0x2") into perf_event_attr.config, using the bit ranges given in the PMU's format
+ * directory (e.g., format/event = "config:0-7,32-35"). Returns nullopt if a term is not supported.
+ */
+std::optional<uint64_t> encode_event(const std::filesystem::path& pmu, const std::string& description) {
+  uint64_t config = 0;
+  std::stringstream terms(description);
+  std::string term;
+  while (std::getline(terms, term, ',')) {
+    const size_t separator = term.find('=');
+    const std::string name = term.substr(0, separator);
+    uint64_t value = separator == std::string::npos ? 1 : std::stoull(term.substr(separator + 1), nullptr, 0);
+
+    const std::optional<std::string> format = read_first_line(pmu / "format" / name);
+    if (!format || format->rfind("config:", 0) != 0) {
+      return std::nullopt;  // unknown term or term in config1/config2
+    }
+
+    // The value's bits are distributed over the ranges from low to high
+    std::stringstream ranges(format->substr(7));
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+      const size_t dash = range.find('-');
+      const uint64_t low = std::stoull(range.substr(0, dash));
+      const uint64_t high = dash == std::string::npos ? low : std::stoull(range.substr(dash + 1));
+      const uint64_t width = high - low + 1;
+      const uint64_t mask = width == 64 ? ~0ULL : (1ULL << width) - 1;
+      config |= (value & mask) << low;
+      value = width == 64 ? 0 : value >> width;
+    }
+  }
+  return config;
+}
+
+struct SysfsEvent {
+  std::string name;
+  uint64_t config;
+  double scale;
+};
+
+/**
+ * Looks up the named events in the PMU's sysfs event list. Events that do not exist are skipped. Some events count in other units than their
+ * name suggests (e.g., topdown-total-slots counts cycles with a scale of the pipeline width), the factor is in events/<name>.scale if present.
+ */
+std::vector<SysfsEvent> discover_events(const std::filesystem::path& pmu, const std::vector<std::string>& names) {
+  std::vector<SysfsEvent> events;
+  for (const std::string& name : names) {
+    const std::optional<std::string> description = read_first_line(pmu / "events" / name);
+    if (!description) {
+      continue;
+    }
+    const std::optional<uint64_t> config = encode_event(pmu, *description);
+    if (config) {
+      const std::optional<std::string> scale = read_first_line(pmu / "events" / (name + ".scale"));
+      events.push_back({name, *config, scale ? std::stod(*scale) : 1.0});
+    }
+  }
+  return events;
+}
+
+struct CpuId {
+  std::string vendor;
+  uint32_t family = 0;
+  uint32_t model = 0;
+};
+
+/** Vendor, family and model of the first CPU in /proc/cpuinfo, which reports the family already combined with the extended family. */
+CpuId read_cpu_id() {
+  CpuId cpu_id;
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line) && !line.empty()) {
+    const size_t separator = line.find(':');
+    if (separator == std::string::npos || separator + 1 >= line.size()) {
+      continue;
+    }
+    // Keys are padded with tabs up to the separator, e.g., "model\t\t: 17" besides "model name\t: ..."
+    const std::string key = line.substr(0, line.find_last_not_of(" \t", separator - 1) + 1);
+    const std::string value = line.substr(separator + 2);
+    if (key == "vendor_id") {
+      cpu_id.vendor = value;
+    } else if (key == "cpu family") {
+      cpu_id.family = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+    } else if (key == "model") {
+      cpu_id.model = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+    }
+  }
+  return cpu_id;
+}
+
+using RawEventGroup = std::vector<std::pair<std::string, std::string>>;
+
+/** Raw pipeline utilization events of one AMD Zen generation, level 1 and level 2 in separate groups as Zen only has 6 core counters. */
+struct AmdPipelineEvents {
+  double slots_per_cycle;
+  RawEventGroup level1;
+  RawEventGroup level2;
+};
+
+/**
+ * The pipeline utilization events are only documented in the PPRs, and their encodings differ between generations (e.g., Zen 3 has no
+ * de_no_dispatch_per_slot). We therefore only return encodings we verified against the PPR of the family and model.
+ */
+std::optional<AmdPipelineEvents> amd_pipeline_events(const CpuId& cpu_id) {
+  // Zen 4: Raphael, Phoenix, Genoa, Bergamo, Siena (cf. AMD PPR for family 19h, models 11h and 61h, "Pipeline Utilization")
+  const bool is_zen4 = cpu_id.family == 0x19 && ((cpu_id.model >= 0x10 && cpu_id.model <= 0x1f) || (cpu_id.model >= 0x60 && cpu_id.model <= 0xaf));
+  if (!is_zen4) {
+    return std::nullopt;
+  }
+
+  return AmdPipelineEvents{6.0,
+                           {{"ls_not_halted_cyc", "event=0x76"},
+                            {"de_src_op_disp.all", "event=0xaa,umask=0x07"},
+                            {"ex_ret_ops", "event=0xc1"},
+                            {"de_no_dispatch_per_slot.no_ops_from_frontend", "event=0x1a0,umask=0x01"},
+                            {"de_no_dispatch_per_slot.backend_stalls", "event=0x1a0,umask=0x1e"}},
+                           {{"ls_not_halted_cyc.l2", "event=0x76"},
+                            {"de_no_dispatch_per_slot.no_ops_from_frontend.cmask", "event=0x1a0,umask=0x01,cmask=0x06"},
+                            {"ex_no_retire.not_complete", "event=0xd6,umask=0x02"},
+                            {"ex_no_retire.load_not_complete", "event=0xd6,umask=0xa2"}}};
+}
+
+}  // namespace
+
+TopdownMonitor::TopdownMonitor() {
+  const std::optional<std::filesystem::path> pmu = find_core_pmu();
+  if (!pmu) {
+    spdlog::warn("No core PMU found in sysfs, top-down metrics are unavailable.");
+    return;
+  }
+  const uint32_t pmu_type = static_cast<uint32_t>(std::stoul(read_first_line(*pmu / "type").value_or("4")));
+
+  auto to_group = [](const std::vector<SysfsEvent>& events) {
+    std::vector<Event> group;
+    for (const SysfsEvent& event : events) {
+      group.push_back({event.name, event.config, event.scale});
+    }
+    return group;
+  };
+
+  // Ice Lake and newer: the slots counter has to lead the group, all metrics are read through it
+  auto perf_metrics = discover_events(*pmu, {"slots", "topdown-retiring", "topdown-bad-spec", "topdown-fe-bound", "topdown-be-bound",
+                                             "topdown-heavy-ops", "topdown-br-mispredict", "topdown-fetch-lat", "topdown-mem-bound"});
+  if (perf_metrics.size() >= 5 && perf_metrics[0].name == "slots") {
+    method_ = "intel-perf-metrics";
+    open_group(pmu_type, to_group(perf_metrics));
+    return;
+  }
+
+  auto slot_counters = discover_events(*pmu, {"topdown-total-slots", "topdown-slots-issued", "topdown-slots-retired", "topdown-fetch-bubbles",
+                                              "topdown-recovery-bubbles"});
+  if (slot_counters.size() == 5) {
+    method_ = "intel-topdown-slots";
+    open_group(pmu_type, to_group(slot_counters));
+    return;
+  }
+
+  const CpuId cpu_id = read_cpu_id();
+  if (cpu_id.vendor == "AuthenticAMD") {
+    const std::optional<AmdPipelineEvents> amd_events = amd_pipeline_events(cpu_id);
+    if (!amd_events) {
+      spdlog::warn(fmt::format("No pipeline utilization events known for AMD family {:#x} model {:#x}, top-down metrics are unavailable.",
+                               cpu_id.family, cpu_id.model));
+      return;
+    }
+    amd_slots_per_cycle_ = amd_events->slots_per_cycle;
+
+    for (const RawEventGroup& level : {amd_events->level1, amd_events->level2}) {
+      std::vector<Event> group;
+      for (const auto& [name, description] : level) {
+        const std::optional<uint64_t> config = encode_event(*pmu, description);
+        if (config) {
+          group.push_back({name, *config, 1.0});
+        }
+      }
+      if (group.size() == level.size()) {
+        open_group(pmu_type, group);
+      }
+    }
+    method_ = groups_.empty() ? "unavailable" : "amd-pipeline-utilization";
+    return;
+  }
+
+  spdlog::warn(fmt::format("No top-down events found in {}, top-down metrics are unavailable.", pmu->string()));
+}
+
+void TopdownMonitor::open_group(uint32_t pmu_type, const std::vector<Event>& events) {
+  perf_event_attr pe;
+  std::memset(&pe, 0, sizeof(pe));
+  pe.size = sizeof(pe);
+  pe.type = pmu_type;
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+  pe.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  std::vector<std::pair<std::string, int>> group;
+  for (const Event& event : events) {
+    const bool is_leader = group.empty();
+    pe.disabled = is_leader ? 1 : 0;
+    pe.config = event.config;
+
+    const int fd = static_cast<int>(::syscall(__NR_perf_event_open, &pe, 0, -1, is_leader ? -1 : group[0].second, 0));
+    if (fd < 0) {
+      spdlog::warn(fmt::format("Could not open top-down event {} (config = {:#x}): {}", event.name, event.config, std::strerror(errno)));
+      if (is_leader) {
+        return;
+      }
+      continue;
+    }
+    group.emplace_back(event.name, fd);
+    event_scales_[event.name] = event.scale;
+  }
+  groups_.push_back(std::move(group));
+}
+
+TopdownMonitor::~TopdownMonitor() {
+  for (const auto& group : groups_) {
+    for (const auto& [name, fd] : group) {
+      ::close(fd);
+    }
+  }
+}
+
+void TopdownMonitor::start() {
+  for (const auto& group : groups_) {
+    ::ioctl(group[0].second, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(group[0].second, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+void TopdownMonitor::stop() {
+  counts_.clear();
+  for (const auto& group : groups_) {
+    ::ioctl(group[0].second, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // Layout of PERF_FORMAT_GROUP with both time fields: nr, time_enabled, time_running, value[nr]
+    std::vector<uint64_t> buffer(3 + group.size());
+    const ssize_t bytes_read = ::read(group[0].second, buffer.data(), buffer.size() * sizeof(uint64_t));
+    if (bytes_read != static_cast<ssize_t>(buffer.size() * sizeof(uint64_t)) || buffer[2] == 0) {
+      spdlog::error(fmt::format("Could not read top-down group led by {}: {}", group[0].first, std::strerror(errno)));
+      continue;
+    }
+
+    // Ratios within a group do not need the multiplexing correction, but the AMD levels are combined across groups. The sysfs scale converts
+    // each count into the unit that the ratios expect (e.g., cycles into slots), otherwise the topdown-slots metrics are off by that factor.
+    const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+    for (uint64_t i = 0; i < group.size(); ++i) {
+      counts_[group[i].first] = static_cast<double>(buffer[3 + i]) * scale * event_scales_.at(group[i].first);
+    }
+  }
+}
+
+TopdownResult TopdownMonitor::get_result() const {
+  TopdownResult result;
+  result.method = method_;
+  auto count = [&](const std::string& name) {
+    const auto it = counts_.find(name);
+    return it == counts_.end() ? std::numeric_limits<double>::quiet_NaN() : it->second;
+  };
+
+  if (method_ == "intel-perf-metrics") {
+    // The kernel reports the metrics as slot counts, i.e., they are normalized by the slots counter
+    const double slots = count("slots");
+    result.retiring = count("topdown-retiring") / slots;
+    result.bad_speculation = count("topdown-bad-spec") / slots;
+    result.frontend_bound = count("topdown-fe-bound") / slots;
+    result.backend_bound = count("topdown-be-bound") / slots;
+    result.heavy_operations = count("topdown-heavy-ops") / slots;
+    result.branch_mispredicts = count("topdown-br-mispredict") / slots;
+    result.fetch_latency = count("topdown-fetch-lat") / slots;
+    result.memory_bound = count("topdown-mem-bound") / slots;
+  } else if (method_ == "intel-topdown-slots") {
+    const double slots = count("topdown-total-slots");
+    result.retiring = count("topdown-slots-retired") / slots;
+    result.bad_speculation = (count("topdown-slots-issued") - count("topdown-slots-retired") + count("topdown-recovery-bubbles")) / slots;
+    result.frontend_bound = count("topdown-fetch-bubbles") / slots;
+    result.backend_bound = 1.0 - result.retiring - result.bad_speculation - result.frontend_bound;
+  } else if (method_ == "amd-pipeline-utilization") {
+    const double slots = amd_slots_per_cycle_ * count("ls_not_halted_cyc");
+    result.retiring = count("ex_ret_ops") / slots;
+    result.bad_speculation = (count("de_src_op_disp.all") - count("ex_ret_ops")) / slots;
+    result.frontend_bound = count("de_no_dispatch_per_slot.no_ops_from_frontend") / slots;
+    result.backend_bound = count("de_no_dispatch_per_slot.backend_stalls") / slots;
+
+    // Cycles without any op from the frontend are fetch latency, the second group has its own cycle count as it may be scheduled differently
+    result.fetch_latency = count("de_no_dispatch_per_slot.no_ops_from_frontend.cmask") / count("ls_not_halted_cyc.l2");
+    result.memory_bound = result.backend_bound * count("ex_no_retire.load_not_complete") / count("ex_no_retire.not_complete");
+  }
+
+  return result;
+}
+
+}  // namespace benchmark
+#else
+
+namespace benchmark {
+
+PhaseCounterGroup::PhaseCounterGroup() : event_fds_{} { event_fds_.fill(-1); }
+PhaseCounterGroup::~PhaseCounterGroup() = default;
+void PhaseCounterGroup::start() {}
+PhaseCounters PhaseCounterGroup::stop() { return PhaseCounters{}; }
+
+TopdownMonitor::TopdownMonitor() = default;
+TopdownMonitor::~TopdownMonitor() = default;
+void TopdownMonitor::start() {}
+void TopdownMonitor::stop() {}
+TopdownResult TopdownMonitor::get_result() const { return TopdownResult{}; }
+
 }  // namespace benchmark
 #endif
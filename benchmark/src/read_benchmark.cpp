@@ -13,21 +13,68 @@ void ReadBenchmarkResultCollector::to_csv(std::filesystem::path path) {
   result_file << "Timestamp,Hashmap,Compiler,SystemHostname,PageSize,HugePageSize,DataPointer,IsAlignedToHPSize,LoadFactor,SQR,Size,ThreadCount,"
                  "ThreadTableSize,Distribution,Workload,"
                  "KeySize,ValueSize,"
-                 "EntrySize,EntriesProcessed,Runtime,ThreadAvgRuntime,ThreadMaxRuntime,Zipf,ZipfFactor,Successful"
-              << std::endl;
+                 "EntrySize,EntriesProcessed,Runtime,ThreadAvgRuntime,ThreadMaxRuntime,Zipf,ZipfFactor,Successful,FillIPC,FillLLCMissesPerInsert,"
+                 "FillDTLBMissesPerInsert,FillBranchMissesPerInsert,IPC,LLCMissesPerLookup,DTLBMissesPerLookup,BranchMissesPerLookup,MemoryBudget,"
+                 "MemoryUsage,LookupsPerSecondPerGB,CacheHitRatio,CacheSpeedup,BatchSize,FilterRejectionRate,FilterSavedProbes,"
+              << TopdownResult::csv_header << std::endl;
 
   for (const ReadBenchmarkResult& result : benchmark_results_) {
-    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}", benchmark::timeSinceEpochMillisec(),
+    const PhaseCounters& fill = result.fill_counters;
+    const PhaseCounters& lookup = result.lookup_counters;
+    const uint64_t total_lookups = result.entries_processed * result.thread_count;
+
+    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},"
+                               "{},{},{},{},{},{}",
+                               benchmark::timeSinceEpochMillisec(),
                                result.hashmap_identifier, get_compiler_identifier(), get_hostname(), hashmap::utils::page_size,
                                hashmap::utils::hugepage_size, result.data_ptr, result.is_aligned_to_hp, result.load_factor,
                                result.successful_query_rate, result.hashtable_size, result.thread_count, result.threadtable_size,
                                result.distribution_name, result.workload, result.key_size, result.value_size, result.entry_size,
                                result.entries_processed, result.runtime, result.thread_avg_runtime, result.thread_max_runtime, result.zipf,
-                               result.zipf_factor, result.successful)
+                               result.zipf_factor, result.successful, fill.ipc(),
+                               PhaseCounters::per_operation(fill.llc_misses, result.entries_filled),
+                               PhaseCounters::per_operation(fill.dtlb_misses, result.entries_filled),
+                               PhaseCounters::per_operation(fill.branch_misses, result.entries_filled), lookup.ipc(),
+                               PhaseCounters::per_operation(lookup.llc_misses, total_lookups),
+                               PhaseCounters::per_operation(lookup.dtlb_misses, total_lookups),
+                               PhaseCounters::per_operation(lookup.branch_misses, total_lookups), result.memory_budget, result.memory_usage,
+                               throughput_per_gb(total_lookups, result.runtime, result.memory_usage),
+                               static_cast<double>(result.cache_hits) / static_cast<double>(std::max(total_lookups, uint64_t{1})),
+                               cache_speedup(result), result.batch_size,
+                               static_cast<double>(result.filter_counters.rejections) /
+                                   static_cast<double>(std::max(result.filter_counters.checks, uint64_t{1})),
+                               result.filter_counters.rejections, result.lookup_topdown.to_csv())
                 << std::endl;
   }
 
   result_file.close();
 }
 
+// Speedup of a table with hot-key cache over the same table without it, averaged over all runs of the latter with the same parameters.
+// Returns 0 if the run has no cache or the uncached table was not benchmarked.
+double ReadBenchmarkResultCollector::cache_speedup(const ReadBenchmarkResult& result) const {
+  if (result.uncached_identifier.empty() || !result.successful || result.runtime == 0) {
+    return 0;
+  }
+
+  uint64_t baseline_runtime = 0;
+  uint64_t baseline_runs = 0;
+  for (const ReadBenchmarkResult& baseline : benchmark_results_) {
+    if (baseline.hashmap_identifier == result.uncached_identifier && baseline.successful && baseline.load_factor == result.load_factor &&
+        baseline.successful_query_rate == result.successful_query_rate && baseline.hashtable_size == result.hashtable_size &&
+        baseline.thread_count == result.thread_count && baseline.distribution_name == result.distribution_name &&
+        baseline.workload == result.workload && baseline.zipf == result.zipf && baseline.zipf_factor == result.zipf_factor &&
+        baseline.memory_budget == result.memory_budget) {
+      baseline_runtime += baseline.runtime;
+      ++baseline_runs;
+    }
+  }
+
+  if (baseline_runs == 0) {
+    return 0;
+  }
+
+  return static_cast<double>(baseline_runtime) / static_cast<double>(baseline_runs) / static_cast<double>(result.runtime);
+}
+
 }  // namespace benchmark::read
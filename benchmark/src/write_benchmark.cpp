@@ -12,15 +12,23 @@ void WriteBenchmarkResultCollector::to_csv(std::filesystem::path path) {
   result_file.open(path);
   result_file << "Hashmap,Compiler,SystemHostname,PageSize,HugePageSize,DataPointer,IsAlignedToHPSize,LoadFactor,Size,ThreadCount,ThreadTableSize,"
                  "Distribution,"
-                 "KeySize,ValueSize,EntrySize,EntriesProcessed,Runtime,ThreadAvgRuntime,ThreadMaxRuntime,Successful"
-              << std::endl;
+                 "KeySize,ValueSize,EntrySize,EntriesProcessed,Runtime,ThreadAvgRuntime,ThreadMaxRuntime,Successful,IPC,LLCMissesPerInsert,"
+                 "DTLBMissesPerInsert,BranchMissesPerInsert,MemoryUsage,InsertsPerSecondPerGB,"
+              << TopdownResult::csv_header << std::endl;
 
   for (const WriteBenchmarkResult& result : benchmark_results_) {
-    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}", result.hashmap_identifier, get_compiler_identifier(),
-                               get_hostname(), hashmap::utils::page_size, hashmap::utils::hugepage_size, result.data_ptr, result.is_aligned_to_hp,
-                               result.load_factor, result.hashtable_size, result.thread_count, result.threadtable_size, result.distribution_name,
-                               result.key_size, result.value_size, result.entry_size, result.entries_processed, result.runtime,
-                               result.thread_avg_runtime, result.thread_max_runtime, result.successful)
+    const PhaseCounters& counters = result.insert_counters;
+    const uint64_t total_inserts = result.entries_processed * result.thread_count;
+
+    result_file << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}", result.hashmap_identifier,
+                               get_compiler_identifier(), get_hostname(), hashmap::utils::page_size, hashmap::utils::hugepage_size, result.data_ptr,
+                               result.is_aligned_to_hp, result.load_factor, result.hashtable_size, result.thread_count, result.threadtable_size,
+                               result.distribution_name, result.key_size, result.value_size, result.entry_size, result.entries_processed,
+                               result.runtime, result.thread_avg_runtime, result.thread_max_runtime, result.successful, counters.ipc(),
+                               PhaseCounters::per_operation(counters.llc_misses, total_inserts),
+                               PhaseCounters::per_operation(counters.dtlb_misses, total_inserts),
+                               PhaseCounters::per_operation(counters.branch_misses, total_inserts), result.memory_usage,
+                               throughput_per_gb(total_inserts, result.runtime, result.memory_usage), result.insert_topdown.to_csv())
                 << std::endl;
   }
 
@@ -0,0 +1,247 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "hashmap/hashes/buckethash.hpp"
+#include "hashmap/hashes/hasher.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+
+#if defined(HASHMAP_IS_X86) && defined(__AES__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+#define HASHMAP_AES_X86 1
+#elif defined(HASHMAP_IS_ARM) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)) && !defined(HASHMAP_USE_SCALAR_IMPL)
+#define HASHMAP_AES_ARM 1
+#endif
+
+namespace hashmap::hashing {
+
+namespace aes {
+
+constexpr uint8_t gf_double(uint8_t a) { return static_cast<uint8_t>((a << 1U) ^ ((a & 0x80U) != 0 ? 0x1BU : 0)); }
+
+constexpr uint8_t gf_multiply(uint8_t a, uint8_t b) {
+  uint8_t product = 0;
+  for (uint8_t bit = 0; bit < 8; ++bit) {
+    if ((b & (1U << bit)) != 0) {
+      product ^= a;
+    }
+    a = gf_double(a);
+  }
+  return product;
+}
+
+constexpr std::array<uint8_t, 256> make_sbox() {
+  std::array<uint8_t, 256> sbox{};
+  for (uint32_t x = 0; x < 256; ++x) {
+    // The multiplicative inverse in GF(2^8) is x^254, followed by the affine transformation of the S-box
+    uint8_t inverse = 1;
+    for (uint8_t i = 0; i < 254; ++i) {
+      inverse = gf_multiply(inverse, static_cast<uint8_t>(x));
+    }
+    const auto rotl8 = [](uint8_t value, uint8_t shift) { return static_cast<uint8_t>((value << shift) | (value >> (8U - shift))); };
+    sbox[x] = static_cast<uint8_t>(inverse ^ rotl8(inverse, 1) ^ rotl8(inverse, 2) ^ rotl8(inverse, 3) ^ rotl8(inverse, 4) ^ 0x63U);
+  }
+  return sbox;
+}
+
+constexpr static std::array<uint8_t, 256> sbox = make_sbox();
+
+using ScalarBlock = std::array<uint8_t, 16>;
+
+// One AES encryption round (SubBytes, ShiftRows, MixColumns, AddRoundKey) in software, returns exactly what aesenc returns. The byte at
+// index i is row i % 4 of column i / 4.
+inline ScalarBlock round_scalar(const ScalarBlock& state, const ScalarBlock& round_key) {
+  ScalarBlock shifted{};
+  for (uint8_t column = 0; column < 4; ++column) {
+    for (uint8_t row = 0; row < 4; ++row) {
+      shifted[column * 4 + row] = sbox[state[((column + row) % 4) * 4 + row]];
+    }
+  }
+
+  ScalarBlock result{};
+  for (uint8_t column = 0; column < 4; ++column) {
+    const uint8_t* a = &shifted[column * 4];
+    result[column * 4 + 0] = gf_double(a[0]) ^ gf_double(a[1]) ^ a[1] ^ a[2] ^ a[3];
+    result[column * 4 + 1] = a[0] ^ gf_double(a[1]) ^ gf_double(a[2]) ^ a[2] ^ a[3];
+    result[column * 4 + 2] = a[0] ^ a[1] ^ gf_double(a[2]) ^ gf_double(a[3]) ^ a[3];
+    result[column * 4 + 3] = gf_double(a[0]) ^ a[0] ^ a[1] ^ a[2] ^ gf_double(a[3]);
+  }
+
+  for (uint8_t i = 0; i < 16; ++i) {
+    result[i] ^= round_key[i];
+  }
+  return result;
+}
+
+#if defined(HASHMAP_AES_X86)
+using Block = __m128i;
+#elif defined(HASHMAP_AES_ARM)
+using Block = uint8x16_t;
+#else
+using Block = ScalarBlock;
+#endif
+
+HEDLEY_ALWAYS_INLINE Block make_block(uint64_t low, uint64_t high) {
+#if defined(HASHMAP_AES_X86)
+  return _mm_set_epi64x(static_cast<int64_t>(high), static_cast<int64_t>(low));
+#elif defined(HASHMAP_AES_ARM)
+  return vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(low), vcreate_u64(high)));
+#else
+  Block block;
+  std::memcpy(block.data(), &low, sizeof(uint64_t));
+  std::memcpy(block.data() + sizeof(uint64_t), &high, sizeof(uint64_t));
+  return block;
+#endif
+}
+
+HEDLEY_ALWAYS_INLINE Block xor_blocks(const Block& lhs, const Block& rhs) {
+#if defined(HASHMAP_AES_X86)
+  return _mm_xor_si128(lhs, rhs);
+#elif defined(HASHMAP_AES_ARM)
+  return veorq_u8(lhs, rhs);
+#else
+  Block result;
+  for (uint8_t i = 0; i < 16; ++i) {
+    result[i] = lhs[i] ^ rhs[i];
+  }
+  return result;
+#endif
+}
+
+// ARM splits the round differently (AESE = AddRoundKey + SubBytes + ShiftRows, AESMC = MixColumns). With a zero key for AESE and the round
+// key XORed afterwards, both architectures compute the same round.
+HEDLEY_ALWAYS_INLINE Block round(const Block& state, const Block& round_key) {
+#if defined(HASHMAP_AES_X86)
+  return _mm_aesenc_si128(state, round_key);
+#elif defined(HASHMAP_AES_ARM)
+  return veorq_u8(vaesmcq_u8(vaeseq_u8(state, vdupq_n_u8(0))), round_key);
+#else
+  return round_scalar(state, round_key);
+#endif
+}
+
+HEDLEY_ALWAYS_INLINE uint64_t low_half(const Block& block) {
+#if defined(HASHMAP_AES_X86)
+  return static_cast<uint64_t>(_mm_cvtsi128_si64(block));
+#elif defined(HASHMAP_AES_ARM)
+  return vgetq_lane_u64(vreinterpretq_u64_u8(block), 0);
+#else
+  uint64_t low = 0;
+  std::memcpy(&low, block.data(), sizeof(uint64_t));
+  return low;
+#endif
+}
+
+// Round keys are the first fractional digits of pi
+constexpr static std::array<uint64_t, 4> round_key_words = {0x243F6A8885A308D3, 0x13198A2E03707344, 0xA4093822299F31D0, 0x082EFA98EC4E6C89};
+
+}  // namespace aes
+
+// Mixes the key with AES encryption rounds (AES-NI / ARMv8 AES). Two rounds diffuse every input byte into every output byte, so a 64-bit key
+// is placed into the lower half of the state and run through two rounds. Longer keys (strings, composite keys) are absorbed in 16-byte blocks
+// with one round each and finalized with two rounds. This is not a cryptographic hash, the round keys are public constants.
+template <typename KeyT, Finalizer range_finalizer>
+struct AESHasher : public Hasher<KeyT, range_finalizer> {
+  AESHasher(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
+
+  HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) {
+    const aes::Block first_key = aes::make_block(aes::round_key_words[0], aes::round_key_words[1]);
+    const aes::Block second_key = aes::make_block(aes::round_key_words[2], aes::round_key_words[3]);
+
+    if constexpr (std::is_same_v<KeyT, StringKey> || utils::is_composite_key_v<KeyT>) {
+      const char* data = nullptr;
+      if constexpr (std::is_same_v<KeyT, StringKey>) {
+        DEBUG_ASSERT(key.string_ != nullptr, "String of key cannot be nullptr.");
+        data = key.string_;
+      } else {
+        data = reinterpret_cast<const char*>(&key);
+      }
+
+      aes::Block state = first_key;
+      for (uint64_t offset = 0; offset < key_size; offset += 2 * sizeof(uint64_t)) {
+        uint64_t words[2] = {0, 0};
+        std::memcpy(words, data + offset, std::min<uint64_t>(2 * sizeof(uint64_t), key_size - offset));
+        state = aes::round(aes::xor_blocks(state, aes::make_block(words[0], words[1])), first_key);
+      }
+      return aes::low_half(aes::round(aes::round(state, second_key), first_key));
+    } else {
+      const aes::Block state = aes::make_block(static_cast<uint64_t>(key), 0);
+      return aes::low_half(aes::round(aes::round(state, first_key), second_key));
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const { return this->finalize(static_hash(key)); }
+
+  // With VAES, one 512-bit aesenc runs the rounds of four 64-bit keys at once. Otherwise, the rounds of different keys are independent and
+  // overlap in the AES unit.
+  HEDLEY_ALWAYS_INLINE static void static_hash_batch(const KeyT* keys, uint64_t* hashes, uint64_t count) {
+    uint64_t i = 0;
+#if defined(HASHMAP_AES_X86) && defined(__VAES__) && defined(__AVX512F__)
+    if constexpr (std::is_same_v<KeyT, uint64_t>) {
+      const auto broadcast = [](uint64_t low, uint64_t high) {
+        return _mm512_set4_epi64(static_cast<int64_t>(high), static_cast<int64_t>(low), static_cast<int64_t>(high), static_cast<int64_t>(low));
+      };
+      const __m512i first_key = broadcast(aes::round_key_words[0], aes::round_key_words[1]);
+      const __m512i second_key = broadcast(aes::round_key_words[2], aes::round_key_words[3]);
+      constexpr __mmask8 lower_halves = 0x55;  // the lower 64 bits of each 128-bit lane
+
+      for (; i + 4 <= count; i += 4) {
+        const __m512i state = _mm512_maskz_expandloadu_epi64(lower_halves, keys + i);
+        const __m512i result = _mm512_aesenc_epi128(_mm512_aesenc_epi128(state, first_key), second_key);
+        _mm512_mask_compressstoreu_epi64(hashes + i, lower_halves, result);
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      hashes[i] = static_hash(keys[i]);
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE void hash_batch(const KeyT* keys, uint64_t* hashes, uint64_t count) const {
+    static_hash_batch(keys, hashes, count);
+    for (uint64_t i = 0; i < count; ++i) {
+      hashes[i] = this->finalize(hashes[i]);
+    }
+  }
+
+  template <typename FingerprintT, FingerprintBucketBits fbb, FingerprintT invalid_fp = 0>
+  HEDLEY_ALWAYS_INLINE BucketHash<FingerprintT> bucket_hash(const KeyT& key) {
+    const uint64_t r = static_hash(key);
+    BucketHash<FingerprintT> hash{};
+
+    static_assert(
+        fbb != FingerprintBucketBits::LSBMSB,
+        "For AES hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types of hashing.");
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
+      FAIL("For AES hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types of hashing.");
+    } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
+      constexpr uint64_t fp_shift_factor = 64 - (sizeof(FingerprintT) * 8);
+
+      hash.bucket = this->finalize(r);
+      hash.fingerprint = r >> fp_shift_factor;
+    } else {
+      hash.bucket = this->finalize(r);
+      hash.fingerprint = static_cast<FingerprintT>(r);
+    }
+#pragma GCC diagnostic pop
+
+    if (HEDLEY_UNLIKELY(hash.fingerprint == invalid_fp)) {
+      ++(hash.fingerprint);
+    }
+    return hash;
+  }
+
+  std::string get_identifier() const { return "AES" + this->finalizer_identifier() + "Hasher"; }
+
+ private:
+  constexpr static uint64_t key_size = std::is_same_v<KeyT, StringKey> ? HASHMAP_STRINGKEY_SIZE : sizeof(KeyT);
+};
+
+}  // namespace hashmap::hashing
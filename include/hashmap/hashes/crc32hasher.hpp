@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "hashmap/hashes/buckethash.hpp"
+#include "hashmap/hashes/hasher.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+
+#if defined(HASHMAP_IS_ARM) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace hashmap::hashing {
+
+namespace crc32c {
+
+// Reflected CRC-32C (Castagnoli) polynomial, which is the one implemented by the SSE4.2 and ARMv8 crc32c instructions
+constexpr static uint32_t polynomial = 0x82F63B78;
+
+constexpr std::array<uint32_t, 256> make_table() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t byte = 0; byte < 256; ++byte) {
+    uint32_t crc = byte;
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1U) ^ ((crc & 1U) != 0 ? polynomial : 0);
+    }
+    table[byte] = crc;
+  }
+  return table;
+}
+
+constexpr static std::array<uint32_t, 256> table = make_table();
+
+// Bytewise software implementation, returns exactly what the instructions return (no pre- or post-inversion)
+HEDLEY_ALWAYS_INLINE uint32_t update_scalar(uint32_t crc, uint64_t value) {
+  for (uint8_t byte = 0; byte < sizeof(uint64_t); ++byte) {
+    crc = table[(crc ^ static_cast<uint32_t>(value)) & 0xFFU] ^ (crc >> 8U);
+    value >>= 8U;
+  }
+  return crc;
+}
+
+HEDLEY_ALWAYS_INLINE uint32_t update(uint32_t crc, uint64_t value) {
+#if defined(HASHMAP_IS_X86) && defined(__SSE4_2__)
+  return static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+#elif defined(HASHMAP_IS_ARM) && defined(__ARM_FEATURE_CRC32)
+  return __crc32cd(crc, value);
+#else
+  return update_scalar(crc, value);
+#endif
+}
+
+}  // namespace crc32c
+
+// Hashes with the CRC32C instruction (3 cycles latency, 1 per cycle throughput). A single CRC only yields 32 bits, hence we run a second lane
+// over the word rotated by 32 bits and combine both lanes to 64 bits. As CRC is linear in the key, the combined value is multiplied by an odd
+// constant afterwards such that the upper bits (i.e., the MSB fingerprint) depend on all bits of both lanes. The second lane gets the rotated
+// word instead of another seed, as a different seed would only XOR a constant onto the first lane.
+template <typename KeyT, Finalizer range_finalizer>
+struct CRC32Hasher : public Hasher<KeyT, range_finalizer> {
+  CRC32Hasher(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
+
+  HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) {
+    uint32_t lower = seed;
+    uint32_t upper = seed;
+
+    if constexpr (std::is_same_v<KeyT, StringKey>) {
+      DEBUG_ASSERT(key.string_ != nullptr, "String of key cannot be nullptr.");
+      for (uint64_t offset = 0; offset < HASHMAP_STRINGKEY_SIZE; offset += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, key.string_ + offset, std::min<uint64_t>(sizeof(uint64_t), HASHMAP_STRINGKEY_SIZE - offset));
+        lower = crc32c::update(lower, word);
+        upper = crc32c::update(upper, std::rotr(word, 32));
+      }
+    } else if constexpr (utils::is_composite_key_v<KeyT>) {
+      for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+        lower = crc32c::update(lower, key.columns[column]);
+        upper = crc32c::update(upper, std::rotr(key.columns[column], 32));
+      }
+    } else {
+      lower = crc32c::update(lower, static_cast<uint64_t>(key));
+      upper = crc32c::update(upper, std::rotr(static_cast<uint64_t>(key), 32));
+    }
+
+    return ((static_cast<uint64_t>(upper) << 32U) | lower) * utils::murmur_constant1;
+  }
+
+  HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const { return this->finalize(static_hash(key)); }
+
+  // The CRC chains of different keys are independent, such that the out-of-order core overlaps them and we get close to one CRC per cycle
+  // instead of one per three cycles
+  HEDLEY_ALWAYS_INLINE static void static_hash_batch(const KeyT* keys, uint64_t* hashes, uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+      hashes[i] = static_hash(keys[i]);
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE void hash_batch(const KeyT* keys, uint64_t* hashes, uint64_t count) const {
+    static_hash_batch(keys, hashes, count);
+    for (uint64_t i = 0; i < count; ++i) {
+      hashes[i] = this->finalize(hashes[i]);
+    }
+  }
+
+  template <typename FingerprintT, FingerprintBucketBits fbb, FingerprintT invalid_fp = 0>
+  HEDLEY_ALWAYS_INLINE BucketHash<FingerprintT> bucket_hash(const KeyT& key) {
+    const uint64_t r = static_hash(key);
+    BucketHash<FingerprintT> hash{};
+
+    static_assert(
+        fbb != FingerprintBucketBits::LSBMSB,
+        "For CRC32 hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types of hashing.");
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
+      FAIL("For CRC32 hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types of hashing.");
+    } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
+      constexpr uint64_t fp_shift_factor = 64 - (sizeof(FingerprintT) * 8);
+
+      hash.bucket = this->finalize(r);
+      hash.fingerprint = r >> fp_shift_factor;
+    } else {
+      hash.bucket = this->finalize(r);
+      hash.fingerprint = static_cast<FingerprintT>(r);
+    }
+#pragma GCC diagnostic pop
+
+    if (HEDLEY_UNLIKELY(hash.fingerprint == invalid_fp)) {
+      ++(hash.fingerprint);
+    }
+    return hash;
+  }
+
+  std::string get_identifier() const { return "CRC32" + this->finalizer_identifier() + "Hasher"; }
+
+ private:
+  constexpr static uint32_t seed = 0x9E3779B9;
+};
+
+}  // namespace hashmap::hashing
@@ -2,40 +2,75 @@
 #include <cmath>
 #include <cstdint>
 #include <functional>
+#include <string>
 
 #include "fmt/format.h"
+#include "hashmap/hashes/buckethash.hpp"
 #include "hashmap/utils.hpp"
 #include "hedley.h"
 
 namespace hashmap::hashing {
 
-template <typename KeyT, bool use_modulo>
+// How finalize maps a hash into [0; maximum_value). Masking only supports powers of two, modulo and fastrange (Lemire's multiply-high range
+// reduction, (hash * maximum_value) >> 64) support arbitrary ranges. Hashers take the finalizer as template parameter, where false and true
+// still select masking and modulo. Note that fastrange takes the range from the upper bits of the hash, such that fingerprints should be taken
+// from the lower bits (LSB/LSB) to stay independent of the bucket.
+using Finalizer = uint8_t;
+namespace finalizer {
+constexpr static Finalizer MASK = 0;
+constexpr static Finalizer MODULO = 1;
+constexpr static Finalizer FASTRANGE = 2;
+}  // namespace finalizer
+
+template <typename KeyT, Finalizer range_finalizer>
 struct Hasher {
+  static_assert(range_finalizer <= finalizer::FASTRANGE, "Unknown finalizer");
+
  public:
+  // Whether the hasher can map into ranges that are not a power of two
+  constexpr static bool supports_arbitrary_range = range_finalizer != finalizer::MASK;
+  // Layout of bucket_hash whose fingerprint does not overlap the bits that hash() maps into the range (unless the range exceeds 2^56): fastrange
+  // takes the range from the upper bits of the hash, modulo from the lower bits. Masking takes the lower bits as well, unless the hasher masks
+  // by shifting the upper bits down, as the multiply-shift hashers do.
+  constexpr static FingerprintBucketBits independent_fingerprint_bits_for(bool masks_by_shifting) {
+    if (range_finalizer == finalizer::MASK && masks_by_shifting) {
+      return FingerprintBucketBits::LSBMSB;
+    }
+    return range_finalizer == finalizer::FASTRANGE ? FingerprintBucketBits::LSBLSB : FingerprintBucketBits::MSBLSB;
+  }
+  constexpr static FingerprintBucketBits independent_fingerprint_bits = independent_fingerprint_bits_for(false);
+
   Hasher(uint64_t maximum_value) : maximum_value_{maximum_value} {
     // we allow zero here as we sometimes (chained hash map need a garbage initializer)
-    ASSERT(utils::is_power_of_two(maximum_value) || maximum_value == 0 || use_modulo,
-           fmt::format("When not using modulo-finalization, we need to map into the range [0; 2^w]. use_modulo = {}, "
+    ASSERT(utils::is_power_of_two(maximum_value) || maximum_value == 0 || supports_arbitrary_range,
+           fmt::format("When not using modulo- or fastrange-finalization, we need to map into the range [0; 2^w]. range_finalizer = {}, "
                        "maximum_value = {}, next po2 = {} ",
-                       use_modulo, maximum_value, utils::value_or_np2(maximum_value)));
+                       range_finalizer, maximum_value, utils::value_or_np2(maximum_value)));
   }
 
   HEDLEY_ALWAYS_INLINE uint64_t finalize(const uint64_t& hash) const {
-    if constexpr (use_modulo) {
+    if constexpr (range_finalizer == finalizer::FASTRANGE) {
+      return static_cast<uint64_t>((static_cast<uint128_t>(hash) * maximum_value_) >> 64);
+    } else if constexpr (range_finalizer == finalizer::MODULO) {
       return hash % maximum_value_;
     } else {
       return hash & (maximum_value_ - 1);
     }
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "UndefinedModHasher";
+  // Infix of the hasher identifiers, e.g., StdBitHasher, StdModHasher, and StdFastRangeHasher
+  static std::string finalizer_identifier() {
+    if constexpr (range_finalizer == finalizer::FASTRANGE) {
+      return "FastRange";
+    } else if constexpr (range_finalizer == finalizer::MODULO) {
+      return "Mod";
     } else {
-      return "UndefinedBitHasher";
+      return "Bit";
     }
   }
 
+  std::string get_identifier() const { return "Undefined" + finalizer_identifier() + "Hasher"; }
+
   alignas(utils::cacheline_size) const uint64_t maximum_value_;
 };
 
@@ -8,16 +8,16 @@
 
 namespace hashmap::hashing {
 
-template <typename KeyT, bool use_modulo>
-struct IdentityHasher : public Hasher<KeyT, use_modulo> {
-  IdentityHasher(uint64_t maximum_value) : Hasher<KeyT, use_modulo>(maximum_value) {}
+template <typename KeyT, Finalizer range_finalizer>
+struct IdentityHasher : public Hasher<KeyT, range_finalizer> {
+  IdentityHasher(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) { return key; }
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const { return this->finalize(static_hash(key)); }
 
   template <typename FingerprintT, FingerprintBucketBits fbb, FingerprintT invalid_fp = 0>
   HEDLEY_ALWAYS_INLINE BucketHash<FingerprintT> bucket_hash(const KeyT& key) {
     const uint64_t r = static_hash(key);
-    BucketHash hash{};
+    BucketHash<FingerprintT> hash{};
     static_assert(
         fbb != FingerprintBucketBits::LSBMSB,
         "For identity hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types of hashing.");
@@ -43,13 +43,7 @@ struct IdentityHasher : public Hasher<KeyT, use_modulo> {
     return hash;
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "IdentityModHasher";
-    } else {
-      return "IdentityBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "Identity" + this->finalizer_identifier() + "Hasher"; }
 };
 
 }  // namespace hashmap::hashing
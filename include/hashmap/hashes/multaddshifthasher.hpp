@@ -10,10 +10,13 @@
 
 namespace hashmap::hashing {
 
-template <typename KeyT, bool use_modulo>
-struct MultAddShift128BHasher : public Hasher<KeyT, use_modulo> {
+template <typename KeyT, Finalizer range_finalizer>
+struct MultAddShift128BHasher : public Hasher<KeyT, range_finalizer> {
+  constexpr static FingerprintBucketBits independent_fingerprint_bits =
+      Hasher<KeyT, range_finalizer>::independent_fingerprint_bits_for(/*masks_by_shifting=*/true);
+
   MultAddShift128BHasher(uint64_t maximum_value)
-      : Hasher<KeyT, use_modulo>(maximum_value), shiftfactor_{128 - static_cast<uint64_t>(std::log2(maximum_value))} {}
+      : Hasher<KeyT, range_finalizer>(maximum_value), shiftfactor_{128 - static_cast<uint64_t>(std::log2(maximum_value))} {}
 
   HEDLEY_ALWAYS_INLINE static uint128_t static_hash(const KeyT& key) {
     return utils::multiply_constant_128b * static_cast<uint128_t>(key) + utils::add_constant_128b;
@@ -32,7 +35,11 @@ struct MultAddShift128BHasher : public Hasher<KeyT, use_modulo> {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
-      hash.bucket = static_cast<uint64_t>(r >> shiftfactor_);
+      if constexpr (range_finalizer == finalizer::FASTRANGE) {
+        hash.bucket = this->finalize(static_cast<uint64_t>(r >> 64));
+      } else {
+        hash.bucket = static_cast<uint64_t>(r >> shiftfactor_);
+      }
       hash.fingerprint = static_cast<FingerprintT>(r >> 64);
     } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
       constexpr uint64_t fp_shift_factor = 128 - (sizeof(FingerprintT) * 8);
@@ -55,32 +62,29 @@ struct MultAddShift128BHasher : public Hasher<KeyT, use_modulo> {
 
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const {
     uint128_t r = static_hash(key);
-    // We don't do finalize here because we have to shift anyway, so we can directly incorporate it
+    // For masking, we don't do finalize here because we have to shift anyway, so we can directly incorporate it
 
-    if constexpr (use_modulo) {
-      // Make r a 64 bit integer first, to make modulo faster
-      return static_cast<uint64_t>(r >> 64) % this->maximum_value_;
+    if constexpr (range_finalizer != finalizer::MASK) {
+      // Make r a 64 bit integer first, to make modulo faster (and to keep the MSBs for fastrange)
+      return this->finalize(static_cast<uint64_t>(r >> 64));
     } else {
       return static_cast<uint64_t>(r >> shiftfactor_);
     }
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "MultAddShift128BModHasher";
-    } else {
-      return "MultAddShift128BBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "MultAddShift128B" + this->finalizer_identifier() + "Hasher"; }
 
  private:
   alignas(utils::cacheline_size) const uint64_t shiftfactor_;
 };
 
-template <typename KeyT, bool use_modulo>
-struct MultAddShift64BHasher : public Hasher<KeyT, use_modulo> {
+template <typename KeyT, Finalizer range_finalizer>
+struct MultAddShift64BHasher : public Hasher<KeyT, range_finalizer> {
+  constexpr static FingerprintBucketBits independent_fingerprint_bits =
+      Hasher<KeyT, range_finalizer>::independent_fingerprint_bits_for(/*masks_by_shifting=*/true);
+
   MultAddShift64BHasher(uint64_t maximum_value)
-      : Hasher<KeyT, use_modulo>(maximum_value), shiftfactor_{64 - static_cast<uint64_t>(std::log2(maximum_value))} {}
+      : Hasher<KeyT, range_finalizer>(maximum_value), shiftfactor_{64 - static_cast<uint64_t>(std::log2(maximum_value))} {}
 
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) { return utils::multiply_constant_64b * key + utils::add_constant_64b; }
 
@@ -98,7 +102,11 @@ struct MultAddShift64BHasher : public Hasher<KeyT, use_modulo> {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
-      hash.bucket = r >> shiftfactor_;
+      if constexpr (range_finalizer == finalizer::FASTRANGE) {
+        hash.bucket = this->finalize(r);
+      } else {
+        hash.bucket = r >> shiftfactor_;
+      }
       hash.fingerprint = static_cast<FingerprintT>(r);
     } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
       constexpr uint64_t fp_shift_factor = 64 - (sizeof(FingerprintT) * 8);
@@ -120,22 +128,17 @@ struct MultAddShift64BHasher : public Hasher<KeyT, use_modulo> {
 
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const {
     uint64_t r = static_hash(key);
-    // We don't do finalize here because we have to shift anyway, so we can directly incorporate it
+    // For masking, we don't do finalize here because we have to shift anyway, so we can directly incorporate it. Fastrange also maps the
+    // MSBs of r into the range, i.e., it is the shift generalized to arbitrary ranges.
 
-    if constexpr (use_modulo) {
-      return r % this->maximum_value_;
+    if constexpr (range_finalizer != finalizer::MASK) {
+      return this->finalize(r);
     } else {
       return static_cast<uint64_t>(r >> shiftfactor_);
     }
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "MultAddShift64BModHasher";
-    } else {
-      return "MultAddShift64BBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "MultAddShift64B" + this->finalizer_identifier() + "Hasher"; }
 
  private:
   alignas(utils::cacheline_size) const uint64_t shiftfactor_;
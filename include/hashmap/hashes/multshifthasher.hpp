@@ -14,10 +14,13 @@ namespace hashmap::hashing {
 
 // taken from https://github.com/rurban/smhasher/blob/28de33a868763a00439a5fc408b56b20f2d86f7c/Hashes.cpp#L906
 
-template <typename KeyT, bool use_modulo>
-struct MultShift128BHasher : public Hasher<KeyT, use_modulo> {
+template <typename KeyT, Finalizer range_finalizer>
+struct MultShift128BHasher : public Hasher<KeyT, range_finalizer> {
+  constexpr static FingerprintBucketBits independent_fingerprint_bits =
+      Hasher<KeyT, range_finalizer>::independent_fingerprint_bits_for(/*masks_by_shifting=*/true);
+
   MultShift128BHasher(uint64_t maximum_value)
-      : Hasher<KeyT, use_modulo>(maximum_value), shiftfactor_{128 - static_cast<uint64_t>(std::log2(maximum_value))} {}
+      : Hasher<KeyT, range_finalizer>(maximum_value), shiftfactor_{128 - static_cast<uint64_t>(std::log2(maximum_value))} {}
 
   HEDLEY_ALWAYS_INLINE static uint128_t static_hash(const KeyT& key) { return utils::multiply_constant_128b * static_cast<uint128_t>(key); }
 
@@ -34,7 +37,11 @@ struct MultShift128BHasher : public Hasher<KeyT, use_modulo> {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
-      hash.bucket = static_cast<uint64_t>(r >> shiftfactor_);
+      if constexpr (range_finalizer == finalizer::FASTRANGE) {
+        hash.bucket = this->finalize(static_cast<uint64_t>(r >> 64));
+      } else {
+        hash.bucket = static_cast<uint64_t>(r >> shiftfactor_);
+      }
       hash.fingerprint = static_cast<FingerprintT>(r >> 64);
     } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
       constexpr uint64_t fp_shift_factor = 128 - (sizeof(FingerprintT) * 8);
@@ -57,34 +64,42 @@ struct MultShift128BHasher : public Hasher<KeyT, use_modulo> {
 
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const {
     uint128_t r = static_hash(key);
-    // We don't do finalize here because we have to shift anyway, so we can directly incorporate it
+    // For masking, we don't do finalize here because we have to shift anyway, so we can directly incorporate it
 
-    if constexpr (use_modulo) {
-      // Make r a 64 bit integer first, to make modulo faster
-      return static_cast<uint64_t>(r >> 64) % this->maximum_value_;
+    if constexpr (range_finalizer != finalizer::MASK) {
+      // Make r a 64 bit integer first, to make modulo faster (and to keep the MSBs for fastrange)
+      return this->finalize(static_cast<uint64_t>(r >> 64));
     } else {
       return static_cast<uint64_t>(r >> shiftfactor_);
     }
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "MultShift128BModHasher";
-    } else {
-      return "MultShift128BBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "MultShift128B" + this->finalizer_identifier() + "Hasher"; }
 
  private:
   alignas(utils::cacheline_size) const uint64_t shiftfactor_;
 };
 
-template <typename KeyT, bool use_modulo>
-struct MultShift64BHasher : public Hasher<KeyT, use_modulo> {
-  MultShift64BHasher(uint64_t maximum_value)
-      : Hasher<KeyT, use_modulo>(maximum_value), shiftfactor_{64 - static_cast<uint64_t>(std::log2(maximum_value))} {}
+template <typename KeyT, Finalizer range_finalizer>
+struct MultShift64BHasher : public Hasher<KeyT, range_finalizer> {
+  constexpr static FingerprintBucketBits independent_fingerprint_bits =
+      Hasher<KeyT, range_finalizer>::independent_fingerprint_bits_for(/*masks_by_shifting=*/true);
 
-  HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) { return utils::multiply_constant_64b * key; }
+  MultShift64BHasher(uint64_t maximum_value)
+      : Hasher<KeyT, range_finalizer>(maximum_value), shiftfactor_{64 - static_cast<uint64_t>(std::log2(maximum_value))} {}
+
+  HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) {
+    if constexpr (utils::is_composite_key_v<KeyT>) {
+      // Vector multiply-shift: every column has its own odd multiplier, and the MSBs of the sum depend on all columns
+      uint64_t r = 0;
+      for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+        r += utils::column_multiply_constants_64b[column] * key.columns[column];
+      }
+      return r;
+    } else {
+      return utils::multiply_constant_64b * key;
+    }
+  }
 
   template <typename FingerprintT, FingerprintBucketBits fbb, FingerprintT invalid_fp = 0>
   HEDLEY_ALWAYS_INLINE BucketHash<FingerprintT> bucket_hash(const KeyT& key) {
@@ -100,7 +115,11 @@ struct MultShift64BHasher : public Hasher<KeyT, use_modulo> {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
     if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
-      hash.bucket = r >> shiftfactor_;
+      if constexpr (range_finalizer == finalizer::FASTRANGE) {
+        hash.bucket = this->finalize(r);
+      } else {
+        hash.bucket = r >> shiftfactor_;
+      }
       hash.fingerprint = static_cast<FingerprintT>(r);
     } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
       constexpr uint64_t fp_shift_factor = 64 - (sizeof(FingerprintT) * 8);
@@ -122,22 +141,17 @@ struct MultShift64BHasher : public Hasher<KeyT, use_modulo> {
 
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const {
     uint64_t r = static_hash(key);
-    // We don't do finalize here because we have to shift anyway, so we can directly incorporate it
+    // For masking, we don't do finalize here because we have to shift anyway, so we can directly incorporate it. Fastrange also maps the
+    // MSBs of r into the range, i.e., it is the shift generalized to arbitrary ranges.
 
-    if constexpr (use_modulo) {
-      return r % this->maximum_value_;
+    if constexpr (range_finalizer != finalizer::MASK) {
+      return this->finalize(r);
     } else {
       return static_cast<uint64_t>(r >> shiftfactor_);
     }
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "MultShift64BModHasher";
-    } else {
-      return "MultShift64BBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "MultShift64B" + this->finalizer_identifier() + "Hasher"; }
 
  private:
   alignas(utils::cacheline_size) const uint64_t shiftfactor_;
@@ -10,23 +10,36 @@
 
 namespace hashmap::hashing {
 
-template <typename KeyT, bool use_modulo>
-struct MurmurHasher : public Hasher<KeyT, use_modulo> {
-  MurmurHasher(uint64_t maximum_value) : Hasher<KeyT, use_modulo>(maximum_value) {}
+template <typename KeyT, Finalizer range_finalizer>
+struct MurmurHasher : public Hasher<KeyT, range_finalizer> {
+  MurmurHasher(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
 
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) {
-    uint64_t x = key ^ (key >> 33U);
-    x *= utils::murmur_constant1;
-    x ^= x >> 33U;
-    x *= utils::murmur_constant2;
-    x ^= x >> 33U;
+    if constexpr (utils::is_composite_key_v<KeyT>) {
+      // Fold the columns into the state one after another, the finalizer spreads each column over all bits
+      uint64_t x = 0;
+      for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+        x = MurmurHasher<uint64_t, range_finalizer>::static_hash(x ^ key.columns[column]);
+      }
+      return x;
+    } else {
+      uint64_t x = key ^ (key >> 33U);
+      x *= utils::murmur_constant1;
+      x ^= x >> 33U;
+      x *= utils::murmur_constant2;
+      x ^= x >> 33U;
 
-    return x;
+      return x;
+    }
   }
 
   template <typename FingerprintT, FingerprintBucketBits fbb, FingerprintT invalid_fp = 0>
   HEDLEY_ALWAYS_INLINE BucketHash<FingerprintT> bucket_hash(const KeyT& key) {
-    const uint64_t r = static_cast<uint32_t>(static_hash(key));  // murmur3 is only 32 bit, but static_hash returns uint64_t
+    const uint64_t full_hash = static_hash(key);
+    const uint64_t r = static_cast<uint32_t>(full_hash);  // buckets and fingerprints come from the lower 32 bit
+    // Fastrange takes the bucket from the upper bits of its input, i.e., it needs the full hash. Otherwise, every range below 2^32 maps all
+    // keys into bucket 0. The fingerprint still comes from the lower 32 bit, which fastrange does not use for any realistic range.
+    const uint64_t bucket_input = range_finalizer == finalizer::FASTRANGE ? full_hash : r;
 
     BucketHash<FingerprintT> hash{};
     static_assert(
@@ -40,10 +53,10 @@ struct MurmurHasher : public Hasher<KeyT, use_modulo> {
     } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
       constexpr uint32_t fp_shift_factor = 32 - (sizeof(FingerprintT) * 8);
 
-      hash.bucket = this->finalize(r);
+      hash.bucket = this->finalize(bucket_input);
       hash.fingerprint = r >> fp_shift_factor;
     } else {
-      hash.bucket = this->finalize(r);
+      hash.bucket = this->finalize(bucket_input);
       hash.fingerprint = static_cast<FingerprintT>(r);
     }
 #pragma GCC diagnostic pop
@@ -57,13 +70,7 @@ struct MurmurHasher : public Hasher<KeyT, use_modulo> {
 
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const { return this->finalize(static_hash(key)); }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "MurmurModHasher";
-    } else {
-      return "MurmurBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "Murmur" + this->finalizer_identifier() + "Hasher"; }
 };
 
 }  // namespace hashmap::hashing
@@ -9,8 +9,8 @@ namespace hashmap::hashing {
 
 // Enforces collisions for testing
 template <typename KeyT>
-struct StaticHasher : public Hasher<KeyT, true> {
-  StaticHasher(uint64_t maximum_value) : Hasher<KeyT, true>(maximum_value) {}
+struct StaticHasher : public Hasher<KeyT, finalizer::MODULO> {
+  StaticHasher(uint64_t maximum_value) : Hasher<KeyT, finalizer::MODULO>(maximum_value) {}
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& /*key*/) { return 0; }
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& /*key*/) const { return 0; }
 
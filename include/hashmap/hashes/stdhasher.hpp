@@ -8,9 +8,9 @@
 
 namespace hashmap::hashing {
 
-template <typename KeyT, bool use_modulo>
-struct StdHasher : public Hasher<KeyT, use_modulo> {
-  StdHasher(uint64_t maximum_value) : Hasher<KeyT, use_modulo>(maximum_value) {}
+template <typename KeyT, Finalizer range_finalizer>
+struct StdHasher : public Hasher<KeyT, range_finalizer> {
+  StdHasher(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) { return std::hash<KeyT>()(key); }
   HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const { return this->finalize(static_hash(key)); }
 
@@ -44,13 +44,7 @@ struct StdHasher : public Hasher<KeyT, use_modulo> {
     return hash;
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "StdModHasher";
-    } else {
-      return "StdBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "Std" + this->finalizer_identifier() + "Hasher"; }
 };
 
 }  // namespace hashmap::hashing
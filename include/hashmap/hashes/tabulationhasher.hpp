@@ -0,0 +1,226 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "hashmap/hashes/buckethash.hpp"
+#include "hashmap/hashes/hasher.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+
+namespace hashmap::hashing {
+
+namespace tabulation {
+
+// A 64-bit key is split into 8 characters of 8 bits, each character indexes its own table of 256 random words
+constexpr static uint8_t num_characters = 8;
+constexpr static uint64_t table_size = 256;
+
+// Twisted tabulation needs a twister next to each hash word, hence its entries are 128 bits (16 KiB vs. 32 KiB in total)
+template <bool twisted>
+struct Tables {
+  constexpr static uint64_t stride = twisted ? 2 : 1;
+  alignas(utils::cacheline_size) std::array<std::array<uint64_t, table_size * stride>, num_characters> entries;
+};
+
+constexpr uint64_t splitmix64(uint64_t& state) {
+  uint64_t z = (state += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30U)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27U)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31U);
+}
+
+template <bool twisted>
+constexpr Tables<twisted> make_tables(uint64_t seed) {
+  Tables<twisted> tables{};
+  for (auto& table : tables.entries) {
+    for (uint64_t& entry : table) {
+      entry = splitmix64(seed);
+    }
+  }
+  return tables;
+}
+
+// The tables are shared by all hasher instances, such that static_hash works and all tables together stay L1-resident
+template <bool twisted>
+alignas(utils::cacheline_size) inline constexpr Tables<twisted> tables = make_tables<twisted>(0x2545F4914F6CDD1D);
+
+}  // namespace tabulation
+
+// Simple tabulation hashing (Zobrist/Carter-Wegman): XOR of one random table word per key byte. Unlike multiply-shift, all output bits depend
+// on all key bytes, which avoids long probe sequences for structured keys (e.g., keys whose LSBs are zero). Twisted tabulation (Patrascu and
+// Thorup) additionally XORs the twisters of the first seven characters onto the last character before its lookup, which gives stronger
+// guarantees (e.g., for linear probing) at the cost of 16-byte entries.
+template <typename KeyT, Finalizer range_finalizer, bool twisted = false>
+struct TabulationHasher : public Hasher<KeyT, range_finalizer> {
+  static_assert(!std::is_same_v<KeyT, StringKey>, "Tabulation hashing supports integer and composite keys only, use the xxHasher for strings.");
+
+  TabulationHasher(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
+
+  HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) {
+    if constexpr (utils::is_composite_key_v<KeyT>) {
+      // Fold the columns into the state one after another, as for Murmur
+      uint64_t x = 0;
+      for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+        x = hash_word(x ^ key.columns[column]);
+      }
+      return x;
+    } else {
+      return hash_word(static_cast<uint64_t>(key));
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE uint64_t hash(const KeyT& key) const { return this->finalize(static_hash(key)); }
+
+  // The table lookups of a batch are independent, hence with AVX-512 (AVX2), one gather per character hashes 8 (4) keys at once
+  HEDLEY_ALWAYS_INLINE static void static_hash_batch(const KeyT* keys, uint64_t* hashes, uint64_t count) {
+    uint64_t i = 0;
+#if defined(HASHMAP_IS_X86) && !defined(HASHMAP_USE_SCALAR_IMPL)
+    if constexpr (std::is_same_v<KeyT, uint64_t>) {
+#ifdef __AVX512F__
+      for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_si512(hashes + i, hash_words_avx512(_mm512_loadu_si512(keys + i)));
+      }
+#endif
+#ifdef __AVX2__
+      for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes + i),
+                            hash_words_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i))));
+      }
+#endif
+    }
+#endif
+    for (; i < count; ++i) {
+      hashes[i] = static_hash(keys[i]);
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE void hash_batch(const KeyT* keys, uint64_t* hashes, uint64_t count) const {
+    static_hash_batch(keys, hashes, count);
+    for (uint64_t i = 0; i < count; ++i) {
+      hashes[i] = this->finalize(hashes[i]);
+    }
+  }
+
+  template <typename FingerprintT, FingerprintBucketBits fbb, FingerprintT invalid_fp = 0>
+  HEDLEY_ALWAYS_INLINE BucketHash<FingerprintT> bucket_hash(const KeyT& key) {
+    const uint64_t r = static_hash(key);
+    BucketHash<FingerprintT> hash{};
+
+    static_assert(fbb != FingerprintBucketBits::LSBMSB,
+                  "For tabulation hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types "
+                  "of hashing.");
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    if constexpr (fbb == FingerprintBucketBits::LSBMSB) {
+      FAIL(
+          "For tabulation hashing, please do not use LSB/MSB, and use MSB/LSB instead. LSB/MSB is only relevant for multiply-shift types of "
+          "hashing.");
+    } else if constexpr (fbb == FingerprintBucketBits::MSBLSB) {
+      constexpr uint64_t fp_shift_factor = 64 - (sizeof(FingerprintT) * 8);
+
+      hash.bucket = this->finalize(r);
+      hash.fingerprint = r >> fp_shift_factor;
+    } else {
+      hash.bucket = this->finalize(r);
+      hash.fingerprint = static_cast<FingerprintT>(r);
+    }
+#pragma GCC diagnostic pop
+
+    if (HEDLEY_UNLIKELY(hash.fingerprint == invalid_fp)) {
+      ++(hash.fingerprint);
+    }
+    return hash;
+  }
+
+  std::string get_identifier() const {
+    const std::string variant = twisted ? "TwistedTabulation" : "Tabulation";
+    return variant + this->finalizer_identifier() + "Hasher";
+  }
+
+ private:
+  constexpr static uint64_t stride = tabulation::Tables<twisted>::stride;
+
+  HEDLEY_ALWAYS_INLINE static uint64_t hash_word(uint64_t x) {
+    const auto& entries = tabulation::tables<twisted>.entries;
+    uint64_t h = 0;
+
+    if constexpr (twisted) {
+      uint64_t twister = 0;
+      for (uint8_t character = 0; character < tabulation::num_characters - 1; ++character) {
+        const uint64_t* entry = &entries[character][(x & 0xFFU) * stride];
+        h ^= entry[0];
+        twister ^= entry[1];
+        x >>= 8U;
+      }
+      h ^= entries[tabulation::num_characters - 1][((x ^ twister) & 0xFFU) * stride];
+    } else {
+      for (uint8_t character = 0; character < tabulation::num_characters; ++character) {
+        h ^= entries[character][x & 0xFFU];
+        x >>= 8U;
+      }
+    }
+    return h;
+  }
+
+#if defined(HASHMAP_IS_X86) && !defined(HASHMAP_USE_SCALAR_IMPL)
+#ifdef __AVX512F__
+  // The masked variants avoid GCC's _mm512_undefined_epi32 in the unmasked intrinsics, which triggers -Wuninitialized
+  HEDLEY_ALWAYS_INLINE static __m512i hash_words_avx512(const __m512i x) {
+    const auto& entries = tabulation::tables<twisted>.entries;
+    const __m512i byte_mask = _mm512_set1_epi64(0xFF);
+    const __m512i zero = _mm512_setzero_si512();
+    constexpr __mmask8 all_lanes = 0xFF;
+    __m512i h = zero;
+    __m512i twister = zero;
+
+    utils::loop<uint8_t, tabulation::num_characters>([&](auto character) {
+      __m512i index = _mm512_and_si512(_mm512_maskz_srli_epi64(all_lanes, x, 8 * character), byte_mask);
+      if constexpr (twisted && character == tabulation::num_characters - 1) {
+        index = _mm512_and_si512(_mm512_xor_si512(index, twister), byte_mask);
+      }
+      if constexpr (twisted) {
+        index = _mm512_maskz_slli_epi64(all_lanes, index, 1);
+      }
+
+      h = _mm512_xor_si512(h, _mm512_mask_i64gather_epi64(zero, all_lanes, index, entries[character].data(), sizeof(uint64_t)));
+      if constexpr (twisted && character < tabulation::num_characters - 1) {
+        twister = _mm512_xor_si512(twister,
+                                   _mm512_mask_i64gather_epi64(zero, all_lanes, index, entries[character].data() + 1, sizeof(uint64_t)));
+      }
+    });
+    return h;
+  }
+#endif
+
+#ifdef __AVX2__
+  HEDLEY_ALWAYS_INLINE static __m256i hash_words_avx2(const __m256i x) {
+    const auto& entries = tabulation::tables<twisted>.entries;
+    const __m256i byte_mask = _mm256_set1_epi64x(0xFF);
+    __m256i h = _mm256_setzero_si256();
+    __m256i twister = _mm256_setzero_si256();
+
+    utils::loop<uint8_t, tabulation::num_characters>([&](auto character) {
+      __m256i index = _mm256_and_si256(_mm256_srli_epi64(x, 8 * character), byte_mask);
+      if constexpr (twisted && character == tabulation::num_characters - 1) {
+        index = _mm256_and_si256(_mm256_xor_si256(index, twister), byte_mask);
+      }
+      if constexpr (twisted) {
+        index = _mm256_slli_epi64(index, 1);
+      }
+
+      const auto* table = reinterpret_cast<const long long*>(entries[character].data());
+      h = _mm256_xor_si256(h, _mm256_i64gather_epi64(table, index, sizeof(uint64_t)));
+      if constexpr (twisted && character < tabulation::num_characters - 1) {
+        twister = _mm256_xor_si256(twister, _mm256_i64gather_epi64(table + 1, index, sizeof(uint64_t)));
+      }
+    });
+    return h;
+  }
+#endif
+#endif
+};
+
+}  // namespace hashmap::hashing
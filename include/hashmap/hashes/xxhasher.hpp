@@ -16,9 +16,9 @@
 
 namespace hashmap::hashing {
 
-template <typename KeyT, bool use_modulo>
-struct XXHasherBase : public Hasher<KeyT, use_modulo> {
-  XXHasherBase(uint64_t maximum_value) : Hasher<KeyT, use_modulo>(maximum_value) {}
+template <typename KeyT, Finalizer range_finalizer>
+struct XXHasherBase : public Hasher<KeyT, range_finalizer> {
+  XXHasherBase(uint64_t maximum_value) : Hasher<KeyT, range_finalizer>(maximum_value) {}
 
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const KeyT& key) { return static_cast<uint64_t>(XXH3_64bits(&key, key_len)); }
 
@@ -50,24 +50,18 @@ struct XXHasherBase : public Hasher<KeyT, use_modulo> {
     return hash;
   }
 
-  std::string get_identifier() const {
-    if constexpr (use_modulo) {
-      return "XXModHasher";
-    } else {
-      return "XXBitHasher";
-    }
-  }
+  std::string get_identifier() const { return "XX" + this->finalizer_identifier() + "Hasher"; }
 
  private:
   alignas(utils::cacheline_size) constexpr static size_t key_len = sizeof(KeyT);
 };
 
-template <typename KeyT, bool use_modulo>
-struct XXHasher : public XXHasherBase<KeyT, use_modulo> {};
+template <typename KeyT, Finalizer range_finalizer>
+struct XXHasher : public XXHasherBase<KeyT, range_finalizer> {};
 
-template <bool use_modulo>
-struct XXHasher<StringKey, use_modulo> : public XXHasherBase<StringKey, use_modulo> {
-  XXHasher(uint64_t maximum_value) : XXHasherBase<StringKey, use_modulo>(maximum_value) {}
+template <Finalizer range_finalizer>
+struct XXHasher<StringKey, range_finalizer> : public XXHasherBase<StringKey, range_finalizer> {
+  XXHasher(uint64_t maximum_value) : XXHasherBase<StringKey, range_finalizer>(maximum_value) {}
 
   HEDLEY_ALWAYS_INLINE static uint64_t static_hash(const StringKey& key) {
     DEBUG_ASSERT(key.string_ != nullptr, "String of key cannot be nullptr.");
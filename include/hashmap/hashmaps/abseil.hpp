@@ -79,6 +79,9 @@ class AbseilFlatHashTable : public HashTable<KeyT, ValueT> {
   }
   uint64_t get_entry_size() { return std::numeric_limits<uint64_t>::max(); }
 
+  // Abseil stores one control byte per slot next to the slot array (ignoring the cloned control bytes of the last group)
+  uint64_t memory_usage() const { return static_cast<uint64_t>(map_.capacity()) * (sizeof(std::pair<const KeyT, ValueT>) + 1); }
+
   bool is_data_aligned_to(size_t /* alignment */) { return false; }
 
   std::string get_data_pointer_string() { return "0x0"; }
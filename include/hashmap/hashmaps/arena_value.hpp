@@ -0,0 +1,159 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/misc/value_arena.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Value-indirection mode for large values: the underlying hash table (SlotHashTableT) only stores 32-bit slot ids next to the keys,
+// the values themselves live in a chunked (huge page backed) ValueArena owned by this table.
+// This keeps the probed cache lines dense for large tuples, and lookup_ref returns a pointer into the arena instead of copying the value.
+// Slot ids are stored +1 such that the default value 0 of the underlying table denotes a missing key.
+template <typename KeyT, typename ValueT, typename SlotHashTableT, bool use_thp = true>
+class ArenaValueHashTable : public HashTable<KeyT, ValueT> {
+ public:
+  using ArenaT = ValueArena<ValueT, use_thp>;
+  using SlotT = typename ArenaT::SlotT;
+
+  static_assert(std::is_same_v<decltype(std::declval<SlotHashTableT&>().lookup(std::declval<const KeyT&>())), SlotT>,
+                "The underlying hash table needs to store 32-bit slot ids as values!");
+
+  ArenaValueHashTable(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true,
+                      std::string base_identifier = "ArenaValueHashTable")
+      : slots_{construct_hashtable<SlotHashTableT>(max_elements, target_load_factor, print_info)},
+        max_elements_{max_elements},
+        base_identifier_{base_identifier} {
+    ASSERT(max_elements < ArenaT::max_values, "Too many elements for 32-bit slot ids!");
+
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} with ArenaT::values_per_chunk = {}, sizeof(ValueT) = {}", get_identifier(), ArenaT::values_per_chunk,
+                               sizeof(ValueT)));
+    }
+  }
+
+  bool contains(const KeyT& key) { return slots_.contains(key); }
+
+  // The returned pointer stays valid until the next reset, as arena chunks are never moved.
+  HEDLEY_ALWAYS_INLINE const ValueT* lookup_ref(const KeyT& key) {
+    const SlotT slot = slots_.lookup(key);
+    return slot != empty_slot ? &arena_[slot - 1] : nullptr;
+  }
+
+  ValueT lookup(const KeyT& key) {
+    const ValueT* value = lookup_ref(key);
+    if constexpr (std::is_pointer_v<ValueT>) {
+      return value != nullptr ? *value : nullptr;
+    } else {
+      return value != nullptr ? *value : ValueT{};
+    }
+  }
+
+  void insert(const KeyT& key, const ValueT& value) {
+    if constexpr (requires(SlotHashTableT& slots) { slots.lookup_or_insert(key, empty_slot); }) {
+      // Single probe: a missing key gets the slot id of the next allocation, otherwise we receive the key's existing slot id
+      const auto next_slot = static_cast<SlotT>(arena_.size() + 1);
+      const SlotT slot = slots_.lookup_or_insert(key, next_slot);
+      if (slot != next_slot) {
+        arena_[slot - 1] = value;
+        return;
+      }
+
+      DEBUG_ASSERT(arena_.size() < max_elements_, "Hashmap is full!");
+      arena_.allocate(value);
+    } else {
+      // The slot table cannot insert during a lookup, hence new keys are probed twice. Compare inserts against slot tables with
+      // lookup_or_insert (linear probing AoS, bucketing SIMD) with this in mind.
+      const SlotT slot = slots_.lookup(key);
+      if (slot != empty_slot) {
+        arena_[slot - 1] = value;
+        return;
+      }
+
+      DEBUG_ASSERT(arena_.size() < max_elements_, "Hashmap is full!");
+      slots_.insert(key, arena_.allocate(value) + 1);
+    }
+  }
+
+  void prefault() {
+    slots_.prefault();
+    arena_.reserve(max_elements_);
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+    std::vector<std::pair<KeyT, SlotT>> slot_prefault_data;
+    slot_prefault_data.reserve(prefault_data.size());
+    for (const auto& [key, value] : prefault_data) {
+      slot_prefault_data.emplace_back(key, static_cast<SlotT>(slot_prefault_data.size() + 1));
+    }
+    slots_.prefault_pregenerated(slot_prefault_data);
+
+    arena_.reserve(max_elements_);
+    for (uint64_t i = 0; i < max_elements_ && !prefault_data.empty(); ++i) {
+      arena_.allocate(prefault_data[i % prefault_data.size()].second);
+    }
+
+    reset();
+  }
+
+  // Resetting the arena is O(1), its chunks are kept for subsequent inserts.
+  void reset() {
+    slots_.reset();
+    arena_.reset();
+  }
+
+  // Frees the memory of all values at once, in contrast to reset().
+  void release() {
+    slots_.reset();
+    arena_.release();
+  }
+
+  std::string get_identifier() {
+    std::string thp = "NoTHP";
+    if constexpr (use_thp) {
+      thp = "THP";
+    }
+
+    std::string value_type = hashmap::utils::data_type_to_str<ValueT>();
+    return fmt::format("{}<{}; {}; {}>", base_identifier_, slots_.get_identifier(), value_type, thp);
+  }
+
+  uint64_t get_entry_size() { return slots_.get_entry_size() + static_cast<uint64_t>(sizeof(ValueT)); }
+
+  uint64_t memory_usage() const { return slots_.memory_usage() + arena_.allocated_bytes(); }
+
+  bool is_data_aligned_to(size_t alignment) { return slots_.is_data_aligned_to(alignment); }
+
+  std::string get_data_pointer_string() { return fmt::format("{}; arena: {}", slots_.get_data_pointer_string(), (void*)arena_.data()); }
+
+  double get_current_load() { return slots_.get_current_load(); }
+
+  uint64_t get_current_size() { return slots_.get_current_size(); }
+
+  const ArenaT& get_arena() const { return arena_; }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return slots_.get_minfo(); }
+  void start_measurement() { slots_.start_measurement(); }
+  void stop_measurement() { slots_.stop_measurement(); }
+#endif
+
+ protected:
+  static constexpr SlotT empty_slot = 0;
+
+  SlotHashTableT slots_;
+  ArenaT arena_;
+  uint64_t max_elements_;
+  std::string base_identifier_;
+};
+
+}  // namespace hashmap::hashmaps
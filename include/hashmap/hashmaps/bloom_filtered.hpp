@@ -0,0 +1,167 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/misc/blocked_bloom_filter.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Blocked Bloom filter in front of an arbitrary hash table (HashTableT) for miss-heavy workloads, e.g., semi and anti joins.
+// Every insert also sets the key's bits in the filter, and lookups that the filter rejects never touch the table.
+// As the filter is pure overhead for hits, we sample the rejection rate every sample_interval filtered lookups. If the filter rejected
+// less than skip_below_rejection_rate percent, it is bypassed for the next skip_interval lookups, after which we measure again.
+template <typename KeyT, typename ValueT, typename HashTableT, typename HasherT, uint8_t bits_per_key = 8, uint8_t skip_below_rejection_rate = 25,
+          bool use_thp = false>
+class BloomFilteredHashTable : public HashTable<KeyT, ValueT> {
+ public:
+  using FilterT = BlockedBloomFilter<use_thp>;
+
+  static constexpr uint64_t sample_interval = 4096;
+  static constexpr uint64_t skip_interval = 16 * sample_interval;
+
+  BloomFilteredHashTable(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true,
+                         std::string base_identifier = "BloomFilteredHashTable")
+      : hashtable_{construct_hashtable<HashTableT>(max_elements, target_load_factor, print_info)},
+        filter_(FilterT::cachelines_for(max_elements, bits_per_key)),
+        base_identifier_{base_identifier} {
+    static_assert(bits_per_key > 0, "The Bloom filter needs at least one bit per key!");
+    static_assert(skip_below_rejection_rate <= 100, "The rejection rate is a percentage!");
+
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} with a Bloom filter of {} cache lines ({} bytes)", get_identifier(), filter_.num_cachelines(),
+                               filter_.size_in_bytes()));
+    }
+  }
+
+  bool contains(const KeyT& key) {
+    if (filter_rejects(key)) {
+      return false;
+    }
+
+    return hashtable_.contains(key);
+  }
+
+  ValueT lookup(const KeyT& key) {
+    if (filter_rejects(key)) {
+      if constexpr (std::is_pointer_v<ValueT>) {
+        return nullptr;
+      } else {
+        return ValueT{};
+      }
+    }
+
+    return hashtable_.lookup(key);
+  }
+
+  void insert(const KeyT& key, const ValueT& value) {
+    filter_.insert(filter_hash(key));
+    hashtable_.insert(key, value);
+  }
+
+  void prefault() {
+    hashtable_.prefault();
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+    hashtable_.prefault_pregenerated(prefault_data);
+    reset();
+  }
+
+  void reset() {
+    hashtable_.reset();
+    filter_.clear();
+    sampled_lookups_ = 0;
+    sampled_rejections_ = 0;
+    skipped_lookups_left_ = 0;
+    filter_checks_ = 0;
+    filter_rejections_ = 0;
+  }
+
+  std::string get_identifier() {
+    return fmt::format("{}<{}; {}; {}BPK; {}SkipBelow; {}>", base_identifier_, hashtable_.get_identifier(), HasherT(0).get_identifier(), bits_per_key,
+                       skip_below_rejection_rate, use_thp ? "THP" : "NoTHP");
+  }
+
+  uint64_t get_entry_size() { return hashtable_.get_entry_size(); }
+
+  uint64_t memory_usage() const { return hashtable_.memory_usage() + filter_.size_in_bytes(); }
+
+  bool is_data_aligned_to(size_t alignment) { return hashtable_.is_data_aligned_to(alignment); }
+
+  std::string get_data_pointer_string() { return hashtable_.get_data_pointer_string(); }
+
+  double get_current_load() { return hashtable_.get_current_load(); }
+
+  uint64_t get_current_size() { return hashtable_.get_current_size(); }
+
+  bool is_filter_skipped() const { return skipped_lookups_left_ > 0; }
+
+  // Lookups that checked the filter (i.e., excluding the skipped ones), and how many of them it rejected without probing the table
+  uint64_t get_num_filter_checks() const { return filter_checks_; }
+  uint64_t get_num_filter_rejections() const { return filter_rejections_; }
+
+  const FilterT& get_filter() const { return filter_; }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return hashtable_.get_minfo(); }
+  void start_measurement() { hashtable_.start_measurement(); }
+  void stop_measurement() { hashtable_.stop_measurement(); }
+#endif
+
+ protected:
+  // The table's hasher may be as simple as the identity, hence we mix its output before deriving the block and the bit positions
+  HEDLEY_ALWAYS_INLINE static uint64_t filter_hash(const KeyT& key) {
+    return hashing::MurmurHasher<uint64_t, false>::static_hash(static_cast<uint64_t>(HasherT::static_hash(key)));
+  }
+
+  HEDLEY_ALWAYS_INLINE bool filter_rejects(const KeyT& key) {
+    if (HEDLEY_UNLIKELY(skipped_lookups_left_ > 0)) {
+      --skipped_lookups_left_;
+      return false;
+    }
+
+    const bool rejected = !filter_.may_contain(filter_hash(key));
+
+#ifdef HASHMAP_COLLECT_META_INFO
+    utils::MeasurementInfo* minfo = hashtable_.get_minfo();
+    if (minfo->measurement_started) {
+      ++(minfo->num_filter_checks);
+      minfo->num_filter_rejections += rejected ? 1 : 0;
+    }
+#endif
+
+    ++filter_checks_;
+    filter_rejections_ += rejected ? 1 : 0;
+    sampled_rejections_ += rejected ? 1 : 0;
+    if (HEDLEY_UNLIKELY(++sampled_lookups_ == sample_interval)) {
+      if (sampled_rejections_ * 100 < sampled_lookups_ * skip_below_rejection_rate) {
+        skipped_lookups_left_ = skip_interval;
+      }
+      sampled_lookups_ = 0;
+      sampled_rejections_ = 0;
+    }
+
+    return rejected;
+  }
+
+  HashTableT hashtable_;
+  FilterT filter_;
+  uint64_t sampled_lookups_ = 0;
+  uint64_t sampled_rejections_ = 0;
+  uint64_t skipped_lookups_left_ = 0;
+  uint64_t filter_checks_ = 0;
+  uint64_t filter_rejections_ = 0;
+  std::string base_identifier_;
+};
+
+}  // namespace hashmap::hashmaps
@@ -0,0 +1,416 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashes/buckethash.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/simd_utils.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Chain node of the BucketChainedSIMDHashTable: a mini bucket of slots_per_node key/value pairs, searched via one SIMD fingerprint comparison.
+// The fingerprints and the next pointer come first, such that a miss only touches the first cache line of every node in the chain.
+template <typename KeyT, typename ValueT, typename FingerprintT, typename SIMDH, SIMDAlgorithm simd_algo, uint8_t slots_per_node,
+          uint8_t fps_per_vector_, bool use_sve>
+struct alignas(utils::cacheline_size) SIMDChainNode {
+  static_assert(slots_per_node > 0 && slots_per_node <= fps_per_vector_, "The fingerprints of all slots of a node need to fit into one vector!");
+
+  static constexpr int16_t no_match = -1;
+
+  using vector_type = typename SIMDH::vector_type;
+  using MaskOrVectorInputType = typename SIMDH::MaskOrVectorInputType;
+  using LoadPtrT = typename SIMDH::LoadPtrT;
+  using CompareT = typename SIMDH::CompareT;
+  using CompareResultIterator = typename SIMDH::CompareResultIterator;
+  using MaskIteratorT = typename CompareResultIterator::MaskIteratorT;
+
+  explicit SIMDChainNode(FingerprintT invalid_fingerprint) { reset(invalid_fingerprint); }
+
+  void reset(FingerprintT invalid_fingerprint) {
+    std::fill(std::begin(fingerprints), std::end(fingerprints), invalid_fingerprint);
+    std::fill(std::begin(keys_values), std::end(keys_values), std::make_pair(KeyT(), ValueT()));
+    next = nullptr;
+    num_entries = 0;
+  }
+
+  // Returns the slot of key or no_match. The fingerprints of unused slots are invalid and thus never match.
+  HEDLEY_ALWAYS_INLINE int16_t find(const KeyT& key, const FingerprintT& fingerprint) {
+    vector_type index_vector;
+#if defined(__ARM_FEATURE_SVE)
+    if constexpr (use_sve) {
+      index_vector = SIMDH::index_creation_func_();
+    }
+#else
+    (void)index_vector;
+#endif
+
+    const vector_type fingerprint_vector = SIMDH::vector_load_func_(reinterpret_cast<LoadPtrT>(&fingerprints[0]));
+    const CompareT compare_vector = SIMDH::vector_broadcast_func_(fingerprint);
+
+    MaskOrVectorInputType cmp_result;
+    if constexpr (utils::is_power) {
+      cmp_result = SIMDH::vector_cmp_func_(fingerprint_vector, compare_vector, false);
+    } else {
+      cmp_result = SIMDH::vector_cmp_func_(fingerprint_vector, compare_vector);
+    }
+
+    if constexpr (simd_algo == SIMDAlgorithm::TESTZ) {
+      if (!SIMDH::vector_any_nonzero(cmp_result)) {
+        return no_match;
+      }
+    } else {
+      static_assert(simd_algo == SIMDAlgorithm::NO_TESTZ, "Chain nodes support TESTZ and NO_TESTZ only.");
+    }
+
+    MaskIteratorT iterator = CompareResultIterator::initialize(cmp_result);
+    while (CompareResultIterator::has_next(iterator)) {
+      uint16_t next_match = 0;
+      if constexpr (use_sve) {
+        next_match = CompareResultIterator::sve_next_match(iterator, index_vector);
+      } else {
+        next_match = CompareResultIterator::next_match(iterator);
+      }
+
+      iterator = CompareResultIterator::next_it(iterator, next_match);
+      if (keys_values[next_match].first == key) {
+        return static_cast<int16_t>(next_match);
+      }
+    }
+
+    return no_match;
+  }
+
+  HEDLEY_ALWAYS_INLINE void insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint) {
+    DEBUG_ASSERT(num_entries < slots_per_node, "Chain node is full!");
+    fingerprints[num_entries] = fingerprint;
+    keys_values[num_entries++] = {key, value};
+  }
+
+  alignas(SIMDH::_vector_alignment()) std::array<FingerprintT, fps_per_vector_> fingerprints;
+  SIMDChainNode* next;
+  uint8_t num_entries;
+  std::array<std::pair<KeyT, ValueT>, slots_per_node> keys_values;
+};
+
+// Bucketized chaining: the directory points to chains of cache-line-aligned nodes with slots_per_node entries each instead of chains of single
+// entries. A chain of k entries hence costs about k / slots_per_node dependent misses, and the fingerprints filter the key comparisons. New nodes
+// are prepended to their chain, such that only the head of a chain may have free slots.
+// As the ChainedHashTable, the table is sized from a memory budget: the largest power-of-two directory that leaves enough nodes for the expected
+// number of elements, and the rest of the budget goes to additional nodes. Hence it can be compared to the BucketingSIMDHashTable at equal memory.
+template <typename KeyT, typename ValueT, typename HasherT, typename FingerprintT = uint16_t, uint8_t slots_per_node = 6, uint16_t simd_size = 128,
+          SIMDAlgorithm simd_algo = SIMDAlgorithm::TESTZ, bool use_avx512_features = false, bool use_sve = false,
+          NEONAlgo neon_algo = NEONAlgo::SSE2NEON, bool sve_scalar_broadcast = false, bool use_thp = false,
+          MemoryBudget budget = MemoryBudget::Bucket16FP, uint8_t additional_budget = 10,
+          bool set_bool_on_invalid_budget = false, hashing::FingerprintBucketBits fingerprint_bucket_bits = hashing::FingerprintBucketBits::MSBLSB,
+          FingerprintT invalid_fingerprint = 0>
+class BucketChainedSIMDHashTable : public HashTable<KeyT, ValueT> {
+ public:
+  using SIMDH = SIMDHelper<FingerprintT, simd_size, simd_algo, use_avx512_features, use_thp, use_sve, neon_algo, sve_scalar_broadcast>;
+  using NodeT = SIMDChainNode<KeyT, ValueT, FingerprintT, SIMDH, simd_algo, slots_per_node, (simd_size / 8) / sizeof(FingerprintT), use_sve>;
+
+  struct FindResult {
+    uint64_t directory_idx = 0;
+    NodeT* node = nullptr;
+    int16_t index_in_node = NodeT::no_match;
+    bool is_valid = false;
+    FingerprintT fingerprint = invalid_fingerprint;
+  };
+
+  static uint64_t calculate_memory_budget(const uint64_t& max_elements) {
+    const double additional_factor = 1.0 + (static_cast<double>(additional_budget) / 100.0);
+    uint64_t entry_size = sizeof(KeyT) + sizeof(ValueT);
+
+    if constexpr (budget == MemoryBudget::Bucket8FP) {
+      entry_size += 1;  // 1 byte fingerprint
+    } else if constexpr (budget == MemoryBudget::Bucket16FP) {
+      entry_size += 2;  // 2 byte fingerprint
+    }
+
+    return static_cast<uint64_t>(std::ceil(additional_factor * static_cast<double>(entry_size) * static_cast<double>(max_elements)));
+  }
+
+  // Returns the number of directory slots and nodes. Every chain has at most one node with free slots, hence load_factor_elements entries need
+  // at most load_factor_elements / slots_per_node full nodes plus one partial node per (non-empty) directory slot. We size for this worst case
+  // instead of the expected waste of half a node per chain, as hash functions that spread dense keys evenly (e.g., multiply-shift) give all
+  // chains the same length and thus the same number of free slots. The largest power-of-two directory that fits into the budget is used. At high
+  // load factors and small budgets, this means long chains (e.g., about 38 nodes per chain for 16-bit fingerprints at 90% load, as the full
+  // nodes alone need 97% of that budget), but the table stays usable and the comparison at equal memory stays complete.
+  static std::pair<uint64_t, uint64_t> calculate_directory_buffer_size(const uint64_t& max_elements, const uint8_t& target_load_factor) {
+    const uint64_t load_factor_elements =
+        static_cast<uint64_t>(std::ceil((static_cast<double>(target_load_factor) / 100.0) * static_cast<double>(max_elements)));
+    const uint64_t memory_budget = calculate_memory_budget(max_elements);
+
+    for (uint64_t directory_size = std::bit_floor(std::max(max_elements / slots_per_node, static_cast<uint64_t>(1))); directory_size > 0;
+         directory_size >>= 1U) {
+      const uint64_t directory_memory_usage = directory_size * sizeof(NodeT*);
+      const uint64_t required_nodes = load_factor_elements / slots_per_node + std::min(directory_size, load_factor_elements);
+
+      if (directory_memory_usage + required_nodes * sizeof(NodeT) <= memory_budget) {
+        const uint64_t num_nodes = (memory_budget - directory_memory_usage) / sizeof(NodeT);
+        spdlog::debug(fmt::format("Got a memory budget of {}, will insert {} elements, chose directory size {} and {} nodes", memory_budget,
+                                  load_factor_elements, directory_size, num_nodes));
+        return std::make_pair(directory_size, num_nodes);
+      }
+    }
+
+    if constexpr (!set_bool_on_invalid_budget) {
+      FAIL("Memory budget too small.");
+    } else {
+      spdlog::warn("Warning. Setting bool on invalid budget. Make sure to know what you are doing.");
+    }
+
+    return std::make_pair(0, 0);
+  }
+
+  BucketChainedSIMDHashTable(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true)
+      : directory_buffer_size_{calculate_directory_buffer_size(max_elements, target_load_factor)},
+        directory_(directory_buffer_size_.first, nullptr),
+        nodes_(directory_buffer_size_.second, NodeT(invalid_fingerprint)),
+        max_elements_{max_elements},
+        size_{0},
+        hasher_(std::max(directory_buffer_size_.first, static_cast<uint64_t>(1))),
+        next_free_node_{0},
+        invalid_budget_{directory_buffer_size_.first == 0} {
+    fail_if_system_is_incompatible<FingerprintT, simd_size, simd_algo, use_avx512_features, use_sve, neon_algo, sve_scalar_broadcast>();
+
+    if (invalid_budget_) {
+      spdlog::error("Got invalid budget, but setting bool instead. Make sure to check this bool and not use the hashmap.");
+      directory_.assign(1, nullptr);
+    }
+
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} with sizeof(NodeT) = {}, memory budget = {}", get_identifier(), sizeof(NodeT),
+                               calculate_memory_budget(max_elements)));
+    }
+  }
+
+  bool contains(const KeyT& key) { return find(key).is_valid; }
+
+  ValueT lookup(const KeyT& key) {
+    const FindResult res = find(key);
+
+    if constexpr (std::is_pointer_v<ValueT>) {
+      return !res.is_valid ? nullptr : res.node->keys_values[res.index_in_node].second;
+    } else {
+      return !res.is_valid ? ValueT{} : res.node->keys_values[res.index_in_node].second;
+    }
+  };
+
+  void insert(const KeyT& key, const ValueT& value) {
+    DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+    const FindResult res = find(key);
+
+    if (res.is_valid) {
+      DEBUG_ASSERT(res.node->keys_values[res.index_in_node].first == key, "Got valid result with non-matching key.");
+      res.node->keys_values[res.index_in_node].second = value;
+      return;
+    }
+
+    NodeT* head = directory_[res.directory_idx];
+    if (head == nullptr || head->num_entries == slots_per_node) {
+      ASSERT(next_free_node_ < nodes_.size(), "Buffer is full");
+      NodeT* new_head = &nodes_[next_free_node_++];
+      new_head->next = head;
+      directory_[res.directory_idx] = new_head;
+      head = new_head;
+    }
+
+    head->insert(key, value, res.fingerprint);
+    ++size_;
+  };
+
+  FindResult find(const KeyT& key) {
+#ifdef HASHMAP_COLLECT_META_INFO
+    uint64_t probing_seq_len = 0;
+    if (minfo.measurement_started) {
+      ++(minfo.num_finds);
+    }
+#endif
+
+    const hashing::BucketHash<FingerprintT> bucket_hash =
+        hasher_.template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(key);
+    const uint64_t directory_idx = bucket_hash.bucket;
+    const FingerprintT fingerprint = bucket_hash.fingerprint;
+
+    for (NodeT* node = directory_[directory_idx]; node != nullptr; node = node->next) {
+#ifdef HASHMAP_COLLECT_META_INFO
+      ++probing_seq_len;
+      if (minfo.measurement_started) {
+        ++(minfo.probed_elements);
+        ++(minfo.simd_loads);
+        minfo.probed_elements_total += node->num_entries;
+      }
+#endif
+      const int16_t index_in_node = node->find(key, fingerprint);
+      if (index_in_node != NodeT::no_match) {
+#ifdef HASHMAP_COLLECT_META_INFO
+        if (minfo.measurement_started) {
+          minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
+          minfo.max_probing_sequence = std::max(minfo.max_probing_sequence, probing_seq_len);
+        }
+#endif
+        return {directory_idx, node, index_in_node, true, fingerprint};
+      }
+    }
+
+    return {directory_idx, nullptr, NodeT::no_match, false, fingerprint};
+  }
+
+  void prefault() {
+    std::random_device rd;
+    std::mt19937 gen{rd()};
+    std::uniform_int_distribution<uint64_t> dist{0, 0xDEADBEEF};
+
+    for (uint64_t i = 0; i < directory_.size(); i++) {
+      directory_[i] = reinterpret_cast<NodeT*>(dist(gen));
+    }
+
+    for (NodeT& node : nodes_) {
+      for (uint8_t slot = 0; slot < slots_per_node; ++slot) {
+        node.fingerprints[slot] = static_cast<FingerprintT>(dist(gen));
+        if constexpr (!std::is_same_v<KeyT, StringKey> && !std::is_pointer_v<ValueT>) {
+          node.keys_values[slot] = {static_cast<KeyT>(dist(gen)), static_cast<ValueT>(dist(gen))};
+        }
+      }
+      node.next = reinterpret_cast<NodeT*>(dist(gen));
+    }
+
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+    const uint64_t prefault_data_size = prefault_data.size();
+    for (uint64_t i = 0; i < nodes_.size(); i++) {
+      for (uint8_t slot = 0; slot < slots_per_node; ++slot) {
+        nodes_[i].fingerprints[slot] = 42;
+        nodes_[i].keys_values[slot] = prefault_data[(i * slots_per_node + slot) % prefault_data_size];
+      }
+      nodes_[i].next = reinterpret_cast<NodeT*>(42);
+    }
+
+    reset();
+  }
+
+  void reset() {
+    std::fill(directory_.begin(), directory_.end(), nullptr);
+    for (NodeT& node : nodes_) {
+      node.reset(invalid_fingerprint);
+    }
+
+    next_free_node_ = 0;
+    size_ = 0;
+  }
+
+  std::string get_identifier() {
+    std::string thp = "NoTHP";
+    if constexpr (use_thp) {
+      thp = "THP";
+    }
+
+    std::string value_type = hashmap::utils::data_type_to_str<ValueT>();
+    std::string key_type = hashmap::utils::data_type_to_str<KeyT>();
+    std::string fingerprint_type = hashmap::utils::data_type_to_str<FingerprintT>();
+
+    std::string algo = simd_algo == SIMDAlgorithm::TESTZ ? "TESTZ" : "NO_TESTZ";
+    std::string avx512 = use_avx512_features ? "AVX512" : "NoAVX512";
+    std::string sve = use_sve ? "SVE" : "NoSVE";
+
+    std::string neon_algo_str = "SSE2NEON";
+    if constexpr (neon_algo == NEONAlgo::AARCH64) {
+      neon_algo_str = "AARCH64";
+    } else if constexpr (neon_algo == NEONAlgo::UMINV) {
+      neon_algo_str = "UMINV";
+    }
+
+    std::string fallback = "NoFallback";
+#ifdef HASHMAP_USE_SCALAR_IMPL
+    fallback = fmt::format("Fallback{}", simd_size);
+#endif
+
+    std::string fingerprints = "SomeLSBThing";
+    if constexpr (fingerprint_bucket_bits == hashing::FingerprintBucketBits::LSBLSB) {
+      fingerprints = "LSBLSB";
+    } else if constexpr (fingerprint_bucket_bits == hashing::FingerprintBucketBits::MSBLSB) {
+      fingerprints = "MSBLSB";
+    } else if constexpr (fingerprint_bucket_bits == hashing::FingerprintBucketBits::LSBMSB) {
+      fingerprints = "LSBMSB";
+    }
+
+    std::string memory_budget = "SomeUnknownMemBudget";
+    if constexpr (budget == MemoryBudget::KeyValue) {
+      memory_budget = "BudgetKV";
+    } else if constexpr (budget == MemoryBudget::Bucket8FP) {
+      memory_budget = "BudgetBucket8FP";
+    } else if constexpr (budget == MemoryBudget::Bucket16FP) {
+      memory_budget = "BudgetBucket16FP";
+    }
+
+    return fmt::format(
+        "BucketChainedSIMDHashTable<{}; {}; {}; {}; {}SlotsPerNode; NodeSize{}; {}; {}; {}; {}; {}; {}; {}; {}; AdditionalBudget{}; DirectorySize{}; "
+        "NumNodes{}>",
+        hasher_.get_identifier(), key_type, value_type, fingerprint_type, slots_per_node, sizeof(NodeT), thp, algo, avx512, sve, neon_algo_str,
+        fingerprints, fallback, memory_budget, additional_budget, directory_.size(), nodes_.size());
+  }
+
+  uint64_t get_entry_size() { return sizeof(NodeT); }
+
+  uint64_t memory_usage() const { return directory_.size() * sizeof(NodeT*) + nodes_.size() * sizeof(NodeT); }
+
+  bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)nodes_.data(), alignment); }
+
+  std::string get_data_pointer_string() { return fmt::format("{}", (void*)nodes_.data()); }
+
+  double get_current_load() { return static_cast<double>(size_) / static_cast<double>(max_elements_); }
+
+  uint64_t get_current_size() { return size_; }
+
+  uint64_t get_directory_size() const { return directory_.size(); }
+
+  uint64_t get_num_nodes() const { return nodes_.size(); }
+
+  uint64_t get_num_used_nodes() const { return next_free_node_; }
+
+  bool can_be_used() { return !invalid_budget_; }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return &minfo; }
+  void start_measurement() { minfo.measurement_started = true; }
+  void stop_measurement() { minfo.measurement_started = false; }
+  void reset_measurement() { minfo.reset(); }
+#endif
+
+ protected:
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<NodeT*>, std::allocator<NodeT*>>::type PtrVectorAllocator;
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<NodeT>, std::allocator<NodeT>>::type VectorAllocator;
+  std::pair<uint64_t, uint64_t> directory_buffer_size_;
+
+  alignas(utils::cacheline_size) std::vector<NodeT*, PtrVectorAllocator> directory_;
+  alignas(utils::cacheline_size) std::vector<NodeT, VectorAllocator> nodes_;
+  alignas(utils::cacheline_size) uint64_t max_elements_;
+  alignas(utils::cacheline_size) uint64_t size_;
+  alignas(utils::cacheline_size) HasherT hasher_;
+
+  alignas(utils::cacheline_size) uint64_t next_free_node_;
+
+  bool invalid_budget_;
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo minfo;
+#endif
+};
+
+}  // namespace hashmap::hashmaps
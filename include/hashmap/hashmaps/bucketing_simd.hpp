@@ -3,7 +3,11 @@
 #include <array>
 #include <cstdint>
 #include <iostream>
+#include <limits>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "fmt/format.h"
 #include "hashmap/hashes/buckethash.hpp"
@@ -15,29 +19,25 @@
 
 namespace hashmap::hashmaps {
 
+// Where a lookup continues after an overflowed bucket.
+// NEXT_BUCKET: the following buckets, i.e., linear probing on bucket granularity.
+// SECONDARY_BUCKET: first an alternative bucket derived from the home bucket and the fingerprint (as in cuckoo filters), then linear probing.
+// STASH: first a bucket of a small stash behind the regular buckets, selected like the secondary bucket, then linear probing.
+// For the latter two, a negative lookup on an overflowed bucket only touches two buckets unless the second one has overflowed as well.
+enum class BucketOverflowPolicy { NEXT_BUCKET, SECONDARY_BUCKET, STASH };
+
+// Fingerprints, fill level and overflow flag of a bucket, i.e., the metadata shared by both bucket layouts below. The layouts only differ in where
+// the entries of a bucket live, hence match_entry and insert_entry implement the fingerprint search and the insertion for both, operating on
+// the bucket's entries passed by the layout.
 template <typename KeyT, typename ValueT, typename FingerprintT, typename SIMDH, SIMDAlgorithm simd_algo, uint16_t number_of_fingerprints,
           uint8_t fps_per_vector_, bool use_sve, bool use_likely_hints>
-class KeyValueAoSStoringBucket {
+class BucketMetadata {
  public:
-  struct BucketingFindResult {
-    std::pair<KeyT, ValueT> key_value = {KeyT(), ValueT()};
-    bool is_valid = false;
-    KeyValueAoSStoringBucket* target_bucket = nullptr;
-    uint16_t index_in_bucket = 0;
-    bool can_terminate = false;
-  };
+  // Instantiated with NoValue, the bucket only stores the keys, i.e., it is a bucket of a key-only set
+  using Storage = KeyValueStorage<KeyT, ValueT>;
+  using EntryT = typename Storage::EntryT;
+  constexpr static bool stores_values = Storage::stores_values;
 
-  KeyValueAoSStoringBucket(FingerprintT invalid_fingerprint) {
-    DEBUG_ASSERT(number_of_fingerprints <= fps_per_vector_,
-                 fmt::format("Number of fingerprints {} not smaller than number of elements that fit in a SIMD register = {}", number_of_fingerprints,
-                             fps_per_vector_));
-
-    std::fill(std::begin(fingerprints_), std::end(fingerprints_), invalid_fingerprint);  // Just to avoid garbage memory in the fingerprint_ array
-    std::fill(std::begin(keys_values_), std::end(keys_values_),
-              std::make_pair(KeyT(), ValueT()));  // Just to avoid garbage memory in the keys_values_ array
-  }
-
-  using FindResult = BucketingFindResult;
   using vector_type = typename SIMDH::vector_type;
   using _vector_type = typename SIMDH::_vector_type;
   using MaskOrVectorInputType = typename SIMDH::MaskOrVectorInputType;
@@ -47,43 +47,36 @@ class KeyValueAoSStoringBucket {
   using CompareResultIterator = typename SIMDH::CompareResultIterator;
   using MaskIteratorT = typename CompareResultIterator::MaskIteratorT;
 
-  void prefault() {
-    std::random_device rd;
-    std::mt19937 gen{rd()};
-    std::uniform_int_distribution<uint64_t> dist{0, 0xDEADBEEF};
+  bool is_overflowed() { return overflowed_; }
 
-    for (uint64_t i = 0; i < fingerprints_.size(); ++i) {
-      fingerprints_[i] = static_cast<FingerprintT>(dist(gen));
-      if constexpr (!std::is_same_v<KeyT, StringKey> && !std::is_pointer_v<ValueT>) {
-        keys_values_[i] = {static_cast<KeyT>(dist(gen)), static_cast<ValueT>(dist(gen))};
-      }
-    }
-  }
+  uint16_t get_num_entries() const { return next_free_entry; }
 
-  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
-    uint64_t prefault_data_size = prefault_data.size();
-    for (uint64_t i = 0; i < keys_values_.size(); i++) {
-      keys_values_[i] = prefault_data[i % prefault_data_size];
-      fingerprints_[i] = 42;
-    }
-  }
+ protected:
+  struct EntryMatch {
+    uint16_t index_in_bucket = 0;
+    bool is_valid = false;
+    bool can_terminate = false;
+  };
 
-  void reset(FingerprintT invalid_fingerprint) {
-    for (uint64_t i = 0; i < fingerprints_.size(); ++i) {
-      fingerprints_[i] = invalid_fingerprint;
-      keys_values_[i] = {KeyT(), ValueT()};
-    }
+  BucketMetadata(FingerprintT invalid_fingerprint) {
+    DEBUG_ASSERT(number_of_fingerprints <= fps_per_vector_,
+                 fmt::format("Number of fingerprints {} not smaller than number of elements that fit in a SIMD register = {}", number_of_fingerprints,
+                             fps_per_vector_));
+
+    std::fill(std::begin(fingerprints_), std::end(fingerprints_), invalid_fingerprint);  // Just to avoid garbage memory in the fingerprint_ array
   }
 
+  // Searches key among the entries whose fingerprint matches. entries points to the first entry of this bucket.
 #ifdef HASHMAP_COLLECT_META_INFO
-  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key, const FingerprintT& fingerprint, utils::MeasurementInfo* minfo) {
+  HEDLEY_ALWAYS_INLINE EntryMatch match_entry(const KeyT& key, const FingerprintT& fingerprint, const EntryT* entries,
+                                              utils::MeasurementInfo* minfo) {
     if (minfo->measurement_started) {
       ++(minfo->probed_elements);
       ++(minfo->simd_loads);
       minfo->probed_elements_total += number_of_fingerprints;
     }
 #else
-  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key, const FingerprintT& fingerprint) {
+  HEDLEY_ALWAYS_INLINE EntryMatch match_entry(const KeyT& key, const FingerprintT& fingerprint, const EntryT* entries) {
 #endif
 
     vector_type index_vector;
@@ -118,11 +111,10 @@ class KeyValueAoSStoringBucket {
           }
 
           iterator = CompareResultIterator::next_it(iterator, next_match);
-          const std::pair<KeyT, ValueT>& kv_pair = keys_values_[next_match];
 
           if constexpr (use_likely_hints) {
-            if (HEDLEY_LIKELY(std::get<0>(kv_pair) == key)) [[likely]] {
-              return {kv_pair, true, this, next_match, true};
+            if (HEDLEY_LIKELY(Storage::key(entries[next_match]) == key)) [[likely]] {
+              return {next_match, true, true};
             }
 #ifdef HASHMAP_COLLECT_META_INFO
             if (minfo->measurement_started) {
@@ -130,8 +122,8 @@ class KeyValueAoSStoringBucket {
             }
 #endif
           } else {
-            if (std::get<0>(kv_pair) == key) {
-              return {kv_pair, true, this, next_match, true};
+            if (Storage::key(entries[next_match]) == key) {
+              return {next_match, true, true};
             }
 #ifdef HASHMAP_COLLECT_META_INFO
             if (minfo->measurement_started) {
@@ -153,11 +145,10 @@ class KeyValueAoSStoringBucket {
         }
 
         iterator = CompareResultIterator::next_it(iterator, next_match);
-        const std::pair<KeyT, ValueT>& kv_pair = keys_values_[next_match];
 
         if constexpr (use_likely_hints) {
-          if (HEDLEY_LIKELY(std::get<0>(kv_pair) == key)) [[likely]] {
-            return {kv_pair, true, this, next_match, true};
+          if (HEDLEY_LIKELY(Storage::key(entries[next_match]) == key)) [[likely]] {
+            return {next_match, true, true};
           }
 #ifdef HASHMAP_COLLECT_META_INFO
           if (minfo->measurement_started) {
@@ -165,8 +156,8 @@ class KeyValueAoSStoringBucket {
           }
 #endif
         } else {
-          if (std::get<0>(kv_pair) == key) {
-            return {kv_pair, true, this, next_match, true};
+          if (Storage::key(entries[next_match]) == key) {
+            return {next_match, true, true};
           }
 #ifdef HASHMAP_COLLECT_META_INFO
           if (minfo->measurement_started) {
@@ -185,11 +176,11 @@ class KeyValueAoSStoringBucket {
 
     if constexpr (use_likely_hints) {
       if (HEDLEY_LIKELY(!overflowed_)) [[likely]] {
-        return {{KeyT(), ValueT()}, false, this, 0, true};
+        return {0, false, true};
       }
     } else {
       if (!overflowed_) {
-        return {{KeyT(), ValueT()}, false, this, 0, true};
+        return {0, false, true};
       }
     }
 #ifdef HASHMAP_COLLECT_META_INFO
@@ -198,18 +189,20 @@ class KeyValueAoSStoringBucket {
     }
 #endif
     // We overflowed, tell to not terminate search
-    return {{KeyT(), ValueT()}, false, this, 0, false};
+    return {0, false, false};
   }
 
+  // Appends the entry to entries, which points to the first entry of this bucket. Returns false (and marks the bucket as overflowed) if it is full.
 #ifdef HASHMAP_COLLECT_META_INFO
-  HEDLEY_ALWAYS_INLINE bool insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, utils::MeasurementInfo* minfo) {
+  HEDLEY_ALWAYS_INLINE bool insert_entry(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, EntryT* entries,
+                                         utils::MeasurementInfo* minfo) {
 #else
-  HEDLEY_ALWAYS_INLINE bool insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint) {
+  HEDLEY_ALWAYS_INLINE bool insert_entry(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, EntryT* entries) {
 #endif
     if constexpr (use_likely_hints) {
       if (HEDLEY_LIKELY(next_free_entry < number_of_fingerprints)) [[likely]] {
         fingerprints_[next_free_entry] = fingerprint;
-        keys_values_[next_free_entry++] = {key, value};
+        entries[next_free_entry++] = Storage::make_entry(key, value);
         return true;
       } else {
 #ifdef HASHMAP_COLLECT_META_INFO
@@ -224,7 +217,7 @@ class KeyValueAoSStoringBucket {
     } else {
       if (next_free_entry < number_of_fingerprints) {
         fingerprints_[next_free_entry] = fingerprint;
-        keys_values_[next_free_entry++] = {key, value};
+        entries[next_free_entry++] = Storage::make_entry(key, value);
         return true;
       } else {
 #ifdef HASHMAP_COLLECT_META_INFO
@@ -243,36 +236,253 @@ class KeyValueAoSStoringBucket {
     return false;
   }
 
-  HEDLEY_ALWAYS_INLINE void update(const KeyT& key, const ValueT& value, uint16_t index_in_bucket) {
-    DEBUG_ASSERT(std::get<0>(keys_values_[index_in_bucket]) == key, "Invalid update call");
-    keys_values_[index_in_bucket] = {key, value};
+  void reset_metadata(FingerprintT invalid_fingerprint) {
+    std::fill(std::begin(fingerprints_), std::end(fingerprints_), invalid_fingerprint);
+    next_free_entry = 0;
+    overflowed_ = false;
   }
 
-  bool is_overflowed() { return overflowed_; }
-
-  static std::string to_string() { return "KeyValueAoSStoringBucket"; }
-
- private:
   uint8_t next_free_entry = 0;
   bool overflowed_ = false;  // only if this is true, we will need to follow to next_bucket in case we don't find it within our chunk
   alignas(SIMDH::_vector_alignment()) std::array<FingerprintT, fps_per_vector_> fingerprints_;
+};
+
+template <typename KeyT, typename ValueT, typename FingerprintT, typename SIMDH, SIMDAlgorithm simd_algo, uint16_t number_of_fingerprints,
+          uint8_t fps_per_vector_, bool use_sve, bool use_likely_hints>
+class KeyValueAoSStoringBucket
+    : public BucketMetadata<KeyT, ValueT, FingerprintT, SIMDH, simd_algo, number_of_fingerprints, fps_per_vector_, use_sve, use_likely_hints> {
+  using Base = BucketMetadata<KeyT, ValueT, FingerprintT, SIMDH, simd_algo, number_of_fingerprints, fps_per_vector_, use_sve, use_likely_hints>;
+  using EntryMatch = typename Base::EntryMatch;
+  using Base::fingerprints_;
+
+ public:
+  using Storage = typename Base::Storage;
+  using EntryT = typename Base::EntryT;
+  using Base::stores_values;
+
+  struct BucketingFindResult {
+    std::pair<KeyT, ValueT> key_value = {KeyT(), ValueT()};
+    bool is_valid = false;
+    KeyValueAoSStoringBucket* target_bucket = nullptr;
+    uint16_t index_in_bucket = 0;
+    bool can_terminate = false;
+  };
+
+  KeyValueAoSStoringBucket(FingerprintT invalid_fingerprint) : Base(invalid_fingerprint) {
+    std::fill(std::begin(keys_values_), std::end(keys_values_), EntryT{});  // Just to avoid garbage memory in the keys_values_ array
+  }
+
+  // The table passes the bucket's external keys and values to every call, this bucket has none
+  constexpr static bool stores_keys_values_externally = false;
+  using ExternalKeyValuesT = std::nullptr_t;
+  using ConstExternalKeyValuesT = std::nullptr_t;
+
+  using FindResult = BucketingFindResult;
+
+  void prefault(ExternalKeyValuesT /*keys_values*/) {
+    std::random_device rd;
+    std::mt19937 gen{rd()};
+    std::uniform_int_distribution<uint64_t> dist{0, 0xDEADBEEF};
+
+    for (uint64_t i = 0; i < fingerprints_.size(); ++i) {
+      fingerprints_[i] = static_cast<FingerprintT>(dist(gen));
+      if constexpr (!std::is_same_v<KeyT, StringKey> && !stores_values) {
+        keys_values_[i] = static_cast<KeyT>(dist(gen));
+      } else if constexpr (!std::is_same_v<KeyT, StringKey> && !std::is_pointer_v<ValueT>) {
+        keys_values_[i] = {static_cast<KeyT>(dist(gen)), static_cast<ValueT>(dist(gen))};
+      }
+    }
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data, ExternalKeyValuesT /*keys_values*/) {
+    uint64_t prefault_data_size = prefault_data.size();
+    for (uint64_t i = 0; i < keys_values_.size(); i++) {
+      keys_values_[i] = Storage::make_entry(prefault_data[i % prefault_data_size]);
+      fingerprints_[i] = 42;
+    }
+  }
+
+  void reset(FingerprintT invalid_fingerprint, ExternalKeyValuesT /*keys_values*/) {
+    std::fill(std::begin(keys_values_), std::end(keys_values_), EntryT{});
+    this->reset_metadata(invalid_fingerprint);
+  }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key, const FingerprintT& fingerprint, ConstExternalKeyValuesT /*keys_values*/,
+                                       utils::MeasurementInfo* minfo) {
+    const EntryMatch match = this->match_entry(key, fingerprint, keys_values_.data(), minfo);
+#else
+  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key, const FingerprintT& fingerprint, ConstExternalKeyValuesT /*keys_values*/) {
+    const EntryMatch match = this->match_entry(key, fingerprint, keys_values_.data());
+#endif
+    if (match.is_valid) {
+      return {Storage::to_pair(keys_values_[match.index_in_bucket]), true, this, match.index_in_bucket, true};
+    }
+    return {{KeyT(), ValueT()}, false, this, 0, match.can_terminate};
+  }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  HEDLEY_ALWAYS_INLINE bool insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, ExternalKeyValuesT /*keys_values*/,
+                                   utils::MeasurementInfo* minfo) {
+    return this->insert_entry(key, value, fingerprint, keys_values_.data(), minfo);
+  }
+#else
+  HEDLEY_ALWAYS_INLINE bool insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, ExternalKeyValuesT /*keys_values*/) {
+    return this->insert_entry(key, value, fingerprint, keys_values_.data());
+  }
+#endif
 
-  std::array<std::pair<KeyT, ValueT>, fps_per_vector_> keys_values_;
+  HEDLEY_ALWAYS_INLINE void update(const KeyT& key, const ValueT& value, uint16_t index_in_bucket, ExternalKeyValuesT /*keys_values*/) {
+    DEBUG_ASSERT(Storage::key(keys_values_[index_in_bucket]) == key, "Invalid update call");
+    keys_values_[index_in_bucket] = Storage::make_entry(key, value);
+  }
+
+  // Swaps the entry and its fingerprint at index_in_bucket with the one at other_index of other, which may be this bucket
+  HEDLEY_ALWAYS_INLINE void exchange_entry(uint16_t index_in_bucket, ExternalKeyValuesT /*keys_values*/, KeyValueAoSStoringBucket& other,
+                                           ExternalKeyValuesT /*other_keys_values*/, uint16_t other_index) {
+    std::swap(fingerprints_[index_in_bucket], other.fingerprints_[other_index]);
+    std::swap(keys_values_[index_in_bucket], other.keys_values_[other_index]);
+  }
+
+  std::pair<KeyT, ValueT> get_entry(uint16_t index_in_bucket, ConstExternalKeyValuesT /*keys_values*/) const {
+    return Storage::to_pair(keys_values_[index_in_bucket]);
+  }
+
+  static std::string to_string() { return "KeyValueAoSStoringBucket"; }
+
+ private:
+  std::array<EntryT, fps_per_vector_> keys_values_;
 };  //  __attribute__((__packed__)); ?
 
+// Bucket that only holds the metadata (fingerprints, fill level and overflow flag). Its keys and values live in a separate array of the hash
+// table, which passes the bucket's slice of that array to every call. The buckets hence form a dense metadata array: A lookup first touches only
+// the bucket's fingerprints and then, on a fingerprint match, the key/value line. Negative lookups never touch key/value data.
+template <typename KeyT, typename ValueT, typename FingerprintT, typename SIMDH, SIMDAlgorithm simd_algo, uint16_t number_of_fingerprints,
+          uint8_t fps_per_vector_, bool use_sve, bool use_likely_hints>
+class SplitKeyValueStoringBucket
+    : public BucketMetadata<KeyT, ValueT, FingerprintT, SIMDH, simd_algo, number_of_fingerprints, fps_per_vector_, use_sve, use_likely_hints> {
+  using Base = BucketMetadata<KeyT, ValueT, FingerprintT, SIMDH, simd_algo, number_of_fingerprints, fps_per_vector_, use_sve, use_likely_hints>;
+  using EntryMatch = typename Base::EntryMatch;
+  using Base::fingerprints_;
+
+ public:
+  using Storage = typename Base::Storage;
+  using Base::stores_values;
+
+  struct BucketingFindResult {
+    std::pair<KeyT, ValueT> key_value = {KeyT(), ValueT()};
+    bool is_valid = false;
+    SplitKeyValueStoringBucket* target_bucket = nullptr;
+    uint16_t index_in_bucket = 0;
+    bool can_terminate = false;
+  };
+
+  SplitKeyValueStoringBucket(FingerprintT invalid_fingerprint) : Base(invalid_fingerprint) {}
+
+  // The keys and values are not stored in the bucket but in an array owned by the hash table. Bucket i owns the keys_values_per_bucket entries
+  // starting at i * keys_values_per_bucket, and the table passes a pointer to the first of them to every call.
+  constexpr static bool stores_keys_values_externally = true;
+  constexpr static uint16_t keys_values_per_bucket = number_of_fingerprints;
+  using ExternalKeyValuesT = std::pair<KeyT, ValueT>*;
+  using ConstExternalKeyValuesT = const std::pair<KeyT, ValueT>*;
+  static_assert(std::is_same_v<typename Base::EntryT, std::pair<KeyT, ValueT>>, "The external array stores keys and values as pairs");
+
+  using FindResult = BucketingFindResult;
+
+  void prefault(ExternalKeyValuesT keys_values) {
+    std::random_device rd;
+    std::mt19937 gen{rd()};
+    std::uniform_int_distribution<uint64_t> dist{0, 0xDEADBEEF};
+
+    for (uint64_t i = 0; i < fingerprints_.size(); ++i) {
+      fingerprints_[i] = static_cast<FingerprintT>(dist(gen));
+    }
+
+    for (uint64_t i = 0; i < keys_values_per_bucket; ++i) {
+      if constexpr (!std::is_same_v<KeyT, StringKey> && !std::is_pointer_v<ValueT>) {
+        keys_values[i] = {static_cast<KeyT>(dist(gen)), static_cast<ValueT>(dist(gen))};
+      }
+    }
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data, ExternalKeyValuesT keys_values) {
+    uint64_t prefault_data_size = prefault_data.size();
+    for (uint64_t i = 0; i < fingerprints_.size(); i++) {
+      fingerprints_[i] = 42;
+    }
+
+    for (uint64_t i = 0; i < keys_values_per_bucket; i++) {
+      keys_values[i] = prefault_data[i % prefault_data_size];
+    }
+  }
+
+  void reset(FingerprintT invalid_fingerprint, ExternalKeyValuesT keys_values) {
+    std::fill(keys_values, keys_values + keys_values_per_bucket, std::make_pair(KeyT(), ValueT()));
+    this->reset_metadata(invalid_fingerprint);
+  }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key, const FingerprintT& fingerprint, ConstExternalKeyValuesT keys_values,
+                                       utils::MeasurementInfo* minfo) {
+    const EntryMatch match = this->match_entry(key, fingerprint, keys_values, minfo);
+#else
+  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key, const FingerprintT& fingerprint, ConstExternalKeyValuesT keys_values) {
+    const EntryMatch match = this->match_entry(key, fingerprint, keys_values);
+#endif
+    if (match.is_valid) {
+      return {keys_values[match.index_in_bucket], true, this, match.index_in_bucket, true};
+    }
+    return {{KeyT(), ValueT()}, false, this, 0, match.can_terminate};
+  }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  HEDLEY_ALWAYS_INLINE bool insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, ExternalKeyValuesT keys_values,
+                                   utils::MeasurementInfo* minfo) {
+    return this->insert_entry(key, value, fingerprint, keys_values, minfo);
+  }
+#else
+  HEDLEY_ALWAYS_INLINE bool insert(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, ExternalKeyValuesT keys_values) {
+    return this->insert_entry(key, value, fingerprint, keys_values);
+  }
+#endif
+
+  HEDLEY_ALWAYS_INLINE void update(const KeyT& key, const ValueT& value, uint16_t index_in_bucket, ExternalKeyValuesT keys_values) {
+    DEBUG_ASSERT(std::get<0>(keys_values[index_in_bucket]) == key, "Invalid update call");
+    keys_values[index_in_bucket] = {key, value};
+  }
+
+  // Swaps the entry and its fingerprint at index_in_bucket with the one at other_index of other, which may be this bucket
+  HEDLEY_ALWAYS_INLINE void exchange_entry(uint16_t index_in_bucket, ExternalKeyValuesT keys_values, SplitKeyValueStoringBucket& other,
+                                           ExternalKeyValuesT other_keys_values, uint16_t other_index) {
+    std::swap(fingerprints_[index_in_bucket], other.fingerprints_[other_index]);
+    std::swap(keys_values[index_in_bucket], other_keys_values[other_index]);
+  }
+
+  const std::pair<KeyT, ValueT>& get_entry(uint16_t index_in_bucket, ConstExternalKeyValuesT keys_values) const {
+    return keys_values[index_in_bucket];
+  }
+
+  static std::string to_string() { return "SplitKeyValueStoringBucket"; }
+};
+
 template <
     typename KeyT, typename ValueT, typename HasherT, typename FingerprintT = uint16_t,
     template <typename, typename, typename, typename, SIMDAlgorithm, uint16_t, uint8_t, bool, bool> typename BucketTmpl = KeyValueAoSStoringBucket,
     uint16_t fingerprints_per_bucket = 8, uint16_t simd_size = 128, SIMDAlgorithm simd_algo = SIMDAlgorithm::TESTZ, bool use_avx512_features = false,
     bool use_sve = false, NEONAlgo neon_algo = NEONAlgo::SSE2NEON, bool sve_scalar_broadcast = false, bool use_prefetching = false,
     utils::PrefetchingLocality prefetching_locality = utils::PrefetchingLocality::MEDIUM, bool use_thp = false, bool use_likely_hints = false,
-    hashing::FingerprintBucketBits fingerprint_bucket_bits = hashing::FingerprintBucketBits::MSBLSB, FingerprintT invalid_fingerprint = 0>
+    hashing::FingerprintBucketBits fingerprint_bucket_bits = hashing::FingerprintBucketBits::MSBLSB, FingerprintT invalid_fingerprint = 0,
+    BucketOverflowPolicy overflow_policy = BucketOverflowPolicy::NEXT_BUCKET, typename BucketIdxT = uint32_t, uint16_t reorganize_interval = 0>
 class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
+  // 32-bit bucket indices keep the probing state small and suffice for up to 2^32 buckets, larger tables need 64-bit indices
+  static_assert(std::is_same_v<BucketIdxT, uint32_t> || std::is_same_v<BucketIdxT, uint64_t>, "Bucket indices are either 32 or 64 bit wide");
+
  public:
   BucketingSIMDHashTable(uint64_t max_elements, uint8_t /*target_load_factor*/, bool print_info = true,
                          std::string base_identifier = "BucketingSIMDHashTable")
-      : num_buckets_{std::max((max_elements / fingerprints_per_bucket), static_cast<uint64_t>(1))},
-        buckets_(num_buckets_, BucketT(invalid_fingerprint)),
+      : num_buckets_{std::max(((max_elements + fingerprints_per_bucket - 1) / fingerprints_per_bucket), static_cast<uint64_t>(1))},
+        num_stash_buckets_{overflow_policy == BucketOverflowPolicy::STASH ? std::max(num_buckets_ / stash_fraction, static_cast<uint64_t>(1)) : 0},
+        buckets_(num_buckets_ + num_stash_buckets_, BucketT(invalid_fingerprint)),
         max_elements_{max_elements},
         size_{0},
         hasher_(num_buckets_),
@@ -288,13 +498,20 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
                       get_identifier(), utils::cacheline_size, num_buckets_, simd_size, SIMDH::_vector_alignment()));
     }
 
-    ASSERT(utils::is_power_of_two(max_elements) && utils::is_power_of_two(fingerprints_per_bucket),
+    ASSERT((supports_arbitrary_capacity || utils::is_power_of_two(max_elements)) && utils::is_power_of_two(fingerprints_per_bucket),
            fmt::format("Bucketing is optimized towards hash maps that have a maximum size which is a power of two, this hash "
-                       "map is of size {}.",
+                       "map is of size {}. Use a hasher with modulo or fastrange finalization for other sizes.",
                        max_elements));
+    ASSERT(max_elements <= max_capacity,
+           fmt::format("{} buckets cannot be addressed with {}-bit bucket indices, use 64-bit bucket indices for this table size.",
+                       num_buckets_ + num_stash_buckets_, sizeof(BucketIdxT) * 8));
 
     fail_if_system_is_incompatible<FingerprintT, simd_size, simd_algo, use_avx512_features, use_sve, neon_algo, sve_scalar_broadcast>();
 
+    if constexpr (BucketT::stores_keys_values_externally) {
+      keys_values_.resize(buckets_.size() * BucketT::keys_values_per_bucket);
+    }
+
 #ifdef HASHMAP_COLLECT_META_INFO
     minfo.num_buckets = num_buckets_;
 #endif
@@ -305,19 +522,40 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
                              use_likely_hints>;
   using BucketingFindResult = typename BucketT::BucketingFindResult;
 
+  constexpr static bool stores_values = !std::is_same_v<ValueT, NoValue>;
+  // Hashers with modulo or fastrange finalization map into any number of buckets, the secondary bucket and stash policies mask though
+  constexpr static bool supports_arbitrary_capacity = HasherT::supports_arbitrary_range && overflow_policy == BucketOverflowPolicy::NEXT_BUCKET;
+  static_assert(stores_values || !BucketT::stores_keys_values_externally, "Key-only sets require a bucket storing the keys in the bucket");
+
+  constexpr static uint64_t stash_fraction = 16;  // the stash has 1/stash_fraction as many buckets as the table itself
+  // The largest max_elements the bucket index type can address, including the stash and the probe counter in insert_new running past num_buckets_
+  constexpr static uint64_t max_capacity =
+      std::is_same_v<BucketIdxT, uint64_t>
+          ? std::numeric_limits<uint64_t>::max()
+          : (overflow_policy == BucketOverflowPolicy::STASH ? (std::numeric_limits<uint32_t>::max() - 2ULL) / (stash_fraction + 1) * stash_fraction
+                                                            : std::numeric_limits<uint32_t>::max() - 2ULL) *
+                fingerprints_per_bucket;
+
   struct FindResult {
     BucketingFindResult res;
-    uint32_t bucket_idx;
-    uint32_t probe_length;
+    BucketIdxT bucket_idx;
+    BucketIdxT probe_length;
+    BucketIdxT home_bucket_idx;
   };
 
   bool contains(const KeyT& key) {
     const FindResult& result = find(key);
+    if constexpr (reorganize_interval > 0) {
+      reorganize_on_hit(result);
+    }
     return result.res.is_valid;
   }
 
   ValueT lookup(const KeyT& key) {
     const FindResult& result = find(key);
+    if constexpr (reorganize_interval > 0) {
+      reorganize_on_hit(result);
+    }
     if constexpr (std::is_pointer_v<ValueT>) {
       return result.res.is_valid ? std::get<1>(result.res.key_value) : nullptr;
     } else {
@@ -330,29 +568,58 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
 
     const hashing::BucketHash<FingerprintT> bucket_hash =
         hasher_.template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(key);
-    uint32_t bucket_idx = static_cast<uint32_t>(bucket_hash.bucket);
+    BucketIdxT bucket_idx = static_cast<BucketIdxT>(bucket_hash.bucket);
     const FingerprintT fingerprint = bucket_hash.fingerprint;
 
     FindResult result;
     // Check if element already exists in hashmap; if so, update
     if constexpr (use_likely_hints) {
       if (HEDLEY_UNLIKELY((result = find_impl(key, fingerprint, bucket_idx)).res.is_valid)) [[unlikely]] {
-        return result.res.target_bucket->update(key, value, result.res.index_in_bucket);
+        return buckets_[result.bucket_idx].update(key, value, result.res.index_in_bucket, bucket_keys_values(result.bucket_idx));
       }
     } else {
       if ((result = find_impl(key, fingerprint, bucket_idx)).res.is_valid) {
-        return result.res.target_bucket->update(key, value, result.res.index_in_bucket);
+        return buckets_[result.bucket_idx].update(key, value, result.res.index_in_bucket, bucket_keys_values(result.bucket_idx));
       }
     }
 
-    uint32_t bucket_number = result.probe_length;
-    bucket_idx = result.bucket_idx;
+    insert_new(key, value, fingerprint, result);
+  }
+
+  // Returns the value stored for key. If key is missing, inserts it with value first, continuing the probe of the lookup.
+  ValueT lookup_or_insert(const KeyT& key, const ValueT& value)
+    requires(stores_values)
+  {
+    const hashing::BucketHash<FingerprintT> bucket_hash =
+        hasher_.template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(key);
+    const FingerprintT fingerprint = bucket_hash.fingerprint;
+    const FindResult result = find_impl(key, fingerprint, static_cast<BucketIdxT>(bucket_hash.bucket));
+
+    if (result.res.is_valid) {
+      return std::get<1>(result.res.key_value);
+    }
+
+    DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+    insert_new(key, value, fingerprint, result);
+    return value;
+  }
+
+  void insert(const KeyT& key)
+    requires(!stores_values)
+  {
+    insert(key, NoValue{});
+  }
+
+  // Inserts a key that the preceding find_impl call reported as missing, continuing at the bucket where that probe terminated
+  HEDLEY_ALWAYS_INLINE void insert_new(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, const FindResult& result) {
+    BucketIdxT bucket_number = result.probe_length;
+    BucketIdxT bucket_idx = result.bucket_idx;
 
-    for (; bucket_number <= num_buckets_; ++bucket_number) {
+    for (; bucket_number <= num_buckets_ + 1; ++bucket_number) {
 #ifdef HASHMAP_COLLECT_META_INFO
-      const bool insert_sucessful = buckets_[bucket_idx].insert(key, value, fingerprint, &minfo);
+      const bool insert_sucessful = buckets_[bucket_idx].insert(key, value, fingerprint, bucket_keys_values(bucket_idx), &minfo);
 #else
-      const bool insert_sucessful = buckets_[bucket_idx].insert(key, value, fingerprint);
+      const bool insert_sucessful = buckets_[bucket_idx].insert(key, value, fingerprint, bucket_keys_values(bucket_idx));
 #endif
 
       if constexpr (use_likely_hints) {
@@ -369,15 +636,7 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
         }
       }
 
-      if constexpr (use_likely_hints) {
-        if (HEDLEY_LIKELY(bucket_idx < num_buckets_ - 1)) [[likely]] {
-          ++bucket_idx;
-        } else {
-          bucket_idx = 0;
-        }
-      } else {
-        bucket_idx = (bucket_idx == num_buckets_ - 1) ? 0 : bucket_idx + 1;
-      }
+      bucket_idx = next_bucket_idx(bucket_idx, bucket_number, result.home_bucket_idx, fingerprint);
     }
   }
 
@@ -390,7 +649,7 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
 
     const hashing::BucketHash<FingerprintT> bucket_hash =
         hasher_.template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(key);
-    uint32_t bucket_idx = static_cast<uint32_t>(bucket_hash.bucket);
+    BucketIdxT bucket_idx = static_cast<BucketIdxT>(bucket_hash.bucket);
     const FingerprintT fingerprint = bucket_hash.fingerprint;
 
     if constexpr (std::is_same_v<KeyT, StringKey>) {
@@ -404,8 +663,9 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
     return find_impl(key, fingerprint, bucket_idx);
   }
 
-  HEDLEY_ALWAYS_INLINE FindResult find_impl(const KeyT& key, const FingerprintT& fingerprint, uint32_t bucket_idx) {
-    uint32_t bucket_number = 0;
+  HEDLEY_ALWAYS_INLINE FindResult find_impl(const KeyT& key, const FingerprintT& fingerprint, BucketIdxT bucket_idx) {
+    const BucketIdxT home_bucket_idx = bucket_idx;
+    BucketIdxT bucket_number = 0;
 
 #ifdef HASHMAP_COLLECT_META_INFO
     uint64_t probing_seq_len = 0;
@@ -414,9 +674,9 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
     for (bucket_number = 0; bucket_number <= max_bucket_chain; ++bucket_number) {
 #ifdef HASHMAP_COLLECT_META_INFO
       ++probing_seq_len;
-      const BucketingFindResult res = buckets_[bucket_idx].find(key, fingerprint, &minfo);
+      const BucketingFindResult res = buckets_[bucket_idx].find(key, fingerprint, bucket_keys_values(bucket_idx), &minfo);
 #else
-      const BucketingFindResult res = buckets_[bucket_idx].find(key, fingerprint);
+      const BucketingFindResult res = buckets_[bucket_idx].find(key, fingerprint, bucket_keys_values(bucket_idx));
 #endif
       if constexpr (use_likely_hints) {
         if (HEDLEY_LIKELY(res.can_terminate)) [[likely]] {
@@ -424,10 +684,13 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
           if (minfo.measurement_started) {
             minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
             minfo.max_probing_sequence = std::max(minfo.max_probing_sequence, probing_seq_len);
+            if (res.is_valid && bucket_number > 0) {
+              ++(minfo.num_overflow_hits);
+            }
           }
 #endif
 
-          return {res, bucket_idx, bucket_number};
+          return {res, bucket_idx, bucket_number, home_bucket_idx};
         }
       } else {
         if (res.can_terminate) {
@@ -435,52 +698,236 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
           if (minfo.measurement_started) {
             minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
             minfo.max_probing_sequence = std::max(minfo.max_probing_sequence, probing_seq_len);
+            if (res.is_valid && bucket_number > 0) {
+              ++(minfo.num_overflow_hits);
+            }
           }
 #endif
 
-          return {res, bucket_idx, bucket_number};
+          return {res, bucket_idx, bucket_number, home_bucket_idx};
         }
       }
 
-      if constexpr (use_likely_hints) {
-        if (HEDLEY_LIKELY(bucket_idx < num_buckets_ - 1)) [[likely]] {
-          ++bucket_idx;
+      bucket_idx = next_bucket_idx(bucket_idx, bucket_number, home_bucket_idx, fingerprint);
+    }
+    if constexpr (std::is_pointer_v<ValueT>) {
+      return {{{KeyT(), nullptr}, false, nullptr, 0, true}, bucket_idx, bucket_number, home_bucket_idx};
+    } else {
+      return {{{KeyT(), ValueT()}, false, nullptr, 0, true}, bucket_idx, bucket_number, home_bucket_idx};
+    }
+  }
+
+  // Returns the bucket to probe after bucket_idx, which was the bucket_number-th bucket of the probing sequence starting at home_bucket_idx
+  HEDLEY_ALWAYS_INLINE BucketIdxT next_bucket_idx(BucketIdxT bucket_idx, BucketIdxT bucket_number, BucketIdxT home_bucket_idx,
+                                                  const FingerprintT& fingerprint) const {
+    if constexpr (overflow_policy != BucketOverflowPolicy::NEXT_BUCKET) {
+      if (bucket_number == 0) {
+        // The offset only depends on the fingerprint, so all keys of a bucket with the same fingerprint share their overflow bucket
+        const uint64_t offset = (static_cast<uint64_t>(fingerprint) * utils::multiply_constant_64b) >> 32;
+        if constexpr (overflow_policy == BucketOverflowPolicy::STASH) {
+          return static_cast<BucketIdxT>(num_buckets_ + ((home_bucket_idx ^ offset) & (num_stash_buckets_ - 1)));
         } else {
-          bucket_idx = 0;
+          return static_cast<BucketIdxT>((home_bucket_idx ^ offset) & (num_buckets_ - 1));
         }
-      } else {
-        bucket_idx = (bucket_idx == num_buckets_ - 1) ? 0 : bucket_idx + 1;
+      }
+
+      if (bucket_number == 1) {
+        // Continue with linear probing right after the home bucket
+        bucket_idx = home_bucket_idx;
       }
     }
-    if constexpr (std::is_pointer_v<ValueT>) {
-      return {{{KeyT(), nullptr}, false, nullptr, 0, true}, bucket_idx, bucket_number};
+
+    if constexpr (use_likely_hints) {
+      if (HEDLEY_LIKELY(bucket_idx < num_buckets_ - 1)) [[likely]] {
+        return bucket_idx + 1;
+      }
+      return 0;
     } else {
-      return {{{KeyT(), ValueT()}, false, nullptr, 0, true}, bucket_idx, bucket_number};
+      return (bucket_idx == num_buckets_ - 1) ? 0 : bucket_idx + 1;
+    }
+  }
+
+  // Self-organizing buckets (reorganize_interval > 0): every reorganize_interval-th hit on an entry that is not in the first slot of its home
+  // bucket moves that entry one step forward. Within a bucket, it swaps places with its predecessor, such that frequently hit keys end up in the
+  // first slots, i.e., on the cache line of the fingerprints. With NEXT_BUCKET, an entry hit in an overflow bucket instead swaps places with the
+  // last entry of its home bucket. Hot keys are sampled more often and hence bubble to the front, while the sampling keeps the swaps off the
+  // common path. As lookups modify the table, concurrent readers are not supported in this mode.
+  HEDLEY_ALWAYS_INLINE void reorganize_on_hit(const FindResult& result) {
+    if (!result.res.is_valid || (result.probe_length == 0 && result.res.index_in_bucket == 0)) {
+      return;
+    }
+    if (HEDLEY_LIKELY(--reorganize_countdown_ > 0)) {
+      return;
+    }
+    reorganize_countdown_ = reorganize_interval;
+    promote_entry(result);
+  }
+
+  HEDLEY_NEVER_INLINE void promote_entry(const FindResult& result) {
+    BucketT& bucket = buckets_[result.bucket_idx];
+    const uint16_t index_in_bucket = result.res.index_in_bucket;
+
+    if (overflow_policy != BucketOverflowPolicy::NEXT_BUCKET || result.probe_length == 0) {
+      if (index_in_bucket > 0) {
+        bucket.exchange_entry(index_in_bucket, bucket_keys_values(result.bucket_idx), bucket, bucket_keys_values(result.bucket_idx),
+                              static_cast<uint16_t>(index_in_bucket - 1));
+      }
+      return;
+    }
+
+    // The home bucket is full, otherwise the entry would not have overflowed. The victim moves to the bucket the entry was found in, which is
+    // still on the victim's probing sequence as all buckets in between have overflowed. Its home may lie before the home bucket though.
+    BucketT& home_bucket = buckets_[result.home_bucket_idx];
+    const uint16_t victim_index = static_cast<uint16_t>(home_bucket.get_num_entries() - 1);
+    const uint64_t victim_home_bucket_idx =
+        hasher_
+            .template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(
+                std::get<0>(home_bucket.get_entry(victim_index, bucket_keys_values(result.home_bucket_idx))))
+            .bucket;
+    const uint64_t victim_probe_length = (result.bucket_idx + num_buckets_ - victim_home_bucket_idx) % num_buckets_;
+    max_bucket_chain = std::max(max_bucket_chain, victim_probe_length);
+
+    home_bucket.exchange_entry(victim_index, bucket_keys_values(result.home_bucket_idx), bucket, bucket_keys_values(result.bucket_idx),
+                               index_in_bucket);
+  }
+
+  // Merges all entries of other into this table. If the key already exists, the stored value becomes combine_fn(existing_value, other_value).
+  // Both tables share the hash function, so the entries of other's bucket i hash to the same region of this table (bucket i, or i and i + N/2
+  // after doubling the size for low-bit buckets). Sweeping other's buckets in order hence turns the merge into a sequential pass over both tables.
+  template <typename CombineFn>
+  void merge_from(const BucketingSIMDHashTable& other, CombineFn combine_fn) {
+    merge_from(other, combine_fn, 0, other.buckets_.size());
+  }
+
+  // Merges only the entries stored in other's buckets [first_bucket, last_bucket).
+  template <typename CombineFn>
+  void merge_from(const BucketingSIMDHashTable& other, CombineFn combine_fn, uint64_t first_bucket, uint64_t last_bucket) {
+    DEBUG_ASSERT(first_bucket <= last_bucket && last_bucket <= other.buckets_.size(), "Invalid bucket range to merge.");
+
+    for (uint64_t bucket_idx = first_bucket; bucket_idx < last_bucket; ++bucket_idx) {
+      const BucketT& bucket = other.buckets_[bucket_idx];
+      for (uint16_t index_in_bucket = 0; index_in_bucket < bucket.get_num_entries(); ++index_in_bucket) {
+        const std::pair<KeyT, ValueT>& kv_pair = bucket.get_entry(index_in_bucket, other.bucket_keys_values(bucket_idx));
+        merge_entry(std::get<0>(kv_pair), std::get<1>(kv_pair), combine_fn);
+      }
+    }
+  }
+
+  // Merges other into this table using thread_count threads. The entries of other are first partitioned by the range of buckets they hash to in
+  // this table, then every thread merges one of these ranges. A thread never probes or inserts outside of its range; entries whose probe sequence
+  // would cross the range boundary are deferred and merged sequentially once all threads finished.
+  template <typename CombineFn>
+  void parallel_merge_from(const BucketingSIMDHashTable& other, CombineFn combine_fn, uint8_t thread_count) {
+    // Range partitioning relies on probing sequences that only move forward through the buckets
+    if (overflow_policy != BucketOverflowPolicy::NEXT_BUCKET || thread_count <= 1 || num_buckets_ < thread_count) {
+      return merge_from(other, combine_fn);
+    }
+
+    // The threads do not check the capacity on every insert, hence we ensure upfront that even disjoint key sets fit
+    DEBUG_ASSERT(size_ + other.size_ <= max_elements_, "Hashmap is full!");
+
+    struct MergeEntry {
+      KeyT key;
+      ValueT value;
+      FingerprintT fingerprint;
+      uint64_t bucket_idx;
+    };
+
+    const uint64_t buckets_per_range = num_buckets_ / thread_count;
+
+    // partitions[t][r] contains the entries of the t-th slice of other that hash into the r-th bucket range of this table
+    std::vector<std::vector<std::vector<MergeEntry>>> partitions(thread_count, std::vector<std::vector<MergeEntry>>(thread_count));
+    std::vector<std::vector<MergeEntry>> deferred(thread_count);
+    std::vector<uint64_t> inserted(thread_count, 0);
+    std::vector<uint64_t> bucket_chains(thread_count, 0);
+
+    auto partition_slice = [&](uint8_t thread_id) {
+      const uint64_t first_bucket = (other.num_buckets_ * thread_id) / thread_count;
+      const uint64_t last_bucket = (other.num_buckets_ * (thread_id + 1)) / thread_count;
+
+      for (uint64_t bucket_idx = first_bucket; bucket_idx < last_bucket; ++bucket_idx) {
+        const BucketT& bucket = other.buckets_[bucket_idx];
+        for (uint16_t index_in_bucket = 0; index_in_bucket < bucket.get_num_entries(); ++index_in_bucket) {
+          const std::pair<KeyT, ValueT>& kv_pair = bucket.get_entry(index_in_bucket, other.bucket_keys_values(bucket_idx));
+          const hashing::BucketHash<FingerprintT> bucket_hash =
+              hasher_.template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(std::get<0>(kv_pair));
+          const uint64_t range = std::min(static_cast<uint64_t>(bucket_hash.bucket) / buckets_per_range, static_cast<uint64_t>(thread_count - 1));
+          partitions[thread_id][range].push_back(
+              {std::get<0>(kv_pair), std::get<1>(kv_pair), bucket_hash.fingerprint, static_cast<uint64_t>(bucket_hash.bucket)});
+        }
+      }
+    };
+
+    auto merge_range = [&](uint8_t range) {
+#ifdef HASHMAP_COLLECT_META_INFO
+      utils::MeasurementInfo range_minfo;
+#endif
+      const uint64_t last_bucket = (range == thread_count - 1) ? num_buckets_ : (range + 1) * buckets_per_range;
+      for (uint8_t slice = 0; slice < thread_count; ++slice) {
+        for (const MergeEntry& entry : partitions[slice][range]) {
+          DEBUG_ASSERT(entry.bucket_idx >= range * buckets_per_range && entry.bucket_idx < last_bucket, "Entry was assigned to the wrong range.");
+#ifdef HASHMAP_COLLECT_META_INFO
+          const bool merged = merge_entry_in_range(entry.key, entry.value, entry.fingerprint, entry.bucket_idx, last_bucket, combine_fn,
+                                                   &inserted[range], &bucket_chains[range], &range_minfo);
+#else
+          const bool merged = merge_entry_in_range(entry.key, entry.value, entry.fingerprint, entry.bucket_idx, last_bucket, combine_fn,
+                                                   &inserted[range], &bucket_chains[range]);
+#endif
+          if (!merged) {
+            deferred[range].push_back(entry);
+          }
+        }
+      }
+    };
+
+    auto run_on_threads = [&](auto&& func) {
+      std::vector<std::thread> workers;
+      for (uint8_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+        workers.push_back(std::thread(func, thread_id));
+      }
+      for (auto& worker : workers) {
+        worker.join();
+      }
+    };
+
+    run_on_threads(partition_slice);
+    run_on_threads(merge_range);
+
+    for (uint8_t range = 0; range < thread_count; ++range) {
+      size_ += inserted[range];
+      max_bucket_chain = std::max(max_bucket_chain, bucket_chains[range]);
+    }
+
+    for (const auto& range_deferred : deferred) {
+      for (const MergeEntry& entry : range_deferred) {
+        merge_entry(entry.key, entry.value, combine_fn);
+      }
     }
   }
 
   void prefault() {
-    for (auto& bucket : buckets_) {
-      bucket.prefault();
+    for (uint64_t bucket_idx = 0; bucket_idx < buckets_.size(); ++bucket_idx) {
+      buckets_[bucket_idx].prefault(bucket_keys_values(bucket_idx));
     }
 
     reset();
   }
 
   void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
-    for (auto& bucket : buckets_) {
-      bucket.prefault_pregenerated(prefault_data);
+    for (uint64_t bucket_idx = 0; bucket_idx < buckets_.size(); ++bucket_idx) {
+      buckets_[bucket_idx].prefault_pregenerated(prefault_data, bucket_keys_values(bucket_idx));
     }
 
     reset();
   }
 
   void reset() {
-    for (auto& bucket : buckets_) {
-      bucket.reset(invalid_fingerprint);
+    for (uint64_t bucket_idx = 0; bucket_idx < buckets_.size(); ++bucket_idx) {
+      buckets_[bucket_idx].reset(invalid_fingerprint, bucket_keys_values(bucket_idx));
     }
 
     size_ = 0;
+    reorganize_countdown_ = reorganize_interval;
   }
 
   std::string get_identifier() {
@@ -555,13 +1002,31 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
     std::string bucket_type = BucketT::to_string();
     std::string fps_per_bucket = fmt::format("{}FPPB", fingerprints_per_bucket);
 
-    return fmt::format("{}<{}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}>", base_identifier_, hasher_.get_identifier(),
-                       key_type, value_type, fingerprint_type, prefetching, thp, unroll, key_simd_type, algo, avx512, compare_result_type, sve,
-                       neon_algo_str, sve_broadcast, likely, bucket_type, fps_per_bucket, fingerprints, fallback);
+    std::string overflow = "NextBucketOverflow";
+    if constexpr (overflow_policy == BucketOverflowPolicy::SECONDARY_BUCKET) {
+      overflow = "SecondaryBucketOverflow";
+    } else if constexpr (overflow_policy == BucketOverflowPolicy::STASH) {
+      overflow = "StashOverflow";
+    }
+
+    std::string bucket_idx_type = fmt::format("{}BitBucketIdx", sizeof(BucketIdxT) * 8);
+
+    std::string reorganize = "NoReorganization";
+    if constexpr (reorganize_interval > 0) {
+      reorganize = fmt::format("Reorganize{}", reorganize_interval);
+    }
+
+    return fmt::format("{}<{}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}; {}>", base_identifier_,
+                       hasher_.get_identifier(), key_type, value_type, fingerprint_type, prefetching, thp, unroll, key_simd_type, algo, avx512,
+                       compare_result_type, sve, neon_algo_str, sve_broadcast, likely, bucket_type, fps_per_bucket, fingerprints, fallback, overflow,
+                       bucket_idx_type, reorganize);
   }
 
   uint64_t get_entry_size() { return 0; }
 
+  // Includes the stash buckets and the external key/value storage of the corresponding bucket layouts
+  uint64_t memory_usage() const { return buckets_.size() * sizeof(BucketT) + keys_values_.size() * sizeof(std::pair<KeyT, ValueT>); }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)buckets_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)buckets_.data()); }
@@ -569,7 +1034,11 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
   double get_current_load() { return static_cast<double>(size_) / static_cast<double>(max_elements_); }
 
   uint64_t get_num_buckets() { return num_buckets_; }
-  BucketT* get_ith_bucket(uint32_t i) { return &buckets_[i]; }
+  uint64_t get_num_stash_buckets() { return num_stash_buckets_; }
+  BucketT* get_ith_bucket(uint64_t i) { return &buckets_[i]; }
+  std::pair<KeyT, ValueT> get_entry(uint64_t bucket_idx, uint16_t index_in_bucket) const {
+    return buckets_[bucket_idx].get_entry(index_in_bucket, bucket_keys_values(bucket_idx));
+  }
   uint64_t get_current_size() { return size_; }
 
 #ifdef HASHMAP_COLLECT_META_INFO
@@ -580,10 +1049,93 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
 #endif
 
  protected:
+  // The slice of keys_values_ owned by bucket bucket_idx, or nullptr for buckets that store their keys and values themselves. Computing it here
+  // instead of storing a pointer in every bucket keeps the bucket metadata within its cache line.
+  HEDLEY_ALWAYS_INLINE auto bucket_keys_values(uint64_t bucket_idx) {
+    if constexpr (BucketT::stores_keys_values_externally) {
+      return keys_values_.data() + bucket_idx * BucketT::keys_values_per_bucket;
+    } else {
+      return nullptr;
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE auto bucket_keys_values(uint64_t bucket_idx) const {
+    if constexpr (BucketT::stores_keys_values_externally) {
+      return keys_values_.data() + bucket_idx * BucketT::keys_values_per_bucket;
+    } else {
+      return nullptr;
+    }
+  }
+
+  template <typename CombineFn>
+  HEDLEY_ALWAYS_INLINE void merge_entry(const KeyT& key, const ValueT& value, CombineFn& combine_fn) {
+    const hashing::BucketHash<FingerprintT> bucket_hash =
+        hasher_.template bucket_hash<FingerprintT, fingerprint_bucket_bits, invalid_fingerprint>(key);
+    const FingerprintT fingerprint = bucket_hash.fingerprint;
+    const FindResult result = find_impl(key, fingerprint, static_cast<BucketIdxT>(bucket_hash.bucket));
+
+    if (result.res.is_valid) {
+      if constexpr (stores_values) {
+        buckets_[result.bucket_idx].update(key, combine_fn(std::get<1>(result.res.key_value), value), result.res.index_in_bucket,
+                                           bucket_keys_values(result.bucket_idx));
+      }
+    } else {
+      DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+      insert_new(key, value, fingerprint, result);
+    }
+  }
+
+  // Like merge_entry, but only touches buckets [bucket_idx, last_bucket). Returns false if the entry could not be merged within that range.
+  template <typename CombineFn>
+#ifdef HASHMAP_COLLECT_META_INFO
+  bool merge_entry_in_range(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, uint64_t bucket_idx, uint64_t last_bucket,
+                            CombineFn& combine_fn, uint64_t* inserted, uint64_t* bucket_chain, utils::MeasurementInfo* range_minfo) {
+#else
+  bool merge_entry_in_range(const KeyT& key, const ValueT& value, const FingerprintT& fingerprint, uint64_t bucket_idx, uint64_t last_bucket,
+                            CombineFn& combine_fn, uint64_t* inserted, uint64_t* bucket_chain) {
+#endif
+    for (uint64_t probe_idx = bucket_idx; probe_idx < last_bucket; ++probe_idx) {
+#ifdef HASHMAP_COLLECT_META_INFO
+      const BucketingFindResult res = buckets_[probe_idx].find(key, fingerprint, bucket_keys_values(probe_idx), range_minfo);
+#else
+      const BucketingFindResult res = buckets_[probe_idx].find(key, fingerprint, bucket_keys_values(probe_idx));
+#endif
+      if (res.is_valid) {
+        if constexpr (stores_values) {
+          buckets_[probe_idx].update(key, combine_fn(std::get<1>(res.key_value), value), res.index_in_bucket, bucket_keys_values(probe_idx));
+        }
+        return true;
+      }
+
+      if (res.can_terminate) {
+        for (uint64_t insert_idx = probe_idx; insert_idx < last_bucket; ++insert_idx) {
+#ifdef HASHMAP_COLLECT_META_INFO
+          const bool insert_sucessful = buckets_[insert_idx].insert(key, value, fingerprint, bucket_keys_values(insert_idx), range_minfo);
+#else
+          const bool insert_sucessful = buckets_[insert_idx].insert(key, value, fingerprint, bucket_keys_values(insert_idx));
+#endif
+          if (insert_sucessful) {
+            ++(*inserted);
+            *bucket_chain = std::max(*bucket_chain, insert_idx - bucket_idx);
+            return true;
+          }
+        }
+        return false;
+      }
+    }
+    return false;
+  }
+
   typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<BucketT>, std::allocator<BucketT>>::type BucketVectorAllocator;
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<std::pair<KeyT, ValueT>>,
+                                    utils::AlignedAllocator<std::pair<KeyT, ValueT>, utils::cacheline_size>>::type KeyValueVectorAllocator;
+
   uint64_t num_buckets_;  // = 1 + (max_elements / fingerprints_per_bucket);
+  uint64_t num_stash_buckets_;
 
   alignas(utils::cacheline_size) std::vector<BucketT, BucketVectorAllocator> buckets_;
+  // Only used by buckets that store their keys and values externally, bucket i owns the entries [i * keys_values_per_bucket, (i + 1) * ...)
+  alignas(utils::cacheline_size) std::vector<std::pair<KeyT, ValueT>, KeyValueVectorAllocator> keys_values_;
 
   alignas(utils::cacheline_size) uint64_t max_elements_;
   alignas(utils::cacheline_size) uint64_t size_;
@@ -591,10 +1143,32 @@ class BucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
   alignas(utils::cacheline_size) constexpr static uint8_t fps_per_vector_ = (simd_size / 8) / sizeof(FingerprintT);
   std::string base_identifier_;
   uint64_t max_bucket_chain = 0;
+  uint64_t reorganize_countdown_ = reorganize_interval;  // eligible hits until the next promotion
 
 #ifdef HASHMAP_COLLECT_META_INFO
   utils::MeasurementInfo minfo;
 #endif
 };
 
+// Key-only set on KeyValueAoSStoringBuckets without values. Only the key/value array shrinks, the 32 B of fingerprints and fill metadata remain:
+// with 8 16-bit fingerprints, a bucket with 64-bit keys takes 96 B instead of the 160 B of one with 64-bit keys and values (3/5 of the size).
+template <typename KeyT, typename HasherT, typename FingerprintT = uint16_t, uint16_t fingerprints_per_bucket = 8, uint16_t simd_size = 128,
+          SIMDAlgorithm simd_algo = SIMDAlgorithm::TESTZ, bool use_avx512_features = false, bool use_sve = false,
+          NEONAlgo neon_algo = NEONAlgo::SSE2NEON, bool sve_scalar_broadcast = false, bool use_prefetching = false,
+          utils::PrefetchingLocality prefetching_locality = utils::PrefetchingLocality::MEDIUM, bool use_thp = false, bool use_likely_hints = false,
+          hashing::FingerprintBucketBits fingerprint_bucket_bits = hashing::FingerprintBucketBits::MSBLSB, FingerprintT invalid_fingerprint = 0,
+          BucketOverflowPolicy overflow_policy = BucketOverflowPolicy::NEXT_BUCKET, typename BucketIdxT = uint32_t, uint16_t reorganize_interval = 0>
+class BucketingSIMDHashSet
+    : public BucketingSIMDHashTable<KeyT, NoValue, HasherT, FingerprintT, KeyValueAoSStoringBucket, fingerprints_per_bucket, simd_size, simd_algo,
+                                    use_avx512_features, use_sve, neon_algo, sve_scalar_broadcast, use_prefetching, prefetching_locality, use_thp,
+                                    use_likely_hints, fingerprint_bucket_bits, invalid_fingerprint, overflow_policy, BucketIdxT,
+                                    reorganize_interval> {
+ public:
+  BucketingSIMDHashSet(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true)
+      : BucketingSIMDHashTable<KeyT, NoValue, HasherT, FingerprintT, KeyValueAoSStoringBucket, fingerprints_per_bucket, simd_size, simd_algo,
+                               use_avx512_features, use_sve, neon_algo, sve_scalar_broadcast, use_prefetching, prefetching_locality, use_thp,
+                               use_likely_hints, fingerprint_bucket_bits, invalid_fingerprint, overflow_policy, BucketIdxT,
+                               reorganize_interval>(max_elements, target_load_factor, print_info, "BucketingSIMDHashSet") {}
+};
+
 }  // namespace hashmap::hashmaps
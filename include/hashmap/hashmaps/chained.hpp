@@ -8,9 +8,11 @@
 #include <vector>
 
 #include "fmt/format.h"
+#include "hashmap/hashes/buckethash.hpp"
 #include "hashmap/hashmaps/hashmap.hpp"
 #include "hashmap/misc/stringkey.hpp"
 #include "hashmap/utils.hpp"
+#include "hedley.h"
 #include "spdlog/spdlog.h"
 
 using namespace hashmap;
@@ -32,19 +34,31 @@ struct ChainedHashTableEntry {
 } __attribute__((__packed__));
 
 // additional budget is in percent, e.g. 10 = 10% additional memory
+// With tagged_directory, the unused upper 16 bits of each directory pointer hold a Bloom-style tag of the hashes in its chain (two bits per
+// entry). A lookup whose bits are not all set in the tag is a miss without dereferencing the chain, which saves at least one cache miss into
+// the buffer for most misses on non-empty slots. New entries are then prepended to the chain, as the tag check cannot find its end.
 template <typename KeyT, typename ValueT, typename HasherT, bool use_thp = false, MemoryBudget budget = MemoryBudget::KeyValue,
-          uint8_t additional_budget = 10, bool set_bool_on_invalid_budget = false>
+          uint8_t additional_budget = 10, bool set_bool_on_invalid_budget = false, bool tagged_directory = false>
 class ChainedHashTable : public HashTable<KeyT, ValueT> {
   using HTE = ChainedHashTableEntry<KeyT, ValueT>;
 
+#if !defined(HASHMAP_IS_X86) && !defined(HASHMAP_IS_ARM)
+  static_assert(!tagged_directory, "Tagged directory pointers rely on 48-bit virtual addresses, which we only assume on x86-64 and AArch64.");
+#endif
+  static constexpr uint64_t tag_shift = 48;
+  static constexpr uint64_t pointer_mask = (1ULL << tag_shift) - 1;
+
  public:
   struct FindResult {
     uint64_t directory_idx = 0;
     HTE* entry;
     HTE* previous_entry;
     bool is_valid = false;
+    uint64_t tag = 0;  // tag bits of the key, only with tagged_directory
   };
 
+  constexpr static bool supports_arbitrary_capacity = HasherT::supports_arbitrary_range;
+
   static std::pair<uint64_t, uint64_t> calculate_directory_buffer_size(const uint64_t& max_elements, const uint8_t& target_load_factor) {
     const double additional_factor = 1.0 + (static_cast<double>(additional_budget) / 100.0);
     const uint64_t load_factor_elements =
@@ -66,8 +80,9 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
     spdlog::debug(fmt::format("Got a memory budget of {}, will insert {} elements, buffer memory usage is {}", memory_budget, load_factor_elements,
                               buffer_memory_usage));
 
+    // With arbitrary capacities (modulo or fastrange finalization), the directory sizes are max_elements halved instead of powers of two
     const int64_t pot = static_cast<int64_t>(std::log2(max_elements));
-    ASSERT(static_cast<uint64_t>(std::pow(2, pot)) == max_elements,
+    ASSERT(supports_arbitrary_capacity || static_cast<uint64_t>(std::pow(2, pot)) == max_elements,
            fmt::format("Could not obtain power of two of max_elements, pot = {}, max_elements = {}, {} =! {}", pot, max_elements,
                        static_cast<uint64_t>(std::pow(2, pot)), max_elements));
     spdlog::debug(fmt::format("Got pot = {}", pot));
@@ -141,14 +156,21 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
         next_free_element_{0},
         invalid_budget_{false},
         directory_pot_{static_cast<uint64_t>(std::log2(directory_.size()))} {
-    ASSERT(utils::is_power_of_two(max_elements),
-           fmt::format("ChainedHashMap currently only works for sizes that are a power of two, got {} instead.", max_elements));
+    ASSERT(supports_arbitrary_capacity || utils::is_power_of_two(max_elements),
+           fmt::format("ChainedHashMap only works for sizes that are a power of two unless the hasher uses modulo or fastrange finalization, got {} "
+                       "instead.",
+                       max_elements));
 
     if (directory_buffer_size_.first == 0 && directory_buffer_size_.second == 0) {
       spdlog::error("Got invalid budget, but setting bool instead. Make sure to check this bool and not use the hashmap.");
       invalid_budget_ = true;
     }
 
+    if constexpr (tagged_directory) {
+      ASSERT((reinterpret_cast<uintptr_t>(buffer_.data() + buffer_.size()) & ~pointer_mask) == 0,
+             fmt::format("Tagged directory requires buffer addresses below 2^48, got {}", (void*)buffer_.data()));
+    }
+
     if (print_info) {
       const uint64_t load_factor_elements =
           static_cast<uint64_t>(std::ceil((static_cast<double>(target_load_factor) / 100.0) * static_cast<double>(max_elements)));
@@ -201,6 +223,16 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
       DEBUG_ASSERT(res.entry == nullptr, "We are inserting a new element but entry is not nullptr");
 
       HTE* target = &buffer_[next_free_element_++];
+      target->key = key;
+      target->value = value;
+      ++size_;
+
+      if constexpr (tagged_directory) {
+        HTE* head = directory_[res.directory_idx];
+        target->next = untag(head);
+        directory_[res.directory_idx] = with_tag(target, tag_of(head) | res.tag);
+        return;
+      }
 
       // In case that previous element is nullptr, we need to update the dictionary, otherwise the next pointer of the previous element
       if (res.previous_entry == nullptr) {
@@ -208,10 +240,6 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
       } else {
         res.previous_entry->next = target;
       }
-
-      ++size_;
-      target->key = key;
-      target->value = value;
     } else {
       // just update the value of existing entry
       DEBUG_ASSERT(res.entry != nullptr, "Got valid nullptr");
@@ -229,14 +257,40 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
     }
 #endif
 
-    const uint64_t directory_idx = hasher_.hash(key);
+    uint64_t directory_idx = 0;
+    uint64_t tag = 0;
+    if constexpr (tagged_directory) {
+      const hashing::BucketHash<uint8_t> bucket_hash = hasher_.template bucket_hash<uint8_t, HasherT::independent_fingerprint_bits>(key);
+      directory_idx = bucket_hash.bucket;
+      tag = key_tag(bucket_hash.fingerprint);
+    } else {
+      directory_idx = hasher_.hash(key);
+    }
     HTE* current_entry = directory_[directory_idx];
     HTE* previous_entry = nullptr;
 
     bool entry_invalid = current_entry == nullptr;
 
     if (entry_invalid) {
-      return {directory_idx, current_entry, previous_entry, false};
+      return {directory_idx, current_entry, previous_entry, false, tag};
+    }
+
+    if constexpr (tagged_directory) {
+      const bool rejected = (tag_of(current_entry) & tag) != tag;
+      ++filter_checks_;
+      filter_rejections_ += rejected ? 1 : 0;
+
+#ifdef HASHMAP_COLLECT_META_INFO
+      if (minfo.measurement_started) {
+        ++(minfo.num_filter_checks);
+        minfo.num_filter_rejections += rejected ? 1 : 0;
+      }
+#endif
+
+      if (rejected) {
+        return {directory_idx, nullptr, previous_entry, false, tag};
+      }
+      current_entry = untag(current_entry);
     }
 
     while (current_entry->key != key) {
@@ -251,7 +305,7 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
       entry_invalid = current_entry == nullptr;
 
       if (entry_invalid) {
-        return {directory_idx, current_entry, previous_entry, false};
+        return {directory_idx, current_entry, previous_entry, false, tag};
       }
     }
 
@@ -262,7 +316,7 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
     }
 #endif
 
-    return {directory_idx, current_entry, previous_entry, true};
+    return {directory_idx, current_entry, previous_entry, true, tag};
   }
 
   void prefault() {
@@ -290,7 +344,7 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
   void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
     uint64_t prefault_data_size = prefault_data.size();
     for (uint64_t i = 0; i < directory_.size(); i++) {
-      if constexpr (!std::is_same_v<KeyT, StringKey>) {
+      if constexpr (std::is_integral_v<KeyT>) {
         directory_[i] = reinterpret_cast<HTE*>(prefault_data[i % prefault_data_size].first);
       } else {
         directory_[i] = reinterpret_cast<HTE*>(prefault_data[i % prefault_data_size].second);
@@ -317,6 +371,8 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
 
     next_free_element_ = 0;
     size_ = 0;
+    filter_checks_ = 0;
+    filter_rejections_ = 0;
   }
 
   std::string get_identifier() {
@@ -342,12 +398,18 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
     std::string bufsize_str = fmt::format("BufferSize{}", buffer_.size());
     std::string addelem_str = fmt::format("AdditionalElements{}", additional_elements_);
 
-    return fmt::format("ChainedHashTable<{}; {}; {}; {}; {}; {}; {}; {}; {}; {}>", hasher_.get_identifier(), key_type, value_type, thp, memory_budget,
-                       addbudget_str, pot_str, size_str, bufsize_str, addelem_str);
+    std::string identifier = fmt::format("ChainedHashTable<{}; {}; {}; {}; {}; {}; {}; {}; {}; {}", hasher_.get_identifier(), key_type, value_type,
+                                         thp, memory_budget, addbudget_str, pot_str, size_str, bufsize_str, addelem_str);
+    if constexpr (tagged_directory) {
+      identifier += "; TaggedDirectory";
+    }
+    return identifier + ">";
   }
 
   uint64_t get_entry_size() { return 0; }
 
+  uint64_t memory_usage() const { return directory_.size() * sizeof(HTE*) + buffer_.size() * sizeof(HTE); }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)buffer_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)buffer_.data()); }
@@ -358,6 +420,18 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
 
   bool can_be_used() { return !invalid_budget_; }
 
+  // Finds (of lookups and inserts) on non-empty directory slots, and how many of them the tag answered without dereferencing the chain
+  uint64_t get_num_filter_checks() const
+    requires tagged_directory
+  {
+    return filter_checks_;
+  }
+  uint64_t get_num_filter_rejections() const
+    requires tagged_directory
+  {
+    return filter_rejections_;
+  }
+
 #ifdef HASHMAP_COLLECT_META_INFO
   utils::MeasurementInfo* get_minfo() { return &minfo; }
   void start_measurement() { minfo.measurement_started = true; }
@@ -366,6 +440,18 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
 #endif
 
  protected:
+  // The two tag bits come from an 8-bit fingerprint of the same hash as the directory index, taken from bits that the index does not use. Hence,
+  // the tag is only as good as these bits: with identity-like hashers on small keys, they are constant and the tag rejects no lookup.
+  HEDLEY_ALWAYS_INLINE static uint64_t key_tag(uint8_t fingerprint) { return (1ULL << (fingerprint >> 4U)) | (1ULL << (fingerprint & 0xFU)); }
+
+  HEDLEY_ALWAYS_INLINE static uint64_t tag_of(const HTE* entry) { return reinterpret_cast<uintptr_t>(entry) >> tag_shift; }
+
+  HEDLEY_ALWAYS_INLINE static HTE* untag(const HTE* entry) { return reinterpret_cast<HTE*>(reinterpret_cast<uintptr_t>(entry) & pointer_mask); }
+
+  HEDLEY_ALWAYS_INLINE static HTE* with_tag(const HTE* entry, uint64_t tag) {
+    return reinterpret_cast<HTE*>(reinterpret_cast<uintptr_t>(entry) | (tag << tag_shift));
+  }
+
   typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<HTE*>, std::allocator<HTE*>>::type PtrVectorAllocator;
   typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<HTE>, std::allocator<HTE>>::type VectorAllocator;
   std::pair<uint64_t, uint64_t> directory_buffer_size_;
@@ -382,6 +468,8 @@ class ChainedHashTable : public HashTable<KeyT, ValueT> {
   bool invalid_budget_;
   uint64_t directory_pot_;
   uint64_t additional_elements_;
+  uint64_t filter_checks_ = 0;
+  uint64_t filter_rejections_ = 0;
 
 #ifdef HASHMAP_COLLECT_META_INFO
   utils::MeasurementInfo minfo;
@@ -87,6 +87,8 @@ class F14ValueHashTable : public HashTable<KeyT, ValueT> {
   }
   uint64_t get_entry_size() { return std::numeric_limits<uint64_t>::max(); }
 
+  uint64_t memory_usage() const { return static_cast<uint64_t>(map_.getAllocatedMemorySize()); }
+
   bool is_data_aligned_to(size_t /* alignment */) { return false; }
 
   std::string get_data_pointer_string() { return "0x0"; }
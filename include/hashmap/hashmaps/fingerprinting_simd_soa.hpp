@@ -60,6 +60,11 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
   using CompareResultIterator = typename SIMDH::CompareResultIterator;
   using MaskIteratorT = typename CompareResultIterator::MaskIteratorT;
 
+  // Instantiated with NoValue, this is a key-only set storing only keys next to the fingerprints
+  using Storage = KeyValueStorage<KeyT, ValueT>;
+  using EntryT = typename Storage::EntryT;
+  constexpr static bool stores_values = Storage::stores_values;
+
   struct FindResult {
     std::pair<KeyT, ValueT> key_value;
     FingerprintT fingerprint;
@@ -94,9 +99,15 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
       fingerprints_[result.index] = result.fingerprint;
     }
 
-    keys_values_[result.index] = {key, value};
+    keys_values_[result.index] = Storage::make_entry(key, value);
   };
 
+  void insert(const KeyT& key)
+    requires(!stores_values)
+  {
+    insert(key, NoValue{});
+  }
+
   FindResult find(const KeyT& key) {
 #ifdef HASHMAP_COLLECT_META_INFO
     if (minfo.measurement_started) {
@@ -186,10 +197,10 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
             const uint64_t next_vec_id = curr_adjusted_idx + next_match;
             DEBUG_ASSERT(next_vec_id < keys_values_.size(),
                          fmt::format("Got invalid next_vec_id {} ({}, {}, {})", next_vec_id, curr_adjusted_idx, next_match, keys_values_.size()));
-            const std::pair<KeyT, ValueT>& kv_pair = keys_values_[next_vec_id];
+            const EntryT& kv_pair = keys_values_[next_vec_id];
 
             if constexpr (use_likely_hints) {
-              if (HEDLEY_LIKELY(std::get<0>(kv_pair) == key)) [[likely]] {
+              if (HEDLEY_LIKELY(Storage::key(kv_pair) == key)) [[likely]] {
 #ifdef HASHMAP_COLLECT_META_INFO
                 if (minfo.measurement_started) {
                   minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
@@ -197,7 +208,7 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
                 }
 #endif
 
-                return {kv_pair, fingerprint, next_vec_id, true};
+                return {Storage::to_pair(kv_pair), fingerprint, next_vec_id, true};
               }
 #ifdef HASHMAP_COLLECT_META_INFO
               if (minfo.measurement_started) {
@@ -205,7 +216,7 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
               }
 #endif
             } else {
-              if (std::get<0>(kv_pair) == key) {
+              if (Storage::key(kv_pair) == key) {
 #ifdef HASHMAP_COLLECT_META_INFO
                 if (minfo.measurement_started) {
                   minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
@@ -213,7 +224,7 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
                 }
 #endif
 
-                return {kv_pair, fingerprint, next_vec_id, true};
+                return {Storage::to_pair(kv_pair), fingerprint, next_vec_id, true};
               }
 #ifdef HASHMAP_COLLECT_META_INFO
               if (minfo.measurement_started) {
@@ -238,17 +249,17 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
           const uint64_t next_vec_id = curr_adjusted_idx + next_match;
           DEBUG_ASSERT(next_vec_id < keys_values_.size(),
                        fmt::format("Got invalid next_vec_id {} ({}, {}, {})", next_vec_id, curr_adjusted_idx, next_match, keys_values_.size()));
-          const std::pair<KeyT, ValueT>& kv_pair = keys_values_[next_vec_id];
+          const EntryT& kv_pair = keys_values_[next_vec_id];
 
           if constexpr (use_likely_hints) {
-            if (HEDLEY_LIKELY(std::get<0>(kv_pair) == key)) [[likely]] {
+            if (HEDLEY_LIKELY(Storage::key(kv_pair) == key)) [[likely]] {
 #ifdef HASHMAP_COLLECT_META_INFO
               if (minfo.measurement_started) {
                 minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
                 minfo.max_probing_sequence = std::max(minfo.max_probing_sequence, probing_seq_len);
               }
 #endif
-              return {kv_pair, fingerprint, next_vec_id, true};
+              return {Storage::to_pair(kv_pair), fingerprint, next_vec_id, true};
             }
 #ifdef HASHMAP_COLLECT_META_INFO
             if (minfo.measurement_started) {
@@ -256,14 +267,14 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
             }
 #endif
           } else {
-            if (std::get<0>(kv_pair) == key) {
+            if (Storage::key(kv_pair) == key) {
 #ifdef HASHMAP_COLLECT_META_INFO
               if (minfo.measurement_started) {
                 minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
                 minfo.max_probing_sequence = std::max(minfo.max_probing_sequence, probing_seq_len);
               }
 #endif
-              return {kv_pair, fingerprint, next_vec_id, true};
+              return {Storage::to_pair(kv_pair), fingerprint, next_vec_id, true};
             }
 #ifdef HASHMAP_COLLECT_META_INFO
             if (minfo.measurement_started) {
@@ -389,6 +400,40 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
     return {{KeyT{}, ValueT{}}, 0, 0, false};
   }
 
+  // Merges all entries of other into this table. If the key already exists, the stored value becomes combine_fn(existing_value, other_value).
+  // As both tables share the hash function, sweeping other's slots in order results in a mostly sequential pass over this table.
+  template <typename CombineFn>
+  void merge_from(const FingerprintingSIMDSoAHashTable& other, CombineFn combine_fn) {
+    merge_from(other, combine_fn, 0, other.max_elements_);
+  }
+
+  // Merges only the entries stored in other's slots [first_slot, last_slot).
+  template <typename CombineFn>
+  void merge_from(const FingerprintingSIMDSoAHashTable& other, CombineFn combine_fn, uint64_t first_slot, uint64_t last_slot) {
+    DEBUG_ASSERT(first_slot <= last_slot && last_slot <= other.max_elements_, "Invalid slot range to merge.");
+
+    for (uint64_t slot = first_slot; slot < last_slot; ++slot) {
+      if (other.fingerprints_[slot] == invalid_fingerprint) {
+        continue;
+      }
+
+      const EntryT& kv_pair = other.keys_values_[slot];
+      const FindResult& result = find(Storage::key(kv_pair));
+      DEBUG_ASSERT(result.index < max_elements_, "Got invalid key from find");
+
+      if (result.is_valid) {
+        if constexpr (stores_values) {
+          keys_values_[result.index] = {std::get<0>(kv_pair), combine_fn(std::get<1>(result.key_value), std::get<1>(kv_pair))};
+        }
+      } else {
+        DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+        ++size_;
+        fingerprints_[result.index] = result.fingerprint;
+        keys_values_[result.index] = kv_pair;
+      }
+    }
+  }
+
   void prefault() {
     std::random_device rd;
     std::mt19937 gen{rd()};
@@ -397,6 +442,8 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
     for (uint64_t i = 0; i < keys_values_.size(); i++) {
       if constexpr (!std::is_same_v<KeyT, StringKey> && !std::is_pointer_v<ValueT> && std::is_arithmetic_v<ValueT>) {
         keys_values_[i] = {dist(gen), dist(gen)};
+      } else if constexpr (!std::is_same_v<KeyT, StringKey> && !stores_values) {
+        keys_values_[i] = static_cast<KeyT>(dist(gen));
       }
       fingerprints_[i] = static_cast<FingerprintT>(dist(gen));
     }
@@ -407,7 +454,7 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
   void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
     uint64_t prefault_data_size = prefault_data.size();
     for (uint64_t i = 0; i < keys_values_.size(); i++) {
-      keys_values_[i] = prefault_data[i % prefault_data_size];
+      keys_values_[i] = Storage::make_entry(prefault_data[i % prefault_data_size]);
       fingerprints_[i] = 42;
     }
 
@@ -416,7 +463,7 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
 
   void reset() {
     for (uint64_t i = 0; i < keys_values_.size(); i++) {
-      keys_values_[i] = {KeyT(), ValueT()};
+      keys_values_[i] = EntryT{};
       fingerprints_[i] = invalid_fingerprint;
     }
 
@@ -494,6 +541,8 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
 
   uint64_t get_entry_size() { return 0; }
 
+  uint64_t memory_usage() const { return fingerprints_.size() * sizeof(FingerprintT) + keys_values_.size() * sizeof(EntryT); }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)fingerprints_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)fingerprints_.data()); }
@@ -509,14 +558,12 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
 #endif
 
  protected:
-  typedef
-      typename std::conditional<use_thp, utils::TransparentHugePageAllocator<std::pair<KeyT, ValueT>>, std::allocator<std::pair<KeyT, ValueT>>>::type
-          KeyValueVectorAllocator;
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<EntryT>, std::allocator<EntryT>>::type KeyValueVectorAllocator;
   typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<FingerprintT, SIMDH::_vector_alignment()>,
                                     utils::AlignedAllocator<FingerprintT, SIMDH::_vector_alignment()>>::type SIMDAlignedAllocator;
 
   alignas(utils::cacheline_size) std::vector<FingerprintT, SIMDAlignedAllocator> fingerprints_;
-  alignas(utils::cacheline_size) std::vector<std::pair<KeyT, ValueT>, KeyValueVectorAllocator> keys_values_;
+  alignas(utils::cacheline_size) std::vector<EntryT, KeyValueVectorAllocator> keys_values_;
 
   alignas(utils::cacheline_size) uint64_t max_elements_;
   alignas(utils::cacheline_size) uint64_t simd_padding_;
@@ -530,4 +577,22 @@ class FingerprintingSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
 #endif
 };
 
+// Key-only set, i.e., the second array holds only keys and a fingerprint match only loads the key
+template <typename KeyT, typename HasherT, typename FingerprintT = uint16_t, uint16_t simd_size = 128, SIMDAlgorithm simd_algo = SIMDAlgorithm::TESTZ,
+          bool use_avx512_features = false, bool use_sve = false, NEONAlgo neon_algo = NEONAlgo::SSE2NEON, bool sve_scalar_broadcast = false,
+          bool use_prefetching = false, utils::PrefetchingLocality prefetching_locality = utils::PrefetchingLocality::MEDIUM, bool use_thp = false,
+          bool use_likely_hints = false, hashing::FingerprintBucketBits fingerprint_bucket_bits = hashing::FingerprintBucketBits::LSBLSB,
+          FingerprintT invalid_fingerprint = 0>
+class FingerprintingSIMDSoAHashSet
+    : public FingerprintingSIMDSoAHashTable<KeyT, NoValue, HasherT, FingerprintT, simd_size, simd_algo, use_avx512_features, use_sve, neon_algo,
+                                            sve_scalar_broadcast, use_prefetching, prefetching_locality, use_thp, use_likely_hints,
+                                            fingerprint_bucket_bits, invalid_fingerprint> {
+ public:
+  FingerprintingSIMDSoAHashSet(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true)
+      : FingerprintingSIMDSoAHashTable<KeyT, NoValue, HasherT, FingerprintT, simd_size, simd_algo, use_avx512_features, use_sve, neon_algo,
+                                       sve_scalar_broadcast, use_prefetching, prefetching_locality, use_thp, use_likely_hints,
+                                       fingerprint_bucket_bits, invalid_fingerprint>(max_elements, target_load_factor, print_info,
+                                                            "FingerprintingSIMDSoAHashSet") {}
+};
+
 }  // namespace hashmap::hashmaps
@@ -0,0 +1,276 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/misc/value_arena.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Chained hash table for builds whose size is not known ahead of time. Entries are allocated from a chunked (huge page backed) slab that
+// grows on demand, and the directory grows by linear hashing: whenever the average chain length exceeds max_chain_load percent, the chain
+// at the split pointer is split into itself and one new slot at the end of the directory. After every doubling of the directory
+// (i.e., the split pointer wraps), relocate_chains copies all chains into a fresh slab in directory order, such that the entries of a chain
+// are contiguous in memory again. max_elements is only a hint for prefaulting, the table starts with initial_directory_size slots.
+template <typename KeyT, typename ValueT, typename HasherT, bool use_thp = true, bool relocate_chains = true, uint64_t initial_directory_size = 1024,
+          uint64_t max_chain_load = 100>
+class GrowingChainedHashTable : public HashTable<KeyT, ValueT> {
+  using HTE = ChainedHashTableEntry<KeyT, ValueT>;
+  // Chains link entries by pointer and never store slot ids, hence 64-bit ids cost nothing and do not cap the number of entries at 2^32
+  using SlabT = ValueArena<HTE, use_thp, utils::hugepage_size, uint64_t>;
+
+  static_assert(std::has_single_bit(initial_directory_size), "Linear hashing needs a power of two as initial directory size!");
+  static_assert(max_chain_load > 0, "The directory has to grow at some average chain length!");
+
+  // The hasher maps into [0; 2^32), linear hashing then uses as many of these bits as the current directory level requires. Once the directory
+  // spans the whole range, it stops growing and the chains get longer instead.
+  static constexpr uint64_t address_space_bits = 32;
+  static constexpr uint64_t max_directory_size = 1ULL << address_space_bits;
+
+ public:
+  struct FindResult {
+    uint64_t directory_idx = 0;
+    HTE* entry;
+    HTE* previous_entry;
+    bool is_valid = false;
+  };
+
+  GrowingChainedHashTable(uint64_t max_elements, uint8_t /*target_load_factor*/, bool print_info = true)
+      : max_elements_{max_elements}, hasher_(1ULL << address_space_bits) {
+    reset();
+
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized GrowingChainedHashTable with sizeof(HTE) = {}, entries per slab chunk = {}, initial directory size = {}",
+                               sizeof(HTE), SlabT::values_per_chunk, initial_directory_size));
+    }
+  }
+
+  bool contains(const KeyT& key) { return find(key).is_valid; }
+
+  ValueT lookup(const KeyT& key) {
+    const FindResult res = find(key);
+
+    DEBUG_ASSERT(!(res.is_valid && res.entry == nullptr), "Invalid state reached.");
+
+    if constexpr (std::is_pointer_v<ValueT>) {
+      return !res.is_valid ? nullptr : res.entry->value;
+    } else {
+      return !res.is_valid ? ValueT{} : res.entry->value;
+    }
+  };
+
+  void insert(const KeyT& key, const ValueT& value) {
+    FindResult res = find(key);
+
+    if (res.is_valid) {
+      DEBUG_ASSERT(res.entry->key == key, "Got valid result with non-matching key.");
+      res.entry->value = value;
+      return;
+    }
+
+    HTE* target = &slab_[slab_.allocate(HTE{key, value, nullptr})];
+    if (res.previous_entry == nullptr) {
+      directory_[res.directory_idx] = target;
+    } else {
+      res.previous_entry->next = target;
+    }
+    ++size_;
+
+    if (HEDLEY_UNLIKELY(size_ * 100 > directory_.size() * max_chain_load) && directory_.size() < max_directory_size) {
+      split();
+    }
+  };
+
+  FindResult find(const KeyT& key) {
+#ifdef HASHMAP_COLLECT_META_INFO
+    uint64_t probing_seq_len = 1;
+    if (minfo.measurement_started) {
+      ++(minfo.num_finds);
+      ++(minfo.probed_elements);
+    }
+#endif
+
+    const uint64_t directory_idx = address(hasher_.hash(key));
+    HTE* current_entry = directory_[directory_idx];
+    HTE* previous_entry = nullptr;
+
+    if (current_entry == nullptr) {
+      return {directory_idx, current_entry, previous_entry, false};
+    }
+
+    while (current_entry->key != key) {
+#ifdef HASHMAP_COLLECT_META_INFO
+      if (minfo.measurement_started) {
+        ++(minfo.probed_elements);
+        ++probing_seq_len;
+      }
+#endif
+      previous_entry = current_entry;
+      current_entry = current_entry->next;
+
+      if (current_entry == nullptr) {
+        return {directory_idx, current_entry, previous_entry, false};
+      }
+    }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+    if (minfo.measurement_started) {
+      minfo.min_probing_sequence = std::min(minfo.min_probing_sequence, probing_seq_len);
+      minfo.max_probing_sequence = std::max(minfo.max_probing_sequence, probing_seq_len);
+    }
+#endif
+
+    return {directory_idx, current_entry, previous_entry, true};
+  }
+
+  // We cannot prefault a directory whose final size we do not know, but we can touch the slab chunks for max_elements entries
+  void prefault() {
+    slab_.reserve(max_elements_);
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& /*prefault_data*/) { prefault(); }
+
+  void reset() {
+    directory_.assign(initial_directory_size, nullptr);
+    slab_.reset();
+    level_size_ = initial_directory_size;
+    split_idx_ = 0;
+    size_ = 0;
+    num_relocations_ = 0;
+  }
+
+  std::string get_identifier() {
+    std::string thp = "NoTHP";
+    if constexpr (use_thp) {
+      thp = "THP";
+    }
+
+    std::string value_type = hashmap::utils::data_type_to_str<ValueT>();
+    std::string key_type = hashmap::utils::data_type_to_str<KeyT>();
+    std::string relocate = relocate_chains ? "RelocateChains" : "NoRelocation";
+
+    return fmt::format("GrowingChainedHashTable<{}; {}; {}; {}; {}; InitialDirectorySize{}; MaxChainLoad{}>", hasher_.get_identifier(), key_type,
+                       value_type, thp, relocate, initial_directory_size, max_chain_load);
+  }
+
+  uint64_t get_entry_size() { return sizeof(HTE); }
+
+  // The slab keeps its chunks on reset, hence this is the peak usage since the last relocation
+  uint64_t memory_usage() const { return directory_.capacity() * sizeof(HTE*) + slab_.allocated_bytes(); }
+
+  bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)slab_.data(), alignment); }
+
+  std::string get_data_pointer_string() { return fmt::format("{}", (void*)slab_.data()); }
+
+  double get_current_load() { return static_cast<double>(size_) / static_cast<double>(max_elements_); }
+
+  uint64_t get_current_size() { return size_; }
+
+  uint64_t get_directory_size() const { return directory_.size(); }
+
+  uint64_t get_num_relocations() const { return num_relocations_; }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return &minfo; }
+  void start_measurement() { minfo.measurement_started = true; }
+  void stop_measurement() { minfo.measurement_started = false; }
+  void reset_measurement() { minfo.reset(); }
+#endif
+
+ protected:
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<HTE*>, std::allocator<HTE*>>::type PtrVectorAllocator;
+
+  // Slots below the split pointer have already been split in this round and use one more hash bit
+  HEDLEY_ALWAYS_INLINE uint64_t address(uint64_t hash) const {
+    const uint64_t directory_idx = hash & (level_size_ - 1);
+    return directory_idx < split_idx_ ? hash & ((level_size_ << 1U) - 1) : directory_idx;
+  }
+
+  void split() {
+    DEBUG_ASSERT(directory_.size() < max_directory_size, "Directory cannot grow beyond the hash range");
+    if (split_idx_ == 0) {
+      directory_.reserve(level_size_ << 1U);
+    }
+
+    // The order within both chains is kept, the entries themselves do not move
+    const uint64_t upper_idx = directory_.size();
+    HTE* current_entry = directory_[split_idx_];
+    directory_[split_idx_] = nullptr;
+    directory_.push_back(nullptr);
+
+    // HTE is packed, hence we remember the tail entries instead of pointers to their next members
+    HTE* lower_tail = nullptr;
+    HTE* upper_tail = nullptr;
+    while (current_entry != nullptr) {
+      HTE* next_entry = current_entry->next;
+      current_entry->next = nullptr;
+
+      const bool moves_up = (hasher_.hash(current_entry->key) & level_size_) != 0;
+      HTE*& tail = moves_up ? upper_tail : lower_tail;
+      if (tail == nullptr) {
+        directory_[moves_up ? upper_idx : split_idx_] = current_entry;
+      } else {
+        tail->next = current_entry;
+      }
+      tail = current_entry;
+      current_entry = next_entry;
+    }
+
+    if (++split_idx_ == level_size_) {
+      level_size_ <<= 1U;
+      split_idx_ = 0;
+      if constexpr (relocate_chains) {
+        relocate();
+      }
+    }
+  }
+
+  // Copies every chain into consecutive entries of a new slab, walking the directory in order
+  void relocate() {
+    SlabT relocated_slab;
+    relocated_slab.reserve(size_);
+
+    for (HTE*& head : directory_) {
+      HTE* tail = nullptr;
+      for (HTE* current_entry = head; current_entry != nullptr; current_entry = current_entry->next) {
+        HTE* target = &relocated_slab[relocated_slab.allocate(HTE{current_entry->key, current_entry->value, nullptr})];
+        if (tail == nullptr) {
+          head = target;
+        } else {
+          tail->next = target;
+        }
+        tail = target;
+      }
+    }
+
+    slab_ = std::move(relocated_slab);
+    ++num_relocations_;
+  }
+
+  alignas(utils::cacheline_size) std::vector<HTE*, PtrVectorAllocator> directory_;
+  alignas(utils::cacheline_size) SlabT slab_;
+  alignas(utils::cacheline_size) uint64_t max_elements_;
+  alignas(utils::cacheline_size) uint64_t size_ = 0;
+  alignas(utils::cacheline_size) HasherT hasher_;
+
+  uint64_t level_size_ = initial_directory_size;
+  uint64_t split_idx_ = 0;
+  uint64_t num_relocations_ = 0;
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo minfo;
+#endif
+};
+
+}  // namespace hashmap::hashmaps
@@ -1,4 +1,9 @@
 #pragma once
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "hedley.h"
 
 namespace hashmap::hashmaps {
 
@@ -14,9 +19,63 @@ class HashTable {
   void reset();
 
   uint64_t get_entry_size();
+  // Bytes allocated for the stored data (slots, buckets, directories, filters, ...), excluding the table object itself
+  uint64_t memory_usage() const;
   std::string get_identifier();
 
   bool can_be_used() { return true; }
 };
 
+// Value type of key-only hash sets. Tables instantiated with NoValue store no values at all, i.e., more keys fit into a cache line.
+// Such sets offer insert(key), and contains is their only meaningful lookup.
+struct NoValue {
+  bool operator==(const NoValue&) const = default;
+};
+
+template <typename HashTableT>
+concept KeyOnlyHashSet = requires { requires !HashTableT::stores_values; };
+
+// Layout of a stored entry for tables keeping keys and values next to each other: a std::pair, or only the key for key-only sets
+template <typename KeyT, typename ValueT>
+struct KeyValueStorage {
+  constexpr static bool stores_values = !std::is_same_v<ValueT, NoValue>;
+  using EntryT = std::conditional_t<stores_values, std::pair<KeyT, ValueT>, KeyT>;
+
+  HEDLEY_ALWAYS_INLINE static const KeyT& key(const EntryT& entry) {
+    if constexpr (stores_values) {
+      return entry.first;
+    } else {
+      return entry;
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE static EntryT make_entry(const KeyT& key, const ValueT& value) {
+    if constexpr (stores_values) {
+      return {key, value};
+    } else {
+      return key;
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE static EntryT make_entry(const std::pair<KeyT, ValueT>& key_value) { return make_entry(key_value.first, key_value.second); }
+
+  HEDLEY_ALWAYS_INLINE static std::pair<KeyT, ValueT> to_pair(const EntryT& entry) {
+    if constexpr (stores_values) {
+      return entry;
+    } else {
+      return {entry, NoValue{}};
+    }
+  }
+};
+
+// For tables wrapping another table: not all hash tables take the print_info flag
+template <typename HashTableT>
+HashTableT construct_hashtable(uint64_t max_elements, uint8_t target_load_factor, bool print_info) {
+  if constexpr (std::is_constructible_v<HashTableT, uint64_t, uint8_t, bool>) {
+    return HashTableT(max_elements, target_load_factor, print_info);
+  } else {
+    return HashTableT(max_elements, target_load_factor);
+  }
+}
+
 }  // namespace hashmap::hashmaps
@@ -0,0 +1,176 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Small 2-way set-associative cache of recently hit (key, value) pairs in front of an arbitrary hash table (HashTableT) for skewed lookups,
+// e.g., Zipf-distributed probes. Each set takes one cache line for 8-byte keys and values, i.e., the default 512 sets stay L1/L2-resident,
+// while the table itself is usually much larger than the LLC.
+// Admission uses a doorkeeper: every set remembers the tag of the last key that missed it, and a table hit only enters the cache if its key
+// was that last miss. Keys hence need two accesses in short succession to be admitted, such that one-off keys do not evict hot ones.
+// Admitted keys replace the less recently used way. Inserts update cached values in place, so the cache never returns stale values.
+// Negative lookups are not cached.
+template <typename KeyT, typename ValueT, typename HashTableT, typename HasherT, uint64_t cache_sets = 512>
+class HotKeyCachedHashTable : public HashTable<KeyT, ValueT> {
+  static_assert(std::has_single_bit(cache_sets), "The number of cache sets needs to be a power of two!");
+
+ public:
+  static constexpr uint8_t ways = 2;
+
+  struct alignas(utils::cacheline_size) CacheSet {
+    std::array<KeyT, ways> keys{};
+    std::array<ValueT, ways> values{};
+    uint32_t candidate_tag = 0;  // tag of the last key that missed this set
+    uint8_t valid_ways = 0;      // bit i is set if way i holds an entry
+    uint8_t lru_way = 0;         // the way to replace on the next admission
+  };
+
+  HotKeyCachedHashTable(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true,
+                        std::string base_identifier = "HotKeyCachedHashTable")
+      : hashtable_{construct_hashtable<HashTableT>(max_elements, target_load_factor, print_info)},
+        sets_(cache_sets),
+        base_identifier_{base_identifier} {
+    if (print_info) {
+      spdlog::info(
+          fmt::format("Initialized {} with a {}-way cache of {} sets ({} bytes)", get_identifier(), ways, cache_sets, cache_size_in_bytes()));
+    }
+  }
+
+  bool contains(const KeyT& key) {
+    const uint64_t hash = cache_hash(key);
+    if (find_way(set_of(hash), key) < ways) {
+      ++cache_hits_;
+      return true;
+    }
+
+    return hashtable_.contains(key);
+  }
+
+  ValueT lookup(const KeyT& key) {
+    const uint64_t hash = cache_hash(key);
+    CacheSet& set = set_of(hash);
+    const uint8_t way = find_way(set, key);
+
+    if (way < ways) {
+      ++cache_hits_;
+      set.lru_way = static_cast<uint8_t>(way ^ 1U);
+      return set.values[way];
+    }
+
+    const ValueT value = hashtable_.lookup(key);
+
+    // Only the second access admits a key, at which point the table's cache lines are hot, so the extra contains is cheap
+    const uint32_t tag = tag_of(hash);
+    if (set.candidate_tag != tag) {
+      set.candidate_tag = tag;
+    } else if (hashtable_.contains(key)) {
+      const uint8_t victim = set.lru_way;
+      set.keys[victim] = key;
+      set.values[victim] = value;
+      set.valid_ways |= static_cast<uint8_t>(1U << victim);
+      set.lru_way = static_cast<uint8_t>(victim ^ 1U);
+    }
+
+    return value;
+  }
+
+  void insert(const KeyT& key, const ValueT& value) {
+    hashtable_.insert(key, value);
+
+    CacheSet& set = set_of(cache_hash(key));
+    const uint8_t way = find_way(set, key);
+    if (HEDLEY_UNLIKELY(way < ways)) {
+      set.values[way] = value;
+    }
+  }
+
+  void prefault() {
+    hashtable_.prefault();
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+    hashtable_.prefault_pregenerated(prefault_data);
+    reset();
+  }
+
+  void reset() {
+    hashtable_.reset();
+    std::fill(sets_.begin(), sets_.end(), CacheSet{});
+    cache_hits_ = 0;
+  }
+
+  std::string get_identifier() {
+    return fmt::format("{}<{}; {}; {}Sets; {}Ways>", base_identifier_, hashtable_.get_identifier(), HasherT(0).get_identifier(), cache_sets, ways);
+  }
+
+  // Identifier of the wrapped table, such that the benchmarks can relate the cached and the uncached runs
+  std::string get_uncached_identifier() { return hashtable_.get_identifier(); }
+
+  uint64_t get_entry_size() { return hashtable_.get_entry_size(); }
+
+  uint64_t memory_usage() const { return hashtable_.memory_usage() + cache_size_in_bytes(); }
+
+  bool is_data_aligned_to(size_t alignment) { return hashtable_.is_data_aligned_to(alignment); }
+
+  std::string get_data_pointer_string() { return hashtable_.get_data_pointer_string(); }
+
+  double get_current_load() { return hashtable_.get_current_load(); }
+
+  uint64_t get_current_size() { return hashtable_.get_current_size(); }
+
+  bool can_be_used() { return hashtable_.can_be_used(); }
+
+  // Number of lookups and contains calls answered by the cache since the last reset
+  uint64_t get_num_cache_hits() const { return cache_hits_; }
+
+  static constexpr uint64_t cache_size_in_bytes() { return cache_sets * sizeof(CacheSet); }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return hashtable_.get_minfo(); }
+  void start_measurement() { hashtable_.start_measurement(); }
+  void stop_measurement() { hashtable_.stop_measurement(); }
+#endif
+
+ protected:
+  // The table's hasher may be as simple as the identity, hence we mix its output before deriving the set and the tag
+  HEDLEY_ALWAYS_INLINE static uint64_t cache_hash(const KeyT& key) {
+    return hashing::MurmurHasher<uint64_t, false>::static_hash(static_cast<uint64_t>(HasherT::static_hash(key)));
+  }
+
+  HEDLEY_ALWAYS_INLINE CacheSet& set_of(uint64_t hash) { return sets_[hash & (cache_sets - 1)]; }
+
+  // The set comes from the lower bits, the tag from the upper ones
+  HEDLEY_ALWAYS_INLINE static uint32_t tag_of(uint64_t hash) { return static_cast<uint32_t>(hash >> 32U); }
+
+  // Returns ways if the key is not cached in this set
+  HEDLEY_ALWAYS_INLINE static uint8_t find_way(const CacheSet& set, const KeyT& key) {
+    for (uint8_t way = 0; way < ways; ++way) {
+      if (((set.valid_ways >> way) & 1U) != 0 && set.keys[way] == key) {
+        return way;
+      }
+    }
+    return ways;
+  }
+
+  HashTableT hashtable_;
+  std::vector<CacheSet, utils::AlignedAllocator<CacheSet, utils::cacheline_size>> sets_;
+  uint64_t cache_hits_ = 0;
+  std::string base_identifier_;
+};
+
+}  // namespace hashmap::hashmaps
@@ -76,6 +76,21 @@ class LinearProbingAoSHashTable : public HashTable<KeyT, ValueT> {
     res.entry->value = value;
   };
 
+  // Returns the value stored for key. If key is missing, inserts it with value first, using the same probe.
+  ValueT lookup_or_insert(const KeyT& key, const ValueT& value) {
+    FindResult res = find(key);
+
+    if (!res.key_equal || !res.entry_valid) {
+      DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+      ++size_;
+      res.entry->key = key;
+      res.entry->value = value;
+      res.entry->is_valid = 1;
+    }
+
+    return res.entry->value;
+  }
+
   FindResult find(const KeyT& key) {
 #ifdef HASHMAP_COLLECT_META_INFO
     uint64_t probing_seq_len = 1;
@@ -158,6 +173,37 @@ class LinearProbingAoSHashTable : public HashTable<KeyT, ValueT> {
     return {curr_adjusted_idx, next_entry, !key_not_equal, entry_valid};
   }
 
+  // Merges all entries of other into this table. If the key already exists, the stored value becomes combine_fn(existing_value, other_value).
+  // As both tables share the hash function, sweeping other's slots in order results in a mostly sequential pass over this table.
+  template <typename CombineFn>
+  void merge_from(const LinearProbingAoSHashTable& other, CombineFn combine_fn) {
+    merge_from(other, combine_fn, 0, other.max_elements_);
+  }
+
+  // Merges only the entries stored in other's slots [first_slot, last_slot).
+  template <typename CombineFn>
+  void merge_from(const LinearProbingAoSHashTable& other, CombineFn combine_fn, uint64_t first_slot, uint64_t last_slot) {
+    DEBUG_ASSERT(first_slot <= last_slot && last_slot <= other.max_elements_, "Invalid slot range to merge.");
+
+    for (uint64_t slot = first_slot; slot < last_slot; ++slot) {
+      const EntryT& other_entry = other.entries_[slot];
+      if (!other_entry.is_valid) {
+        continue;
+      }
+
+      FindResult res = find(other_entry.key);
+      if (res.key_equal && res.entry_valid) {
+        res.entry->value = combine_fn(res.entry->value, other_entry.value);
+      } else {
+        DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+        ++size_;
+        res.entry->key = other_entry.key;
+        res.entry->value = other_entry.value;
+        res.entry->is_valid = 1;
+      }
+    }
+  }
+
   void prefault() {
     std::random_device rd;
     std::mt19937 gen{rd()};
@@ -223,6 +269,8 @@ class LinearProbingAoSHashTable : public HashTable<KeyT, ValueT> {
 
   uint64_t get_entry_size() { return static_cast<uint64_t>(sizeof(EntryT)); }
 
+  uint64_t memory_usage() const { return entries_.size() * sizeof(EntryT); }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)entries_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)entries_.data()); }
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -13,6 +14,7 @@
 #include "hashmap/hashmaps/hashmap.hpp"
 #include "hashmap/misc/stringkey.hpp"
 #include "hashmap/utils.hpp"
+#include "hedley.h"
 #include "spdlog/spdlog.h"
 
 using namespace hashmap;
@@ -25,8 +27,8 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
   LinearProbingSoAHashTable(uint64_t max_elements, uint8_t /*target_load_factor*/, bool print_info = true,
                             std::string base_identifier = "LinearProbingSoAHashTable")
       : keys_(max_elements),
-        values_(max_elements),
-        is_valids_(max_elements),
+        values_(stores_values ? max_elements : 0),
+        valid_words_((max_elements + 63) / 64),
         max_elements_{max_elements},
         size_{0},
         hasher_(max_elements),
@@ -40,6 +42,9 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
     }
   }
 
+  // Instantiated with NoValue, this is a key-only set without a value column
+  constexpr static bool stores_values = !std::is_same_v<ValueT, NoValue>;
+
   struct FindResult {
     uint64_t idx = 0;
     KeyT key;
@@ -54,7 +59,9 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
 
   ValueT lookup(const KeyT& key) {
     const FindResult res = find(key);
-    if constexpr (std::is_pointer_v<ValueT>) {
+    if constexpr (!stores_values) {
+      return ValueT{};
+    } else if constexpr (std::is_pointer_v<ValueT>) {
       return (!res.key_equal || !res.entry_valid) ? nullptr : values_[res.idx];
     } else {
       return (!res.key_equal || !res.entry_valid) ? ValueT{} : values_[res.idx];
@@ -69,12 +76,20 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
       // We are inserting a new element (no update)
       ++size_;
       keys_[res.idx] = key;
-      is_valids_[res.idx] = true;
+      set_valid(res.idx);
     }
 
-    values_[res.idx] = value;
+    if constexpr (stores_values) {
+      values_[res.idx] = value;
+    }
   };
 
+  void insert(const KeyT& key)
+    requires(!stores_values)
+  {
+    insert(key, NoValue{});
+  }
+
   FindResult find(const KeyT& key) {
     uint64_t curr_idx = hasher_.hash(key);
     uint64_t curr_adjusted_idx = curr_idx;
@@ -85,13 +100,13 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
     KeyT next_key = keys_[curr_adjusted_idx];
 
     bool key_not_equal = next_key != key;
-    bool entry_valid = is_valids_[curr_adjusted_idx];
+    bool entry_valid = is_valid(curr_adjusted_idx);
 
     auto loop_body = [&]() {
       curr_adjusted_idx = hasher_.finalize(++curr_idx);
       next_key = keys_[curr_adjusted_idx];
       key_not_equal = next_key != key;
-      entry_valid = is_valids_[curr_adjusted_idx];
+      entry_valid = is_valid(curr_adjusted_idx);
     };
 
     while (key_not_equal && entry_valid && curr_idx <= max_idx) {
@@ -116,6 +131,40 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
     return {curr_adjusted_idx, next_key, !key_not_equal, entry_valid};
   }
 
+  // Merges all entries of other into this table. If the key already exists, the stored value becomes combine_fn(existing_value, other_value).
+  // As both tables share the hash function, sweeping other's slots in order results in a mostly sequential pass over this table.
+  template <typename CombineFn>
+  void merge_from(const LinearProbingSoAHashTable& other, CombineFn combine_fn) {
+    merge_from(other, combine_fn, 0, other.max_elements_);
+  }
+
+  // Merges only the entries stored in other's slots [first_slot, last_slot).
+  template <typename CombineFn>
+  void merge_from(const LinearProbingSoAHashTable& other, CombineFn combine_fn, uint64_t first_slot, uint64_t last_slot) {
+    DEBUG_ASSERT(first_slot <= last_slot && last_slot <= other.max_elements_, "Invalid slot range to merge.");
+
+    for (uint64_t slot = first_slot; slot < last_slot; ++slot) {
+      if (!other.is_valid(slot)) {
+        continue;
+      }
+
+      const FindResult res = find(other.keys_[slot]);
+      if (res.key_equal && res.entry_valid) {
+        if constexpr (stores_values) {
+          values_[res.idx] = combine_fn(values_[res.idx], other.values_[slot]);
+        }
+      } else {
+        DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+        ++size_;
+        keys_[res.idx] = other.keys_[slot];
+        if constexpr (stores_values) {
+          values_[res.idx] = other.values_[slot];
+        }
+        set_valid(res.idx);
+      }
+    }
+  }
+
   void prefault() {
     std::random_device rd;
     std::mt19937 gen{rd()};
@@ -125,11 +174,11 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
       if constexpr (!std::is_same_v<KeyT, StringKey>) {
         keys_[i] = static_cast<KeyT>(dist(gen));
       }
-      if constexpr (!std::is_pointer_v<ValueT>) {
+      if constexpr (stores_values && !std::is_pointer_v<ValueT>) {
         values_[i] = static_cast<ValueT>(dist(gen));
       }
-      is_valids_[i] = true;
     }
+    std::fill(valid_words_.begin(), valid_words_.end(), ~0ULL);
 
     reset();
   }
@@ -138,9 +187,11 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
     uint64_t prefault_data_size = prefault_data.size();
     for (uint64_t i = 0; i < keys_.size(); i++) {
       keys_[i] = prefault_data[i % prefault_data_size].first;
-      values_[i] = prefault_data[i % prefault_data_size].second;
-      is_valids_[i] = true;
+      if constexpr (stores_values) {
+        values_[i] = prefault_data[i % prefault_data_size].second;
+      }
     }
+    std::fill(valid_words_.begin(), valid_words_.end(), ~0ULL);
 
     reset();
   }
@@ -148,9 +199,11 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
   void reset() {
     for (uint64_t i = 0; i < keys_.size(); i++) {
       keys_[i] = KeyT{};
-      values_[i] = ValueT{};
-      is_valids_[i] = false;
+      if constexpr (stores_values) {
+        values_[i] = ValueT{};
+      }
     }
+    std::fill(valid_words_.begin(), valid_words_.end(), 0);
 
     size_ = 0;
   }
@@ -173,6 +226,10 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
 
   uint64_t get_entry_size() { return static_cast<uint64_t>(sizeof(KeyT)); }
 
+  uint64_t memory_usage() const {
+    return keys_.size() * sizeof(KeyT) + values_.size() * sizeof(ValueT) + valid_words_.size() * sizeof(uint64_t);
+  }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)keys_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)keys_.data()); }
@@ -183,11 +240,17 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
  protected:
   typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<KeyT>, std::allocator<KeyT>>::type KeyTVectorAllocator;
   typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<ValueT>, std::allocator<ValueT>>::type ValueTVectorAllocator;
-  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<bool>, std::allocator<bool>>::type BoolVectorAllocator;
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<uint64_t>, std::allocator<uint64_t>>::type
+      ValidityVectorAllocator;
+
+  HEDLEY_ALWAYS_INLINE bool is_valid(uint64_t idx) const { return ((valid_words_[idx >> 6U] >> (idx & 63U)) & 1U) != 0; }
+
+  HEDLEY_ALWAYS_INLINE void set_valid(uint64_t idx) { valid_words_[idx >> 6U] |= 1ULL << (idx & 63U); }
 
   alignas(utils::cacheline_size) std::vector<KeyT, KeyTVectorAllocator> keys_;
   alignas(utils::cacheline_size) std::vector<ValueT, ValueTVectorAllocator> values_;
-  alignas(utils::cacheline_size) std::vector<bool, BoolVectorAllocator> is_valids_;
+  // One validity bit per slot. Unlike std::vector<bool>, the words are addressable, such that vectorized probes can gather them.
+  alignas(utils::cacheline_size) std::vector<uint64_t, ValidityVectorAllocator> valid_words_;
 
   alignas(utils::cacheline_size) uint64_t max_elements_;
   alignas(utils::cacheline_size) uint64_t size_;
@@ -195,4 +258,13 @@ class LinearProbingSoAHashTable : public HashTable<KeyT, ValueT> {
   std::string base_identifier_;
 };
 
+// Key-only set, i.e., no values array is allocated and inserts/lookups only touch the keys and validity flags
+template <typename KeyT, typename HasherT, bool use_thp = false, uint8_t unroll_factor = 1>
+class LinearProbingSoAHashSet : public LinearProbingSoAHashTable<KeyT, NoValue, HasherT, use_thp, unroll_factor> {
+ public:
+  LinearProbingSoAHashSet(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true)
+      : LinearProbingSoAHashTable<KeyT, NoValue, HasherT, use_thp, unroll_factor>(max_elements, target_load_factor, print_info,
+                                                                                  "LinearProbingSoAHashSet") {}
+};
+
 }  // namespace hashmap::hashmaps
@@ -126,6 +126,36 @@ class LinearProbingPackedSoAHashTable : public HashTable<KeyT, ValueT> {
     return {curr_adjusted_idx, next_key.key, !key_not_equal, next_key.is_valid};
   }
 
+  // Merges all entries of other into this table. If the key already exists, the stored value becomes combine_fn(existing_value, other_value).
+  // As both tables share the hash function, sweeping other's slots in order results in a mostly sequential pass over this table.
+  template <typename CombineFn>
+  void merge_from(const LinearProbingPackedSoAHashTable& other, CombineFn combine_fn) {
+    merge_from(other, combine_fn, 0, other.max_elements_);
+  }
+
+  // Merges only the entries stored in other's slots [first_slot, last_slot).
+  template <typename CombineFn>
+  void merge_from(const LinearProbingPackedSoAHashTable& other, CombineFn combine_fn, uint64_t first_slot, uint64_t last_slot) {
+    DEBUG_ASSERT(first_slot <= last_slot && last_slot <= other.max_elements_, "Invalid slot range to merge.");
+
+    for (uint64_t slot = first_slot; slot < last_slot; ++slot) {
+      if (!other.keys_[slot].is_valid) {
+        continue;
+      }
+
+      const KeyT key = other.keys_[slot].key;
+      const FindResult res = find(key);
+      if (res.key_equal && res.entry_valid) {
+        values_[res.idx] = combine_fn(values_[res.idx], other.values_[slot]);
+      } else {
+        DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+        ++size_;
+        keys_[res.idx] = PackedSoAKey<KeyT>(key);
+        values_[res.idx] = other.values_[slot];
+      }
+    }
+  }
+
   void prefault() {
     std::random_device rd;
     std::mt19937 gen{rd()};
@@ -180,6 +210,8 @@ class LinearProbingPackedSoAHashTable : public HashTable<KeyT, ValueT> {
 
   uint64_t get_entry_size() { return static_cast<uint64_t>(sizeof(KeyT)); }
 
+  uint64_t memory_usage() const { return keys_.size() * sizeof(PackedSoAKey<KeyT>) + values_.size() * sizeof(ValueT); }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)keys_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)keys_.data()); }
@@ -82,6 +82,9 @@ class MartinusRHFlatHashTable : public HashTable<KeyT, ValueT> {
   }
   uint64_t get_entry_size() { return std::numeric_limits<uint64_t>::max(); }
 
+  // The flat robin hood map stores one info byte per bucket next to the bucket array (ignoring the overflow buckets)
+  uint64_t memory_usage() const { return static_cast<uint64_t>(map_.mask() + 1) * (sizeof(std::pair<KeyT, ValueT>) + 1); }
+
   bool is_data_aligned_to(size_t /* alignment */) { return false; }
 
   std::string get_data_pointer_string() { return "0x0"; }
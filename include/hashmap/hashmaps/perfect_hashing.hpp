@@ -0,0 +1,375 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Static hash table built on a minimal perfect hash function in the spirit of PTHash (Pibiri and Trani, SIGIR 2021).
+// Keys are hashed into small buckets, and for every bucket we search a pilot value such that all keys of the bucket land in free slots.
+// A lookup is hence one access to the (small, usually cache-resident) pilot array plus one access to the slot holding fingerprint, key and value.
+// Non-members are rejected by the fingerprint, so only fingerprint matches have to compare the full key.
+// New keys are appended to a delta buffer until the next lookup (or an explicit call to build()), which (re)builds the hash function over the
+// built and the buffered keys. Updates of already built keys are done in place.
+template <typename KeyT, typename ValueT, typename HasherT, typename FingerprintT = uint16_t, bool use_thp = false, uint8_t keys_per_bucket = 4>
+class PerfectHashTable : public HashTable<KeyT, ValueT> {
+ public:
+  PerfectHashTable(uint64_t max_elements, uint8_t /*target_load_factor*/, bool print_info = true, std::string base_identifier = "PerfectHashTable")
+      : max_elements_{max_elements}, size_{0}, hasher_(max_elements), base_identifier_{base_identifier} {
+    static_assert(keys_per_bucket > 0, "keys_per_bucket needs to be at least 1!");
+    slots_.reserve(max_elements);
+
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} with utils::cacheline_size = {}, sizeof(SlotT) = {}, alignof(SlotT) = {}", get_identifier(),
+                               utils::cacheline_size, sizeof(SlotT), alignof(SlotT)));
+    }
+  }
+
+  struct SlotT {
+    KeyT key;
+    ValueT value;
+    FingerprintT fingerprint;
+  };
+
+  bool contains(const KeyT& key) { return find(key) != nullptr; }
+
+  ValueT lookup(const KeyT& key) {
+    const SlotT* slot = find(key);
+    if constexpr (std::is_pointer_v<ValueT>) {
+      return slot != nullptr ? slot->value : nullptr;
+    } else {
+      return slot != nullptr ? slot->value : ValueT{};
+    }
+  }
+
+  void insert(const KeyT& key, const ValueT& value) {
+    // The built keys stay valid until the next build, as it only replaces them once it is done
+    SlotT* slot = find_built(key);
+    if (slot != nullptr) {
+      slot->value = value;
+      return;
+    }
+
+    if (size_ + pending_.size() >= max_elements_) {
+      deduplicate_pending();
+    }
+
+    DEBUG_ASSERT(size_ + pending_.size() < max_elements_, "Hashmap is full!");
+    pending_.push_back({key, value});
+    is_built_ = false;
+  }
+
+  HEDLEY_ALWAYS_INLINE const SlotT* find(const KeyT& key) {
+    if (HEDLEY_UNLIKELY(!is_built_)) {
+      build();
+    }
+
+    return find_built(key);
+  }
+
+  // Constructs the minimal perfect hash function over all inserted keys. Is called implicitly on the first lookup after an insert.
+  void build() {
+    if (is_built_) {
+      return;
+    }
+
+    // Rebuild over the built keys and the delta buffer. Buffered keys are never contained in the built ones, as insert updates those in place.
+    pending_.reserve(size_ + pending_.size());
+    for (uint64_t i = 0; i < size_; ++i) {
+      pending_.push_back({slots_[i].key, slots_[i].value});
+    }
+
+    struct BuildEntry {
+      uint64_t hash;
+      uint64_t bucket;
+      uint64_t pending_idx;
+    };
+
+    num_buckets_ = std::max(static_cast<uint64_t>(1), (pending_.size() + keys_per_bucket - 1) / keys_per_bucket);
+
+    std::vector<BuildEntry> entries;
+    entries.reserve(pending_.size());
+    for (uint64_t i = 0; i < pending_.size(); ++i) {
+      const uint64_t hash = key_hash(pending_[i].first);
+      entries.push_back({hash, reduce(hash, num_buckets_), i});
+    }
+
+    // Order by bucket and hash. The stable sort keeps the insertion order for duplicate keys, of which we keep the last one.
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const BuildEntry& a, const BuildEntry& b) { return a.bucket < b.bucket || (a.bucket == b.bucket && a.hash < b.hash); });
+
+    uint64_t num_unique = 0;
+    for (uint64_t i = 0; i < entries.size(); ++i) {
+      if (i + 1 < entries.size() && entries[i].hash == entries[i + 1].hash) {
+        if (pending_[entries[i].pending_idx].first == pending_[entries[i + 1].pending_idx].first) {
+          continue;  // a later insert of the same key overrides this one
+        }
+
+        FAIL("Two different keys have the same 64 bit hash, cannot build a perfect hash function. Please use a different hash function.");
+      }
+      entries[num_unique++] = entries[i];
+    }
+    entries.resize(num_unique);
+
+    ASSERT(num_unique <= max_elements_, fmt::format("Cannot build perfect hash table over {} keys, the maximum is {}.", num_unique, max_elements_));
+
+    size_ = num_unique;
+    // We target a load of ~97% during the pilot search, positions beyond size_ are remapped to the free slots afterwards
+    table_size_ = size_ + size_ / 32 + 1;
+
+    // Buckets are processed in order of decreasing size, as large buckets are hardest to place
+    std::vector<uint64_t> bucket_begin(num_buckets_ + 1, 0);
+    for (const BuildEntry& entry : entries) {
+      ++bucket_begin[entry.bucket + 1];
+    }
+    for (uint64_t bucket = 0; bucket < num_buckets_; ++bucket) {
+      bucket_begin[bucket + 1] += bucket_begin[bucket];
+    }
+
+    std::vector<uint64_t> bucket_order(num_buckets_);
+    for (uint64_t bucket = 0; bucket < num_buckets_; ++bucket) {
+      bucket_order[bucket] = bucket;
+    }
+    std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](uint64_t a, uint64_t b) {
+      return bucket_begin[a + 1] - bucket_begin[a] > bucket_begin[b + 1] - bucket_begin[b];
+    });
+
+    pilots_.assign(num_buckets_, 0);
+    std::vector<bool> taken(table_size_, false);
+    std::vector<uint64_t> positions(entries.size());
+    std::vector<uint64_t> bucket_positions;
+
+    for (const uint64_t bucket : bucket_order) {
+      const uint64_t begin = bucket_begin[bucket];
+      const uint64_t end = bucket_begin[bucket + 1];
+      if (begin == end) {
+        break;  // all remaining buckets are empty
+      }
+
+      for (uint32_t pilot = 0;; ++pilot) {
+        ASSERT(pilot < max_pilot, fmt::format("Could not find a pilot for bucket {} with {} keys.", bucket, end - begin));
+
+        const uint64_t pilot_hash = hash_pilot(pilot);
+        bucket_positions.clear();
+        bool pilot_valid = true;
+
+        for (uint64_t i = begin; i < end && pilot_valid; ++i) {
+          const uint64_t position = reduce(mix(entries[i].hash ^ pilot_hash), table_size_);
+          pilot_valid = !taken[position] && std::find(bucket_positions.begin(), bucket_positions.end(), position) == bucket_positions.end();
+          bucket_positions.push_back(position);
+        }
+
+        if (pilot_valid) {
+          pilots_[bucket] = pilot;
+          for (uint64_t i = begin; i < end; ++i) {
+            positions[i] = bucket_positions[i - begin];
+            taken[positions[i]] = true;
+          }
+          break;
+        }
+      }
+    }
+
+    // Make the function minimal: positions >= size_ get remapped to the slots < size_ that are still free
+    remap_.assign(table_size_ - size_, 0);
+    uint64_t next_free = 0;
+    for (uint64_t position = size_; position < table_size_; ++position) {
+      if (taken[position]) {
+        while (taken[next_free]) {
+          ++next_free;
+        }
+        remap_[position - size_] = next_free++;
+      }
+    }
+
+    slots_.resize(size_);
+    for (uint64_t i = 0; i < entries.size(); ++i) {
+      const uint64_t position = positions[i] < size_ ? positions[i] : remap_[positions[i] - size_];
+      const std::pair<KeyT, ValueT>& kv_pair = pending_[entries[i].pending_idx];
+      slots_[position] = {std::get<0>(kv_pair), std::get<1>(kv_pair), fingerprint(entries[i].hash)};
+    }
+
+    pending_.clear();
+    is_built_ = true;
+  }
+
+  void prefault() {
+    std::random_device rd;
+    std::mt19937 gen{rd()};
+    std::uniform_int_distribution<uint64_t> dist{0, 0xDEADBEEF};
+
+    slots_.resize(max_elements_);
+    for (SlotT& slot : slots_) {
+      if constexpr (!std::is_same_v<KeyT, StringKey>) {
+        slot.key = static_cast<KeyT>(dist(gen));
+      }
+      if constexpr (!std::is_pointer_v<ValueT>) {
+        slot.value = static_cast<ValueT>(dist(gen));
+      }
+      slot.fingerprint = static_cast<FingerprintT>(dist(gen));
+    }
+
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+    uint64_t prefault_data_size = prefault_data.size();
+    slots_.resize(max_elements_);
+    for (uint64_t i = 0; i < slots_.size(); i++) {
+      slots_[i] = {prefault_data[i % prefault_data_size].first, prefault_data[i % prefault_data_size].second, 42};
+    }
+
+    reset();
+  }
+
+  void reset() {
+    slots_.clear();  // keeps the capacity, i.e., the prefaulted memory
+    pending_.clear();
+    pilots_.clear();
+    remap_.clear();
+    num_buckets_ = 0;
+    table_size_ = 0;
+    size_ = 0;
+    is_built_ = true;
+  }
+
+  std::string get_identifier() {
+    std::string thp = "NoTHP";
+    if constexpr (use_thp) {
+      thp = "THP";
+    }
+
+    std::string value_type = hashmap::utils::data_type_to_str<ValueT>();
+    std::string key_type = hashmap::utils::data_type_to_str<KeyT>();
+    std::string fingerprint_type = hashmap::utils::data_type_to_str<FingerprintT>();
+
+    return fmt::format("{}<{}; {}; {}; {}; {}; {}KPB>", base_identifier_, hasher_.get_identifier(), key_type, value_type, fingerprint_type, thp,
+                       keys_per_bucket);
+  }
+
+  uint64_t get_entry_size() { return static_cast<uint64_t>(sizeof(SlotT)); }
+
+  // reset() and build() keep the capacities of the vectors, hence we count the capacities including the pending keys
+  uint64_t memory_usage() const {
+    return slots_.capacity() * sizeof(SlotT) + pilots_.capacity() * sizeof(uint32_t) + remap_.capacity() * sizeof(uint64_t) +
+           pending_.capacity() * sizeof(std::pair<KeyT, ValueT>);
+  }
+
+  bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)slots_.data(), alignment); }
+
+  std::string get_data_pointer_string() { return fmt::format("{}", (void*)slots_.data()); }
+
+  double get_current_load() { return static_cast<double>(get_current_size()) / static_cast<double>(max_elements_); }
+
+  // Does not build the pending keys, hence duplicates in the delta buffer are counted once without modifying it
+  uint64_t get_current_size() const {
+    const std::vector<std::pair<uint64_t, uint64_t>> order = pending_by_hash();
+    uint64_t num_pending = 0;
+    for (uint64_t i = 0; i < order.size(); ++i) {
+      num_pending += is_overridden_pending(order, i) ? 0 : 1;
+    }
+
+    return size_ + num_pending;
+  }
+
+ protected:
+  constexpr static uint32_t max_pilot = 1U << 24;
+
+  HEDLEY_ALWAYS_INLINE SlotT* find_built(const KeyT& key) {
+    if (HEDLEY_UNLIKELY(size_ == 0)) {
+      return nullptr;
+    }
+
+    const uint64_t hash = key_hash(key);
+    const uint64_t position = reduce(mix(hash ^ hash_pilot(pilots_[reduce(hash, num_buckets_)])), table_size_);
+    SlotT* slot = &slots_[position < size_ ? position : remap_[position - size_]];
+
+    if (slot->fingerprint == fingerprint(hash) && slot->key == key) {
+      return slot;
+    }
+
+    return nullptr;
+  }
+
+  // Hashes and indices of the buffered inserts, ordered by hash. The stable sort keeps the insertion order for equal hashes.
+  std::vector<std::pair<uint64_t, uint64_t>> pending_by_hash() const {
+    std::vector<std::pair<uint64_t, uint64_t>> order;
+    order.reserve(pending_.size());
+    for (uint64_t i = 0; i < pending_.size(); ++i) {
+      order.emplace_back(key_hash(pending_[i].first), i);
+    }
+
+    std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    return order;
+  }
+
+  // Whether a later insert of the same key follows order[i]. Keys with equal hashes are adjacent, but not necessarily equal.
+  bool is_overridden_pending(const std::vector<std::pair<uint64_t, uint64_t>>& order, uint64_t i) const {
+    for (uint64_t j = i + 1; j < order.size() && order[j].first == order[i].first; ++j) {
+      if (pending_[order[j].second].first == pending_[order[i].second].first) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // Keeps the last insert of every key in the delta buffer
+  void deduplicate_pending() {
+    const std::vector<std::pair<uint64_t, uint64_t>> order = pending_by_hash();
+    std::vector<bool> keep(pending_.size(), false);
+    for (uint64_t i = 0; i < order.size(); ++i) {
+      keep[order[i].second] = !is_overridden_pending(order, i);
+    }
+
+    uint64_t num_kept = 0;
+    for (uint64_t i = 0; i < pending_.size(); ++i) {
+      if (keep[i]) {
+        pending_[num_kept++] = pending_[i];
+      }
+    }
+    pending_.resize(num_kept);
+  }
+
+  HEDLEY_ALWAYS_INLINE static uint64_t mix(uint64_t x) { return hashing::MurmurHasher<uint64_t, false>::static_hash(x); }
+
+  HEDLEY_ALWAYS_INLINE static uint64_t key_hash(const KeyT& key) { return mix(static_cast<uint64_t>(HasherT::static_hash(key))); }
+
+  HEDLEY_ALWAYS_INLINE static uint64_t hash_pilot(uint32_t pilot) { return mix(static_cast<uint64_t>(pilot) + utils::multiply_constant_64b); }
+
+  // Maps x to [0, range) without a division, see Lemire, "Fast Random Integer Generation in an Interval"
+  HEDLEY_ALWAYS_INLINE static uint64_t reduce(uint64_t x, uint64_t range) {
+    return static_cast<uint64_t>((static_cast<uint128_t>(x) * static_cast<uint128_t>(range)) >> 64);
+  }
+
+  HEDLEY_ALWAYS_INLINE static FingerprintT fingerprint(uint64_t hash) { return static_cast<FingerprintT>(hash); }
+
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<SlotT>, std::allocator<SlotT>>::type SlotVectorAllocator;
+
+  alignas(utils::cacheline_size) std::vector<SlotT, SlotVectorAllocator> slots_;
+  alignas(utils::cacheline_size) std::vector<uint32_t> pilots_;
+  alignas(utils::cacheline_size) std::vector<uint64_t> remap_;
+  std::vector<std::pair<KeyT, ValueT>> pending_;
+
+  alignas(utils::cacheline_size) uint64_t max_elements_;
+  alignas(utils::cacheline_size) uint64_t size_;
+  uint64_t num_buckets_ = 0;
+  uint64_t table_size_ = 0;
+  bool is_built_ = true;
+  alignas(utils::cacheline_size) HasherT hasher_;
+  std::string base_identifier_;
+};
+
+}  // namespace hashmap::hashmaps
@@ -0,0 +1,413 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/simd_utils.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Bucketed SIMD hash table with quotient-style key compression. Keys are hashed by multiplying with an odd constant (as in MultShift64BHasher),
+// which is a bijection on the key domain. The upper bits of the hash select the bucket (the quotient), hence a bucket only has to store the
+// remaining lower bits (the remainder) to identify a key, and the full key can be rebuilt from bucket index and remainder (see get_entry).
+// Remainders are packed into remainder_bytes bytes next to the fingerprints. Entries that overflowed into one of the following buckets store their
+// distance to the home bucket in the spare bits of their remainder_bytes, so the comparison of remainders stays a single integer comparison.
+// The more buckets, the fewer bits a remainder has: With 64-bit keys and 6-byte remainders, the table needs at least 2^20 buckets (2^23 entries).
+// Smaller tables report that they cannot be used.
+template <typename KeyT, typename ValueT, typename FingerprintT = uint16_t, uint8_t remainder_bytes = 6, uint16_t fingerprints_per_bucket = 8,
+          uint16_t simd_size = 128, SIMDAlgorithm simd_algo = SIMDAlgorithm::TESTZ, bool use_thp = false>
+class QuotientBucketingSIMDHashTable : public HashTable<KeyT, ValueT> {
+ public:
+  using SIMDH = SIMDHelper<FingerprintT, simd_size, simd_algo, false, use_thp, false, NEONAlgo::SSE2NEON, false>;
+  using vector_type = typename SIMDH::vector_type;
+  using MaskOrVectorInputType = typename SIMDH::MaskOrVectorInputType;
+  using LoadPtrT = typename SIMDH::LoadPtrT;
+  using CompareT = typename SIMDH::CompareT;
+  using CompareResultIterator = typename SIMDH::CompareResultIterator;
+  using MaskIteratorT = typename CompareResultIterator::MaskIteratorT;
+
+  constexpr static bool stores_values = !std::is_same_v<ValueT, NoValue>;
+  constexpr static uint64_t key_bits = sizeof(KeyT) * 8;
+  constexpr static uint64_t fingerprint_bits = sizeof(FingerprintT) * 8;
+  constexpr static uint8_t fps_per_vector_ = (simd_size / 8) / sizeof(FingerprintT);
+  // Overflow chains of up to 15 buckets are enough for load factors well above 90%, fewer spare bits would let inserts fail
+  constexpr static uint64_t min_displacement_bits = 4;
+
+  // Odd, i.e., invertible modulo 2^key_bits. The inverse is computed by Newton's iteration, every step doubles the number of correct bits.
+  constexpr static KeyT multiplier = static_cast<KeyT>(utils::multiply_constant_64b);
+  constexpr static KeyT inverse_multiplier = [] {
+    KeyT inverse = multiplier;  // correct in the lowest three bits
+    for (uint8_t i = 0; i < 5; ++i) {
+      inverse = static_cast<KeyT>(inverse * static_cast<KeyT>(2 - multiplier * inverse));
+    }
+    return inverse;
+  }();
+
+  struct BucketT {
+    alignas(SIMDH::_vector_alignment()) std::array<FingerprintT, fps_per_vector_> fingerprints{};
+    uint8_t num_entries = 0;
+    bool overflowed = false;
+    std::array<uint8_t, fingerprints_per_bucket * remainder_bytes> remainders{};
+    [[no_unique_address]] std::conditional_t<stores_values, std::array<ValueT, fingerprints_per_bucket>, std::array<ValueT, 0>> values{};
+  };
+
+  struct FindResult {
+    uint64_t bucket_idx;
+    uint64_t displacement;
+    int32_t index_in_bucket;  // -1 if the key was not found
+  };
+
+  QuotientBucketingSIMDHashTable(uint64_t max_elements, uint8_t /*target_load_factor*/, bool print_info = true,
+                                 std::string base_identifier = "QuotientBucketingSIMDHashTable")
+      : num_buckets_{std::max(max_elements / fingerprints_per_bucket, static_cast<uint64_t>(1))},
+        bucket_bits_{static_cast<uint64_t>(std::log2(num_buckets_))},
+        remainder_bits_{key_bits - bucket_bits_},
+        remainder_mask_{remainder_bits_ == 64 ? ~static_cast<uint64_t>(0) : (static_cast<uint64_t>(1) << remainder_bits_) - 1},
+        displacement_shift_{std::min(remainder_bits_, static_cast<uint64_t>(63))},
+        buckets_(num_buckets_),
+        max_elements_{max_elements},
+        size_{0},
+        base_identifier_{base_identifier} {
+    static_assert(std::is_integral_v<KeyT> && std::is_unsigned_v<KeyT> && sizeof(KeyT) >= 4,
+                  "Key compression requires unsigned integer keys of at least 32 bits.");
+    static_assert(static_cast<KeyT>(multiplier * inverse_multiplier) == 1, "Hash function is not invertible.");
+    static_assert(remainder_bytes > 0 && remainder_bytes <= 8, "Remainders are packed into at most 8 bytes.");
+    static_assert(fingerprints_per_bucket <= fps_per_vector_, "All fingerprints of a bucket need to fit into one SIMD register.");
+
+    ASSERT(utils::is_power_of_two(max_elements) && utils::is_power_of_two(fingerprints_per_bucket),
+           fmt::format("QuotientBucketingSIMDHashTable requires a maximum size which is a power of two, got {}.", max_elements));
+
+    fail_if_system_is_incompatible<FingerprintT, simd_size, simd_algo, false, false, NEONAlgo::SSE2NEON, false>();
+
+    if (remainder_bits_ > remainder_bytes * 8 || remainder_bits_ < fingerprint_bits ||
+        remainder_bytes * 8 - remainder_bits_ < std::min(min_displacement_bits, bucket_bits_)) {
+      spdlog::error(fmt::format("{} buckets leave {} remainder bits, which do not fit into {} bytes with {} bits to spare for the displacement "
+                                "(or are fewer than the {} fingerprint bits). Make sure to check can_be_used and not use the hashmap.",
+                                num_buckets_, remainder_bits_, remainder_bytes, min_displacement_bits, fingerprint_bits));
+      invalid_remainder_width_ = true;
+    } else {
+      const uint64_t displacement_bits = remainder_bytes * 8 - remainder_bits_;
+      max_displacement_ = std::min(num_buckets_ - 1, (static_cast<uint64_t>(1) << displacement_bits) - 1);
+    }
+
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} with {} buckets of {} bytes, {} remainder bits, and a maximum displacement of {} buckets",
+                               get_identifier(), num_buckets_, sizeof(BucketT), remainder_bits_, max_displacement_));
+    }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+    minfo.num_buckets = num_buckets_;
+#endif
+  }
+
+  bool contains(const KeyT& key) { return find(key).index_in_bucket >= 0; }
+
+  ValueT lookup(const KeyT& key) {
+    const FindResult result = find(key);
+    if constexpr (!stores_values) {
+      return ValueT{};
+    } else if constexpr (std::is_pointer_v<ValueT>) {
+      return result.index_in_bucket >= 0 ? buckets_[result.bucket_idx].values[result.index_in_bucket] : nullptr;
+    } else {
+      return result.index_in_bucket >= 0 ? buckets_[result.bucket_idx].values[result.index_in_bucket] : ValueT{};
+    }
+  }
+
+  void insert(const KeyT& key, const ValueT& value) {
+    DEBUG_ASSERT(size_ + 1 <= max_elements_, "Hashmap is full!");
+    DEBUG_ASSERT(!invalid_remainder_width_, "Cannot insert into a table whose remainders do not fit, see can_be_used.");
+
+    const KeyT hash = hash_key(key);
+    const FingerprintT fingerprint = fingerprint_of(hash);
+    const uint64_t remainder = static_cast<uint64_t>(hash) & remainder_mask_;
+    const FindResult result = find_impl(fingerprint, remainder, home_bucket_of(hash));
+
+    if (result.index_in_bucket >= 0) {
+      if constexpr (stores_values) {
+        buckets_[result.bucket_idx].values[result.index_in_bucket] = value;
+      }
+      return;
+    }
+
+    uint64_t bucket_idx = result.bucket_idx;
+    uint64_t displacement = result.displacement;
+    while (buckets_[bucket_idx].num_entries == fingerprints_per_bucket) {
+#ifdef HASHMAP_COLLECT_META_INFO
+      if (!buckets_[bucket_idx].overflowed) {
+        ++(minfo.num_overflows);
+      }
+#endif
+      buckets_[bucket_idx].overflowed = true;
+      bucket_idx = (bucket_idx + 1) & (num_buckets_ - 1);
+      ++displacement;
+      ASSERT(displacement <= max_displacement_,
+             fmt::format("The {} spare bits of the remainders only allow entries up to {} buckets away from their home bucket. Use more "
+                         "remainder_bytes or a lower load factor.",
+                         remainder_bytes * 8 - remainder_bits_, max_displacement_));
+    }
+
+    BucketT& bucket = buckets_[bucket_idx];
+    const uint8_t index_in_bucket = bucket.num_entries++;
+    bucket.fingerprints[index_in_bucket] = fingerprint;
+    store_packed(bucket, index_in_bucket, pack(remainder, displacement));
+    if constexpr (stores_values) {
+      bucket.values[index_in_bucket] = value;
+    }
+
+    ++size_;
+    max_bucket_chain_ = std::max(max_bucket_chain_, displacement);
+  }
+
+  void insert(const KeyT& key)
+    requires(!stores_values)
+  {
+    insert(key, NoValue{});
+  }
+
+  HEDLEY_ALWAYS_INLINE FindResult find(const KeyT& key) {
+#ifdef HASHMAP_COLLECT_META_INFO
+    if (minfo.measurement_started) {
+      ++(minfo.num_finds);
+    }
+#endif
+
+    const KeyT hash = hash_key(key);
+    return find_impl(fingerprint_of(hash), static_cast<uint64_t>(hash) & remainder_mask_, home_bucket_of(hash));
+  }
+
+  // Rebuilds the key of the index_in_bucket-th entry of the bucket from the bucket index and the stored remainder
+  std::pair<KeyT, ValueT> get_entry(uint64_t bucket_idx, uint16_t index_in_bucket) const {
+    DEBUG_ASSERT(bucket_idx < num_buckets_ && index_in_bucket < buckets_[bucket_idx].num_entries, "Invalid entry.");
+    const BucketT& bucket = buckets_[bucket_idx];
+    const uint64_t packed = load_packed(bucket, index_in_bucket);
+    const uint64_t displacement = remainder_bits_ == 64 ? 0 : packed >> remainder_bits_;
+    const uint64_t home_bucket_idx = (bucket_idx - displacement) & (num_buckets_ - 1);
+
+    uint64_t hash = packed & remainder_mask_;
+    if (bucket_bits_ > 0) {
+      hash |= home_bucket_idx << remainder_bits_;
+    }
+
+    const KeyT key = static_cast<KeyT>(inverse_multiplier * static_cast<KeyT>(hash));
+    if constexpr (stores_values) {
+      return {key, bucket.values[index_in_bucket]};
+    } else {
+      return {key, NoValue{}};
+    }
+  }
+
+  uint16_t get_num_entries(uint64_t bucket_idx) const { return buckets_[bucket_idx].num_entries; }
+  uint64_t get_num_buckets() const { return num_buckets_; }
+  uint64_t get_remainder_bits() const { return remainder_bits_; }
+  uint64_t get_max_displacement() const { return max_displacement_; }
+
+  void prefault() {
+    std::random_device rd;
+    std::mt19937 gen{rd()};
+    std::uniform_int_distribution<uint64_t> dist{0, 0xDEADBEEF};
+
+    for (BucketT& bucket : buckets_) {
+      for (uint16_t i = 0; i < fingerprints_per_bucket; ++i) {
+        bucket.fingerprints[i] = static_cast<FingerprintT>(dist(gen));
+        store_packed(bucket, i, dist(gen));
+        if constexpr (stores_values && !std::is_pointer_v<ValueT> && std::is_arithmetic_v<ValueT>) {
+          bucket.values[i] = static_cast<ValueT>(dist(gen));
+        }
+      }
+    }
+
+    reset();
+  }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) {
+    const uint64_t prefault_data_size = prefault_data.size();
+    uint64_t data_idx = 0;
+    for (BucketT& bucket : buckets_) {
+      for (uint16_t i = 0; i < fingerprints_per_bucket; ++i, ++data_idx) {
+        const std::pair<KeyT, ValueT>& kv_pair = prefault_data[data_idx % prefault_data_size];
+        bucket.fingerprints[i] = 42;
+        store_packed(bucket, i, static_cast<uint64_t>(kv_pair.first));
+        if constexpr (stores_values) {
+          bucket.values[i] = kv_pair.second;
+        }
+      }
+    }
+
+    reset();
+  }
+
+  void reset() {
+    std::fill(buckets_.begin(), buckets_.end(), BucketT{});
+    size_ = 0;
+    max_bucket_chain_ = 0;
+  }
+
+  std::string get_identifier() {
+    std::string thp = "NoTHP";
+    if constexpr (use_thp) {
+      thp = "THP";
+    }
+
+    std::string algo = "";
+    if constexpr (simd_algo == SIMDAlgorithm::TESTZ) {
+      algo = "TESTZ";
+    } else if constexpr (simd_algo == SIMDAlgorithm::NO_TESTZ) {
+      algo = "NO_TESTZ";
+    }
+
+    std::string value_type = hashmap::utils::data_type_to_str<ValueT>();
+    std::string key_type = hashmap::utils::data_type_to_str<KeyT>();
+    std::string fingerprint_type = hashmap::utils::data_type_to_str<FingerprintT>();
+
+    return fmt::format("{}<InvertibleMultShiftHasher; {}; {}; {}; {}RemainderBytes; {}FPPB; {}; {}; {}>", base_identifier_, key_type, value_type,
+                       fingerprint_type, remainder_bytes, fingerprints_per_bucket, simd_size, algo, thp);
+  }
+
+  uint64_t get_entry_size() { return static_cast<uint64_t>(sizeof(BucketT) / fingerprints_per_bucket); }
+
+  uint64_t memory_usage() const { return buckets_.size() * sizeof(BucketT); }
+
+  bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)buckets_.data(), alignment); }
+
+  std::string get_data_pointer_string() { return fmt::format("{}", (void*)buckets_.data()); }
+
+  double get_current_load() { return static_cast<double>(size_) / static_cast<double>(max_elements_); }
+  uint64_t get_current_size() { return size_; }
+
+  bool can_be_used() { return !invalid_remainder_width_; }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return &minfo; }
+  void start_measurement() { minfo.measurement_started = true; }
+  void stop_measurement() { minfo.measurement_started = false; }
+  void reset_measurement() { minfo.reset(); }
+#endif
+
+ protected:
+  HEDLEY_ALWAYS_INLINE static KeyT hash_key(const KeyT& key) { return static_cast<KeyT>(multiplier * key); }
+
+  HEDLEY_ALWAYS_INLINE uint64_t home_bucket_of(KeyT hash) const {
+    return bucket_bits_ == 0 ? 0 : static_cast<uint64_t>(hash) >> remainder_bits_;
+  }
+
+  // The upper bits of the remainder, i.e., the hash bits right below the bucket bits
+  HEDLEY_ALWAYS_INLINE FingerprintT fingerprint_of(KeyT hash) const {
+    FingerprintT fingerprint = static_cast<FingerprintT>(static_cast<uint64_t>(hash) >> (remainder_bits_ - fingerprint_bits));
+    if (HEDLEY_UNLIKELY(fingerprint == 0)) {
+      ++fingerprint;  // 0 marks free slots
+    }
+    return fingerprint;
+  }
+
+  HEDLEY_ALWAYS_INLINE uint64_t pack(uint64_t remainder, uint64_t displacement) const { return remainder | (displacement << displacement_shift_); }
+
+  HEDLEY_ALWAYS_INLINE static uint64_t load_packed(const BucketT& bucket, uint16_t index_in_bucket) {
+    uint64_t packed = 0;
+    for (uint8_t byte = 0; byte < remainder_bytes; ++byte) {
+      packed |= static_cast<uint64_t>(bucket.remainders[index_in_bucket * remainder_bytes + byte]) << (8U * byte);
+    }
+    return packed;
+  }
+
+  HEDLEY_ALWAYS_INLINE static void store_packed(BucketT& bucket, uint16_t index_in_bucket, uint64_t packed) {
+    for (uint8_t byte = 0; byte < remainder_bytes; ++byte) {
+      bucket.remainders[index_in_bucket * remainder_bytes + byte] = static_cast<uint8_t>(packed >> (8U * byte));
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE FindResult find_impl(FingerprintT fingerprint, uint64_t remainder, uint64_t bucket_idx) {
+    for (uint64_t displacement = 0;; ++displacement) {
+      BucketT& bucket = buckets_[bucket_idx];
+      const int32_t index_in_bucket = find_in_bucket(bucket, fingerprint, pack(remainder, displacement));
+
+      if (index_in_bucket >= 0 || !bucket.overflowed || displacement >= max_bucket_chain_) {
+        return {bucket_idx, displacement, index_in_bucket};
+      }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+      if (minfo.measurement_started) {
+        ++(minfo.num_overflows_followed);
+      }
+#endif
+      bucket_idx = (bucket_idx + 1) & (num_buckets_ - 1);
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE int32_t find_in_bucket(BucketT& bucket, FingerprintT fingerprint, uint64_t packed) {
+#ifdef HASHMAP_COLLECT_META_INFO
+    if (minfo.measurement_started) {
+      ++(minfo.probed_elements);
+      ++(minfo.simd_loads);
+      minfo.probed_elements_total += fingerprints_per_bucket;
+    }
+#endif
+
+    const vector_type fingerprints = SIMDH::vector_load_func_(reinterpret_cast<LoadPtrT>(&bucket.fingerprints[0]));
+    const CompareT compare_vector = SIMDH::vector_broadcast_func_(fingerprint);
+
+    MaskOrVectorInputType cmp_result;
+    if constexpr (utils::is_power) {
+      cmp_result = SIMDH::vector_cmp_func_(fingerprints, compare_vector, false);
+    } else {
+      cmp_result = SIMDH::vector_cmp_func_(fingerprints, compare_vector);
+    }
+
+    if constexpr (simd_algo == SIMDAlgorithm::TESTZ) {
+      if (!SIMDH::vector_any_nonzero(cmp_result)) {
+        return -1;
+      }
+    }
+
+    MaskIteratorT iterator = CompareResultIterator::initialize(cmp_result);
+    while (CompareResultIterator::has_next(iterator)) {
+      const uint16_t next_match = CompareResultIterator::next_match(iterator);
+      iterator = CompareResultIterator::next_it(iterator, next_match);
+
+      // Equal remainders at the same distance from the home bucket imply equal hashes, and thus equal keys
+      if (load_packed(bucket, next_match) == packed) {
+        return next_match;
+      }
+#ifdef HASHMAP_COLLECT_META_INFO
+      if (minfo.measurement_started) {
+        ++(minfo.num_collision);
+      }
+#endif
+    }
+
+    return -1;
+  }
+
+  typedef typename std::conditional<use_thp, utils::TransparentHugePageAllocator<BucketT>, std::allocator<BucketT>>::type BucketVectorAllocator;
+
+  uint64_t num_buckets_;
+  uint64_t bucket_bits_;
+  uint64_t remainder_bits_;
+  uint64_t remainder_mask_;
+  uint64_t displacement_shift_;  // = remainder_bits_, but a valid shift amount if there are no spare bits (the displacement is 0 then)
+  uint64_t max_displacement_ = 0;
+  uint64_t max_bucket_chain_ = 0;
+  bool invalid_remainder_width_ = false;
+
+  alignas(utils::cacheline_size) std::vector<BucketT, BucketVectorAllocator> buckets_;
+
+  alignas(utils::cacheline_size) uint64_t max_elements_;
+  alignas(utils::cacheline_size) uint64_t size_;
+  std::string base_identifier_;
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo minfo;
+#endif
+};
+
+}  // namespace hashmap::hashmaps
@@ -535,6 +535,8 @@ class UnchunkedSIMDSoAHashTable : public HashTable<KeyT, ValueT> {
 
   uint64_t get_entry_size() { return 0; }
 
+  uint64_t memory_usage() const { return keys_.size() * sizeof(KeyT) + values_.size() * sizeof(ValueT) + is_valids_.size() * sizeof(KeyT); }
+
   bool is_data_aligned_to(size_t alignment) { return utils::is_aligned((void*)keys_.data(), alignment); }
 
   std::string get_data_pointer_string() { return fmt::format("{}", (void*)keys_.data()); }
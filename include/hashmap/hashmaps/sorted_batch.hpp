@@ -0,0 +1,159 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+namespace hashmap::hashmaps {
+
+// Bulk lookups on an arbitrary hash table (HashTableT) that reorder the probe keys before probing. lookup_sorted_batch radix-partitions a batch
+// of keys by the upper bits of their hash into groups that each cover a cache-sized region (group_bytes) of the table, probes the groups one
+// after another, and writes every result to the original position of its key. The random accesses across the whole table hence become
+// accesses that stay within one region at a time, for the price of hashing every key twice and two additional passes over the batch.
+// The groups only match the table layout if HasherT maps the upper hash bits to the upper slot bits, as multiply-shift hashing with masking
+// and fastrange finalization do. With other hashers the results are still correct, the probes just do not gain any locality.
+// Scalar lookups and inserts are forwarded to the wrapped table.
+template <typename KeyT, typename ValueT, typename HashTableT, typename HasherT, uint64_t batch_size_ = 65536, uint64_t group_bytes = 262144>
+class SortedBatchHashTable : public HashTable<KeyT, ValueT> {
+  static_assert(batch_size_ > 0 && batch_size_ <= std::numeric_limits<uint32_t>::max(), "Positions within a batch are stored in 32 bits!");
+  static_assert(group_bytes > 0, "Groups need to cover at least one byte of the table!");
+
+ public:
+  constexpr static bool stores_values = !std::is_same_v<ValueT, NoValue>;
+  constexpr static uint64_t batch_size = batch_size_;
+  // More groups than keys per batch only add empty partitions, and the histogram should stay L1-resident
+  constexpr static uint64_t max_groups = std::min(std::bit_floor(batch_size), static_cast<uint64_t>(65536));
+  // Key-only sets answer existence checks
+  using BatchResultT = std::conditional_t<stores_values, ValueT, bool>;
+
+  SortedBatchHashTable(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true,
+                       std::string base_identifier = "SortedBatchHashTable")
+      : hashtable_{construct_hashtable<HashTableT>(max_elements, target_load_factor, print_info)},
+        group_ids_(batch_size),
+        sorted_keys_(batch_size),
+        sorted_positions_(batch_size),
+        group_offsets_(max_groups + 1),
+        base_identifier_{base_identifier} {
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} with {} groups per batch", get_identifier(), num_groups()));
+    }
+  }
+
+  bool contains(const KeyT& key) { return hashtable_.contains(key); }
+
+  ValueT lookup(const KeyT& key) { return hashtable_.lookup(key); }
+
+  void insert(const KeyT& key, const ValueT& value) { hashtable_.insert(key, value); }
+
+  void insert(const KeyT& key)
+    requires(!stores_values)
+  {
+    hashtable_.insert(key);
+  }
+
+  // Looks up keys[0, count) and writes the result for keys[i] to results[i]. count must not exceed batch_size.
+  void lookup_sorted_batch(const KeyT* keys, uint64_t count, BatchResultT* results) {
+    DEBUG_ASSERT(count <= batch_size, fmt::format("Batch of {} keys exceeds the batch size {}", count, batch_size));
+
+    const uint64_t groups = num_groups();
+    if (groups == 1) {
+      for (uint64_t i = 0; i < count; ++i) {
+        results[i] = probe(keys[i]);
+      }
+      return;
+    }
+
+    // 1. Count the keys per group, group g's count ends up in group_offsets_[g + 1]
+    const HasherT group_hasher(groups);
+    std::fill(group_offsets_.begin(), group_offsets_.begin() + static_cast<int64_t>(groups) + 1, 0);
+    for (uint64_t i = 0; i < count; ++i) {
+      const uint64_t group = group_hasher.hash(keys[i]);
+      DEBUG_ASSERT(group < groups, fmt::format("Group {} out of {} groups", group, groups));
+      group_ids_[i] = static_cast<uint32_t>(group);
+      ++group_offsets_[group + 1];
+    }
+
+    // 2. The prefix sum gives the first position of every group
+    for (uint64_t group = 1; group <= groups; ++group) {
+      group_offsets_[group] += group_offsets_[group - 1];
+    }
+
+    // 3. Scatter the keys into their groups, remembering where they came from
+    for (uint64_t i = 0; i < count; ++i) {
+      const uint32_t target = group_offsets_[group_ids_[i]]++;
+      sorted_keys_[target] = keys[i];
+      sorted_positions_[target] = static_cast<uint32_t>(i);
+    }
+
+    // 4. Probe group by group and write the results back to the original positions
+    for (uint64_t i = 0; i < count; ++i) {
+      results[sorted_positions_[i]] = probe(sorted_keys_[i]);
+    }
+  }
+
+  void prefault() { hashtable_.prefault(); }
+
+  void prefault_pregenerated(const std::vector<std::pair<KeyT, ValueT>>& prefault_data) { hashtable_.prefault_pregenerated(prefault_data); }
+
+  void reset() { hashtable_.reset(); }
+
+  std::string get_identifier() {
+    return fmt::format("{}<{}; {}; Batch{}; {}GroupBytes>", base_identifier_, hashtable_.get_identifier(), HasherT(0).get_identifier(), batch_size,
+                       group_bytes);
+  }
+
+  uint64_t get_entry_size() { return hashtable_.get_entry_size(); }
+
+  // The per-batch scratch buffers do not grow with the table, hence they are not accounted for
+  uint64_t memory_usage() const { return hashtable_.memory_usage(); }
+
+  bool is_data_aligned_to(size_t alignment) { return hashtable_.is_data_aligned_to(alignment); }
+
+  std::string get_data_pointer_string() { return hashtable_.get_data_pointer_string(); }
+
+  double get_current_load() { return hashtable_.get_current_load(); }
+
+  uint64_t get_current_size() { return hashtable_.get_current_size(); }
+
+  bool can_be_used() { return hashtable_.can_be_used(); }
+
+  // Power of two such that every group covers about group_bytes of the table, the table may grow, hence this is evaluated per batch
+  uint64_t num_groups() const {
+    const uint64_t regions = std::max((hashtable_.memory_usage() + group_bytes - 1) / group_bytes, static_cast<uint64_t>(1));
+    return std::min(std::bit_ceil(regions), max_groups);
+  }
+
+#ifdef HASHMAP_COLLECT_META_INFO
+  utils::MeasurementInfo* get_minfo() { return hashtable_.get_minfo(); }
+  void start_measurement() { hashtable_.start_measurement(); }
+  void stop_measurement() { hashtable_.stop_measurement(); }
+#endif
+
+ protected:
+  HEDLEY_ALWAYS_INLINE BatchResultT probe(const KeyT& key) {
+    if constexpr (stores_values) {
+      return hashtable_.lookup(key);
+    } else {
+      return hashtable_.contains(key);
+    }
+  }
+
+  HashTableT hashtable_;
+  std::vector<uint32_t> group_ids_;
+  std::vector<KeyT> sorted_keys_;
+  std::vector<uint32_t> sorted_positions_;
+  std::vector<uint32_t> group_offsets_;
+  std::string base_identifier_;
+};
+
+}  // namespace hashmap::hashmaps
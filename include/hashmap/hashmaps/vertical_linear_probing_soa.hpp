@@ -0,0 +1,371 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "fmt/format.h"
+#include "hashmap/hashmaps/hashmap.hpp"
+#include "hashmap/hashmaps/linear_probing_soa.hpp"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+#include "spdlog/spdlog.h"
+
+#if defined(HASHMAP_IS_X86) && defined(__AVX512F__) && defined(__AVX512CD__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+#include <immintrin.h>
+#endif
+
+namespace hashmap::hashmaps {
+
+// Linear probing on the arrays of LinearProbingSoAHashTable with vertically vectorized batch operations: instead of comparing one key against
+// several slots, every lane of a 512-bit register probes for a different key, i.e., 16 lanes for 32-bit keys and 8 lanes for 64-bit keys.
+// Per step, all lanes gather their current slot and its validity bit. Lanes that found their key or an empty slot retire, and expand loads
+// refill the freed lanes with the next keys of the batch, such that the gathers stay fully occupied until the batch runs dry.
+// Batch inserts detect lanes that write the same slot in the same step with vpconflict. Of these, only the lane holding the earliest key of
+// the batch writes, the others retry in the next step. Hence, every key ends up with the value of its last occurrence in the batch and all
+// lookups agree with inserting the keys one by one. The slot placement can differ, though: a later key whose probing sequence is shorter may
+// claim a slot before an earlier key reaches it (e.g., with 16 in slot 0, inserting {32, 1} with home slots 0 and 1 puts 1 into slot 1 and 32
+// into slot 2, one by one it would be the other way around).
+// This pays off for short probing sequences that rarely hit, e.g., 32-bit key probes with low hit rates. The scalar operations are inherited.
+// Without AVX-512F/CD, or for more than 2^31 slots (gathers take signed 32-bit indices), the batch operations probe key by key.
+template <typename KeyT, typename ValueT, typename HasherT, bool use_thp = false, uint64_t batch_size_ = 65536>
+class VerticalLinearProbingSoAHashTable : public LinearProbingSoAHashTable<KeyT, ValueT, HasherT, use_thp> {
+  using BaseT = LinearProbingSoAHashTable<KeyT, ValueT, HasherT, use_thp>;
+
+  static_assert(std::is_integral_v<KeyT> && (sizeof(KeyT) == 4 || sizeof(KeyT) == 8), "Lanes hold 32- or 64-bit integer keys!");
+  static_assert(std::is_same_v<ValueT, NoValue> || (sizeof(ValueT) == 8 && std::is_trivially_copyable_v<ValueT>),
+                "Values are gathered as 64-bit lanes!");
+  static_assert(batch_size_ > 0 && batch_size_ <= std::numeric_limits<int32_t>::max(), "Positions within a batch are held in 32-bit lanes!");
+
+ public:
+  using BaseT::stores_values;
+  constexpr static uint64_t batch_size = batch_size_;
+  constexpr static uint64_t max_vectorized_slots = 1ULL << 31U;
+#if defined(HASHMAP_IS_X86) && defined(__AVX512F__) && defined(__AVX512CD__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+  constexpr static uint32_t lanes = 64 / sizeof(KeyT);
+#else
+  constexpr static uint32_t lanes = 1;
+#endif
+  // Key-only sets answer existence checks
+  using BatchResultT = std::conditional_t<stores_values, ValueT, bool>;
+
+  VerticalLinearProbingSoAHashTable(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true)
+      : BaseT(max_elements, target_load_factor, false), homes_(batch_size) {
+    if (print_info) {
+      spdlog::info(fmt::format("Initialized {} ({} batch operations)", get_identifier(), is_vectorized() ? "vectorized" : "scalar"));
+    }
+  }
+
+  // Looks up keys[0, count) and writes the result for keys[i] to results[i]
+  void lookup_batch(const KeyT* keys, uint64_t count, BatchResultT* results) {
+    for (uint64_t offset = 0; offset < count; offset += batch_size) {
+      const auto chunk = static_cast<uint32_t>(std::min(batch_size, count - offset));
+#if defined(HASHMAP_IS_X86) && defined(__AVX512F__) && defined(__AVX512CD__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+      if (is_vectorized()) {
+        compute_homes(keys + offset, chunk);
+        lookup_vertical(keys + offset, chunk, results + offset);
+        continue;
+      }
+#endif
+
+      for (uint64_t i = offset; i < offset + chunk; ++i) {
+        if constexpr (stores_values) {
+          results[i] = this->lookup(keys[i]);
+        } else {
+          results[i] = this->contains(keys[i]);
+        }
+      }
+    }
+  }
+
+  // Inserts (or updates) keys[0, count) with values[0, count). For keys occurring multiple times in the batch, the last value wins.
+  void insert_batch(const KeyT* keys, const ValueT* values, uint64_t count) { insert_batch_impl(keys, values, count); }
+
+  void insert_batch(const KeyT* keys, uint64_t count)
+    requires(!stores_values)
+  {
+    insert_batch_impl(keys, nullptr, count);
+  }
+
+  bool is_vectorized() const { return lanes > 1 && this->max_elements_ <= max_vectorized_slots; }
+
+  std::string get_identifier() {
+    std::string thp = "NoTHP";
+    if constexpr (use_thp) {
+      thp = "THP";
+    }
+
+    std::string value_type = hashmap::utils::data_type_to_str<ValueT>();
+    std::string key_type = hashmap::utils::data_type_to_str<KeyT>();
+
+    return fmt::format("VerticalLinearProbingSoAHashTable<{}; {}; {}; {}; {}Lanes; Batch{}>", this->hasher_.get_identifier(), key_type, value_type,
+                       thp, lanes, batch_size);
+  }
+
+  // The per-batch home slots do not grow with the table, hence they are not accounted for
+  uint64_t memory_usage() const { return BaseT::memory_usage(); }
+
+ protected:
+  // Key-only sets pass no values
+  void insert_batch_impl(const KeyT* keys, const ValueT* values, uint64_t count) {
+    DEBUG_ASSERT(this->size_ + count <= this->max_elements_, "Hashmap may run full!");
+    for (uint64_t offset = 0; offset < count; offset += batch_size) {
+      const auto chunk = static_cast<uint32_t>(std::min(batch_size, count - offset));
+#if defined(HASHMAP_IS_X86) && defined(__AVX512F__) && defined(__AVX512CD__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+      if (is_vectorized()) {
+        compute_homes(keys + offset, chunk);
+        insert_vertical(keys + offset, values == nullptr ? nullptr : values + offset, chunk);
+        continue;
+      }
+#endif
+
+      for (uint64_t i = offset; i < offset + chunk; ++i) {
+        if constexpr (stores_values) {
+          this->insert(keys[i], values[i]);
+        } else {
+          this->insert(keys[i]);
+        }
+      }
+    }
+  }
+
+  // Hashing stays scalar, as HasherT is arbitrary. Doing it in a separate pass lets the refills expand-load the home slots like the keys.
+  void compute_homes(const KeyT* keys, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+      homes_[i] = static_cast<uint32_t>(this->hasher_.hash(keys[i]));
+    }
+  }
+
+#if defined(HASHMAP_IS_X86) && defined(__AVX512F__) && defined(__AVX512CD__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+// Unmasked AVX-512 intrinsics start from an "undefined" register, which GCC 12 reports as maybe uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+  // Slots, batch positions, and probe counts always occupy 32-bit lanes, of which the upper half stays unused for 64-bit keys
+  constexpr static __mmask16 all_lanes = static_cast<__mmask16>((1U << lanes) - 1);
+
+  // Returns the lanes to refill from the free ones, which is all of them unless the batch runs dry
+  HEDLEY_ALWAYS_INLINE static __mmask16 lanes_to_refill(__mmask16 free_lanes, uint32_t remaining) {
+    uint32_t refill = free_lanes;
+    while (static_cast<uint32_t>(std::popcount(refill)) > remaining) {
+      refill &= ~(1U << (31 - std::countl_zero(refill)));
+    }
+    return static_cast<__mmask16>(refill);
+  }
+
+  HEDLEY_ALWAYS_INLINE static __m512i expand_keys(__m512i vkeys, __mmask16 refill, const KeyT* keys) {
+    if constexpr (sizeof(KeyT) == 4) {
+      return _mm512_mask_expandloadu_epi32(vkeys, refill, keys);
+    } else {
+      return _mm512_mask_expandloadu_epi64(vkeys, static_cast<__mmask8>(refill), keys);
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE __m512i gather_keys(__mmask16 active, __m512i vidx) const {
+    if constexpr (sizeof(KeyT) == 4) {
+      return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), active, vidx, this->keys_.data(), 4);
+    } else {
+      return _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), static_cast<__mmask8>(active), _mm512_castsi512_si256(vidx), this->keys_.data(), 8);
+    }
+  }
+
+  HEDLEY_ALWAYS_INLINE static __mmask16 keys_equal(__mmask16 candidates, __m512i lhs, __m512i rhs) {
+    if constexpr (sizeof(KeyT) == 4) {
+      return _mm512_mask_cmpeq_epi32_mask(candidates, lhs, rhs);
+    } else {
+      return _mm512_mask_cmpeq_epi64_mask(static_cast<__mmask8>(candidates), lhs, rhs);
+    }
+  }
+
+  // The validity bit of slot i is bit i % 32 of the i / 32-th 32-bit word of the (little-endian) validity bitmap
+  HEDLEY_ALWAYS_INLINE __mmask16 gather_valid(__mmask16 active, __m512i vidx) const {
+    const __m512i words = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), active, _mm512_srli_epi32(vidx, 5), this->valid_words_.data(), 4);
+    const __m512i bits = _mm512_srlv_epi32(words, _mm512_and_si512(vidx, _mm512_set1_epi32(31)));
+    return _mm512_mask_test_epi32_mask(active, bits, _mm512_set1_epi32(1));
+  }
+
+  // A register only fits 8 64-bit values, i.e., 16 lanes are handled as two halves. f gets the shift of the half's bits in the lane masks.
+  template <typename F>
+  HEDLEY_ALWAYS_INLINE static void for_each_half(__m512i vidx, __m512i vpos, F&& f) {
+    f(0U, _mm512_castsi512_si256(vidx), _mm512_castsi512_si256(vpos));
+    if constexpr (lanes == 16) {
+      f(8U, _mm512_extracti64x4_epi64(vidx, 1), _mm512_extracti64x4_epi64(vpos, 1));
+    }
+  }
+
+  void lookup_vertical(const KeyT* keys, uint32_t count, BatchResultT* results) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i lane_ids = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i num_slots = _mm512_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(this->max_elements_)));
+    // As in the scalar find, a sequence ends after as many slots as there are elements
+    const __m512i last_probe = _mm512_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(this->size_)));
+
+    __m512i vkeys = zero;
+    __m512i vidx = zero;
+    __m512i vpos = zero;
+    __m512i vprobes = zero;
+    __mmask16 active = 0;
+    uint32_t cursor = 0;
+
+    while (true) {
+      const auto free_lanes = static_cast<__mmask16>(all_lanes & ~active);
+      if (free_lanes != 0 && cursor < count) {
+        const __mmask16 refill = lanes_to_refill(free_lanes, count - cursor);
+        vkeys = expand_keys(vkeys, refill, keys + cursor);
+        vidx = _mm512_mask_expandloadu_epi32(vidx, refill, homes_.data() + cursor);
+        vpos = _mm512_mask_expand_epi32(vpos, refill, _mm512_add_epi32(lane_ids, _mm512_set1_epi32(static_cast<int32_t>(cursor))));
+        vprobes = _mm512_mask_mov_epi32(vprobes, refill, zero);
+        cursor += static_cast<uint32_t>(std::popcount(static_cast<uint32_t>(refill)));
+        active = static_cast<__mmask16>(active | refill);
+      }
+
+      if (active == 0) {
+        return;
+      }
+
+      const __mmask16 valid = gather_valid(active, vidx);
+      const __mmask16 hits = keys_equal(valid, gather_keys(active, vidx), vkeys);
+      const auto empty = static_cast<__mmask16>(active & ~valid);
+      const __mmask16 exhausted = _mm512_mask_cmpeq_epi32_mask(static_cast<__mmask16>(valid & ~hits), vprobes, last_probe);
+      const auto done = static_cast<__mmask16>(hits | empty | exhausted);
+
+      if (done != 0) {
+        if constexpr (stores_values) {
+          // Misses gather nothing and hence write zero, i.e., ValueT{} or nullptr
+          auto* out = reinterpret_cast<long long*>(results);
+          for_each_half(vidx, vpos, [&](uint32_t shift, __m256i idx_half, __m256i pos_half) {
+            const auto hits_half = static_cast<__mmask8>(hits >> shift);
+            const __m512i values = _mm512_mask_i32gather_epi64(zero, hits_half, idx_half, this->values_.data(), 8);
+            _mm512_mask_i32scatter_epi64(out, static_cast<__mmask8>(done >> shift), pos_half, values, 8);
+          });
+        } else {
+          alignas(64) uint32_t positions[16];
+          _mm512_store_si512(positions, vpos);
+          for (uint32_t lanes_left = done; lanes_left != 0; lanes_left &= lanes_left - 1) {
+            const auto lane = static_cast<uint32_t>(std::countr_zero(lanes_left));
+            results[positions[lane]] = ((hits >> lane) & 1U) != 0;
+          }
+        }
+        active = static_cast<__mmask16>(active & ~done);
+      }
+
+      vidx = _mm512_mask_add_epi32(vidx, active, vidx, one);
+      vidx = _mm512_mask_mov_epi32(vidx, _mm512_mask_cmpeq_epi32_mask(active, vidx, num_slots), zero);
+      vprobes = _mm512_mask_add_epi32(vprobes, active, vprobes, one);
+    }
+  }
+
+  void insert_vertical(const KeyT* keys, const ValueT* values, uint32_t count) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i lane_ids = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i num_slots = _mm512_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(this->max_elements_)));
+    // Slots are below 2^31, hence lanes that do not write get distinct slots with the sign bit set, which never conflict
+    const __m512i no_slot = _mm512_or_si512(lane_ids, _mm512_set1_epi32(std::numeric_limits<int32_t>::min()));
+
+    __m512i vkeys = zero;
+    __m512i vidx = zero;
+    __m512i vpos = zero;
+    __mmask16 active = 0;
+    uint32_t cursor = 0;
+
+    while (true) {
+      const auto free_lanes = static_cast<__mmask16>(all_lanes & ~active);
+      if (free_lanes != 0 && cursor < count) {
+        const __mmask16 refill = lanes_to_refill(free_lanes, count - cursor);
+        vkeys = expand_keys(vkeys, refill, keys + cursor);
+        vidx = _mm512_mask_expandloadu_epi32(vidx, refill, homes_.data() + cursor);
+        vpos = _mm512_mask_expand_epi32(vpos, refill, _mm512_add_epi32(lane_ids, _mm512_set1_epi32(static_cast<int32_t>(cursor))));
+        cursor += static_cast<uint32_t>(std::popcount(static_cast<uint32_t>(refill)));
+        active = static_cast<__mmask16>(active | refill);
+      }
+
+      if (active == 0) {
+        return;
+      }
+
+      const __mmask16 valid = gather_valid(active, vidx);
+      const __mmask16 hits = keys_equal(valid, gather_keys(active, vidx), vkeys);
+      const auto empty = static_cast<__mmask16>(active & ~valid);
+      const auto writers = static_cast<__mmask16>(hits | empty);
+
+      if (writers != 0) {
+        // Bit j of lane i's conflict vector is set if lane j < i writes the same slot
+        const __m512i conflicts = _mm512_conflict_epi32(_mm512_mask_mov_epi32(no_slot, writers, vidx));
+        const __mmask16 conflicting = _mm512_mask_test_epi32_mask(writers, conflicts, conflicts);
+        const auto winners = static_cast<__mmask16>(writers & ~(HEDLEY_UNLIKELY(conflicting != 0) ? later_writers(conflicting, conflicts, vpos) : 0));
+        const auto claims = static_cast<__mmask16>(winners & empty);
+
+        if constexpr (sizeof(KeyT) == 4) {
+          _mm512_mask_i32scatter_epi32(this->keys_.data(), claims, vidx, vkeys, 4);
+        } else {
+          _mm512_mask_i32scatter_epi64(this->keys_.data(), static_cast<__mmask8>(claims), _mm512_castsi512_si256(vidx), vkeys, 8);
+        }
+
+        if constexpr (stores_values) {
+          auto* values_in = reinterpret_cast<const long long*>(values);
+          for_each_half(vidx, vpos, [&](uint32_t shift, __m256i idx_half, __m256i pos_half) {
+            const auto winners_half = static_cast<__mmask8>(winners >> shift);
+            const __m512i new_values = _mm512_mask_i32gather_epi64(zero, winners_half, pos_half, values_in, 8);
+            _mm512_mask_i32scatter_epi64(this->values_.data(), winners_half, idx_half, new_values, 8);
+          });
+        }
+
+        // Several claimed slots may share a validity word, hence the bits are set one by one
+        if (claims != 0) {
+          alignas(64) uint32_t slots[16];
+          _mm512_store_si512(slots, vidx);
+          for (uint32_t lanes_left = claims; lanes_left != 0; lanes_left &= lanes_left - 1) {
+            this->set_valid(slots[std::countr_zero(lanes_left)]);
+          }
+          this->size_ += static_cast<uint64_t>(std::popcount(static_cast<uint32_t>(claims)));
+        }
+
+        active = static_cast<__mmask16>(active & ~winners);
+      }
+
+      // Lanes that lost a conflict stay on their slot, which now holds the winner's key
+      const auto advancing = static_cast<__mmask16>(active & ~writers);
+      vidx = _mm512_mask_add_epi32(vidx, advancing, vidx, one);
+      vidx = _mm512_mask_mov_epi32(vidx, _mm512_mask_cmpeq_epi32_mask(advancing, vidx, num_slots), zero);
+    }
+  }
+
+  // Of all lanes writing the same slot, returns all but the one holding the earliest key of the batch. Keys in later positions may sit in
+  // lower lanes after refills, hence we compare the positions instead of taking the lowest lane.
+  HEDLEY_NEVER_INLINE static __mmask16 later_writers(__mmask16 conflicting, __m512i conflicts, __m512i vpos) {
+    alignas(64) uint32_t conflict_lanes[16];
+    alignas(64) uint32_t positions[16];
+    _mm512_store_si512(conflict_lanes, conflicts);
+    _mm512_store_si512(positions, vpos);
+
+    uint32_t losers = 0;
+    for (uint32_t lanes_left = conflicting; lanes_left != 0; lanes_left &= lanes_left - 1) {
+      const auto lane = static_cast<uint32_t>(std::countr_zero(lanes_left));
+      for (uint32_t others = conflict_lanes[lane]; others != 0; others &= others - 1) {
+        const auto other = static_cast<uint32_t>(std::countr_zero(others));
+        losers |= positions[other] < positions[lane] ? (1U << lane) : (1U << other);
+      }
+    }
+    return static_cast<__mmask16>(losers);
+  }
+
+#pragma GCC diagnostic pop
+#endif
+
+  std::vector<uint32_t> homes_;
+};
+
+// Key-only set, i.e., batch lookups report whether each key exists
+template <typename KeyT, typename HasherT, bool use_thp = false, uint64_t batch_size_ = 65536>
+class VerticalLinearProbingSoAHashSet : public VerticalLinearProbingSoAHashTable<KeyT, NoValue, HasherT, use_thp, batch_size_> {
+ public:
+  VerticalLinearProbingSoAHashSet(uint64_t max_elements, uint8_t target_load_factor, bool print_info = true)
+      : VerticalLinearProbingSoAHashTable<KeyT, NoValue, HasherT, use_thp, batch_size_>(max_elements, target_load_factor, print_info) {}
+};
+
+}  // namespace hashmap::hashmaps
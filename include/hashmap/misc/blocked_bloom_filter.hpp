@@ -0,0 +1,108 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+
+#ifdef HASHMAP_IS_X86
+#include <x86intrin.h>
+#endif
+
+namespace hashmap {
+
+// Register-blocked ("split block") Bloom filter as used by Impala and Parquet, cf. Putze et al., Cache-, Hash- and Space-Efficient Bloom Filters.
+// A key selects a single 256-bit block via the upper half of its hash and sets one bit in each of the block's eight 32-bit words,
+// where the bit positions are derived from the lower half of the hash. Checking a key hence is one load plus one test (on AVX2),
+// and every operation touches exactly one cache line.
+template <bool use_thp = false>
+class BlockedBloomFilter {
+ public:
+  static constexpr uint64_t words_per_block = 8;
+
+  struct alignas(32) BlockT {
+    uint32_t words[words_per_block];
+  };
+
+  static constexpr uint64_t blocks_per_cacheline = std::max(static_cast<uint64_t>(1), utils::cacheline_size / sizeof(BlockT));
+
+  explicit BlockedBloomFilter(uint64_t num_cachelines) : blocks_(num_cachelines * blocks_per_cacheline), block_mask_{blocks_.size() - 1} {
+    ASSERT(utils::is_power_of_two(num_cachelines), "The number of cache lines of the Bloom filter needs to be a power of two!");
+    clear();
+  }
+
+  // Number of cache lines to reach (at least) bits_per_key filter bits for max_elements keys
+  static uint64_t cachelines_for(uint64_t max_elements, uint64_t bits_per_key) {
+    const uint64_t bits_per_cacheline = utils::cacheline_size * 8;
+    const uint64_t num_cachelines = std::max(static_cast<uint64_t>(1), (max_elements * bits_per_key + bits_per_cacheline - 1) / bits_per_cacheline);
+    return utils::value_or_np2(num_cachelines);
+  }
+
+  HEDLEY_ALWAYS_INLINE void insert(uint64_t hash) {
+    BlockT& block = blocks_[block_index(hash)];
+#if defined(HASHMAP_IS_X86) && defined(__AVX2__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+    __m256i* block_ptr = reinterpret_cast<__m256i*>(&block);
+    _mm256_store_si256(block_ptr, _mm256_or_si256(_mm256_load_si256(block_ptr), make_mask(static_cast<uint32_t>(hash))));
+#else
+    const BlockT mask = make_mask(static_cast<uint32_t>(hash));
+    for (uint64_t i = 0; i < words_per_block; ++i) {
+      block.words[i] |= mask.words[i];
+    }
+#endif
+  }
+
+  HEDLEY_ALWAYS_INLINE bool may_contain(uint64_t hash) const {
+    const BlockT& block = blocks_[block_index(hash)];
+#if defined(HASHMAP_IS_X86) && defined(__AVX2__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+    // testc checks (~block & mask) == 0, i.e., whether all bits of the mask are set in the block
+    return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(&block)), make_mask(static_cast<uint32_t>(hash))) != 0;
+#else
+    const BlockT mask = make_mask(static_cast<uint32_t>(hash));
+    bool contained = true;
+    for (uint64_t i = 0; i < words_per_block; ++i) {
+      contained &= (block.words[i] & mask.words[i]) == mask.words[i];
+    }
+    return contained;
+#endif
+  }
+
+  void clear() { std::fill(blocks_.begin(), blocks_.end(), BlockT{}); }
+
+  uint64_t num_cachelines() const { return blocks_.size() / blocks_per_cacheline; }
+  uint64_t size_in_bytes() const { return blocks_.size() * sizeof(BlockT); }
+
+ protected:
+  using BlockAllocator =
+      std::conditional_t<use_thp, utils::TransparentHugePageAllocator<BlockT>, utils::AlignedAllocator<BlockT, utils::cacheline_size>>;
+
+  // Odd constants from the Parquet split block Bloom filter specification, one per word
+  static constexpr uint32_t salts[words_per_block] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                      0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+  HEDLEY_ALWAYS_INLINE uint64_t block_index(uint64_t hash) const { return (hash >> 32U) & block_mask_; }
+
+#if defined(HASHMAP_IS_X86) && defined(__AVX2__) && !defined(HASHMAP_USE_SCALAR_IMPL)
+  HEDLEY_ALWAYS_INLINE static __m256i make_mask(uint32_t hash) {
+    const __m256i salt = _mm256_setr_epi32(static_cast<int32_t>(salts[0]), static_cast<int32_t>(salts[1]), static_cast<int32_t>(salts[2]),
+                                           static_cast<int32_t>(salts[3]), static_cast<int32_t>(salts[4]), static_cast<int32_t>(salts[5]),
+                                           static_cast<int32_t>(salts[6]), static_cast<int32_t>(salts[7]));
+    const __m256i bit_positions = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int32_t>(hash)), salt), 27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), bit_positions);
+  }
+#else
+  HEDLEY_ALWAYS_INLINE static BlockT make_mask(uint32_t hash) {
+    BlockT mask;
+    for (uint64_t i = 0; i < words_per_block; ++i) {
+      mask.words[i] = 1U << ((hash * salts[i]) >> 27U);
+    }
+    return mask;
+  }
+#endif
+
+  std::vector<BlockT, BlockAllocator> blocks_;
+  uint64_t block_mask_;
+};
+
+}  // namespace hashmap
@@ -0,0 +1,84 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+#include "fmt/format.h"
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+
+// Fixed-width key of num_columns 64-bit columns, e.g., (u64, u64) join keys, 16-byte UUIDs (Key128), or three-column keys.
+// A single integer converts to a composite key with that integer as first column and all other columns zero. Like integer keys, default
+// constructed keys are uninitialized. As StringKey, the key is packed such that it can be embedded into the packed entries.
+template <uint8_t num_columns>
+struct CompositeKey {
+  static_assert(num_columns >= 2 && num_columns <= hashmap::utils::column_multiply_constants_64b.size(),
+                "Composite keys have between 2 and 4 columns.");
+
+  constexpr static uint8_t column_count = num_columns;
+
+  CompositeKey() = default;
+  CompositeKey(uint64_t first_column) : columns{first_column} {}
+  explicit CompositeKey(const std::array<uint64_t, num_columns>& all_columns) {
+    for (uint8_t column = 0; column < num_columns; ++column) {
+      columns[column] = all_columns[column];
+    }
+  }
+
+  uint64_t columns[num_columns];
+
+  // The first 16 bytes are compared with a single 128-bit SIMD comparison, the remaining columns (if any) are compared as scalars
+  HEDLEY_ALWAYS_INLINE friend bool operator==(const CompositeKey& lhs, const CompositeKey& rhs) {
+#if defined(HASHMAP_IS_X86) && !defined(HASHMAP_USE_SCALAR_IMPL)
+    const __m128i lhs_vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&lhs));
+    const __m128i rhs_vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs));
+    bool equal = _mm_movemask_epi8(_mm_cmpeq_epi8(lhs_vector, rhs_vector)) == 0xFFFF;
+#elif defined(HASHMAP_IS_ARM) && !defined(HASHMAP_USE_SCALAR_IMPL)
+    const uint64x2_t cmp = vceqq_u64(vld1q_u64(reinterpret_cast<const uint64_t*>(&lhs)), vld1q_u64(reinterpret_cast<const uint64_t*>(&rhs)));
+    bool equal = (vgetq_lane_u64(cmp, 0) & vgetq_lane_u64(cmp, 1)) != 0;
+#else
+    bool equal = lhs.columns[0] == rhs.columns[0] && lhs.columns[1] == rhs.columns[1];
+#endif
+
+    for (uint8_t column = 2; column < num_columns; ++column) {
+      equal &= lhs.columns[column] == rhs.columns[column];
+    }
+    return equal;
+  }
+
+  friend bool operator<(const CompositeKey& lhs, const CompositeKey& rhs) {
+    for (uint8_t column = 0; column < num_columns; ++column) {
+      if (lhs.columns[column] != rhs.columns[column]) {
+        return lhs.columns[column] < rhs.columns[column];
+      }
+    }
+    return false;
+  }
+} __attribute__((packed));
+
+using Key128 = CompositeKey<2>;
+
+template <uint8_t num_columns>
+struct std::hash<CompositeKey<num_columns>> {
+  std::size_t operator()(const CompositeKey<num_columns>& key) const noexcept {
+    std::size_t seed = 0;
+    for (uint8_t column = 0; column < num_columns; ++column) {
+      seed ^= std::hash<uint64_t>()(key.columns[column]) + 0x9e3779b97f4a7c15 + (seed << 6U) + (seed >> 2U);
+    }
+    return seed;
+  }
+};
+
+template <uint8_t num_columns>
+struct fmt::formatter<CompositeKey<num_columns>> : fmt::formatter<std::string_view> {
+  template <typename FormatContext>
+  auto format(const CompositeKey<num_columns>& key, FormatContext& ctx) const {
+    auto out = fmt::format_to(ctx.out(), "({}", static_cast<uint64_t>(key.columns[0]));
+    for (uint8_t column = 1; column < num_columns; ++column) {
+      out = fmt::format_to(out, ", {}", static_cast<uint64_t>(key.columns[column]));
+    }
+    return fmt::format_to(out, ")");
+  }
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "hashmap/utils.hpp"
+#include "hedley.h"
+
+namespace hashmap {
+
+// Chunked arena for (large) values that are referenced by compact (by default 32-bit) slot ids instead of being stored inline in a hash table.
+// Values are appended to fixed-size chunks, hence references stay valid while the arena grows and chunks are never moved or copied.
+// reset() makes all chunks reusable in O(1) without returning the memory to the OS, release() frees all chunks at once.
+// The arena holds at most max_values values, i.e., users that do not store slot ids can choose a 64-bit SlotIdT to lift that limit.
+template <typename ValueT, bool use_thp = true, uint64_t chunk_size_bytes = utils::hugepage_size, typename SlotIdT = uint32_t>
+class ValueArena {
+ public:
+  using SlotT = SlotIdT;
+
+  static_assert(std::is_unsigned_v<SlotT>, "Slot ids need to be unsigned integers!");
+
+  static_assert(chunk_size_bytes >= sizeof(ValueT), "A chunk needs to hold at least one value!");
+  static constexpr uint64_t values_per_chunk = std::bit_floor(chunk_size_bytes / sizeof(ValueT));
+  static constexpr uint64_t chunk_shift = std::countr_zero(values_per_chunk);
+  static constexpr uint64_t chunk_mask = values_per_chunk - 1;
+  static constexpr uint64_t max_values = static_cast<uint64_t>(std::numeric_limits<SlotT>::max());
+
+  SlotT allocate(const ValueT& value) {
+    DEBUG_ASSERT(size_ < max_values, "ValueArena is full!");
+    if (HEDLEY_UNLIKELY((size_ >> chunk_shift) == chunks_.size())) {
+      add_chunk();
+    }
+
+    const auto slot = static_cast<SlotT>(size_++);
+    (*this)[slot] = value;
+    return slot;
+  }
+
+  HEDLEY_ALWAYS_INLINE ValueT& operator[](SlotT slot) { return chunks_[slot >> chunk_shift][slot & chunk_mask]; }
+  HEDLEY_ALWAYS_INLINE const ValueT& operator[](SlotT slot) const { return chunks_[slot >> chunk_shift][slot & chunk_mask]; }
+
+  // Allocates (and touches) enough chunks to hold num_values values without allocating during inserts.
+  void reserve(uint64_t num_values) {
+    ASSERT(num_values <= max_values, "Cannot reserve more values than addressable by a slot id!");
+    while (chunks_.size() * values_per_chunk < num_values) {
+      add_chunk();
+    }
+  }
+
+  void reset() { size_ = 0; }
+
+  void release() {
+    chunks_.clear();
+    chunks_.shrink_to_fit();
+    size_ = 0;
+  }
+
+  uint64_t size() const { return size_; }
+  uint64_t num_chunks() const { return chunks_.size(); }
+  uint64_t allocated_bytes() const { return chunks_.size() * values_per_chunk * sizeof(ValueT); }
+
+  const ValueT* data() const { return chunks_.empty() ? nullptr : chunks_.front().data(); }
+
+ protected:
+  using ChunkAllocator = std::conditional_t<use_thp, utils::TransparentHugePageAllocator<ValueT>, std::allocator<ValueT>>;
+  using ChunkT = std::vector<ValueT, ChunkAllocator>;
+
+  void add_chunk() { chunks_.emplace_back(values_per_chunk); }
+
+  std::vector<ChunkT> chunks_;
+  uint64_t size_ = 0;
+};
+
+}  // namespace hashmap
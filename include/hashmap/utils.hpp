@@ -2,6 +2,7 @@
 
 #include <sys/mman.h>  // madvise
 
+#include <array>
 #include <bit>
 #include <cstdlib>  // posix_memalign
 #include <exception>
@@ -56,6 +57,9 @@ __extension__ typedef unsigned __int128 uint128_t;
 
 struct StringKey;
 
+template <uint8_t num_columns>
+struct CompositeKey;
+
 namespace {
 template <typename, template <typename...> typename>
 struct is_instance_impl : public std::false_type {};
@@ -71,6 +75,10 @@ namespace benchmark {
 struct DummyTuple;
 }  // namespace benchmark
 
+namespace hashmap::hashmaps {
+struct NoValue;
+}  // namespace hashmap::hashmaps
+
 namespace hashmap::utils {
 
 #ifdef HASHMAP_COLLECT_META_INFO
@@ -83,6 +91,9 @@ struct MeasurementInfo {
   uint64_t num_collision = 0;           // number of hash collisions (hash equals, key doesnt)
   uint64_t num_overflows_followed = 0;  // how often we followed an overflow
   uint64_t num_overflows = 0;           // how many buckets have overflowed (constant for a given load)
+  uint64_t num_overflow_hits = 0;       // how often we found the key outside of its home bucket (e.g., in the stash)
+  uint64_t num_filter_checks = 0;       // how often a Bloom filter in front of the table was checked
+  uint64_t num_filter_rejections = 0;   // how often the Bloom filter answered a lookup without probing the table
   uint64_t num_buckets = 0;             // how many buckets do we have overall
   uint64_t min_probing_sequence =
       std::numeric_limits<uint64_t>::max();  // min number of keys/key vectors/fingerprint vectors/buckets we had to touch in this setting
@@ -97,6 +108,9 @@ struct MeasurementInfo {
     num_collision = 0;
     num_overflows_followed = 0;
     num_overflows = 0;
+    num_overflow_hits = 0;
+    num_filter_checks = 0;
+    num_filter_rejections = 0;
   }
 };
 #endif
@@ -171,6 +185,20 @@ constexpr static uint64_t add_constant_64b = 0x736f6d6570736575;
 constexpr static uint64_t murmur_constant1 = 0xff51afd7ed558ccd;
 constexpr static uint64_t murmur_constant2 = 0xc4ceb9fe1a85ec53;
 
+// Odd multipliers for vector multiply-shift hashing of composite keys. The first one is multiply_constant_64b, such that a composite key with
+// only its first column set hashes like the corresponding integer.
+constexpr static std::array<uint64_t, 4> column_multiply_constants_64b = {multiply_constant_64b, 0x9e3779b97f4a7c15, murmur_constant1,
+                                                                          murmur_constant2};
+
+template <typename T>
+struct is_composite_key : std::false_type {};
+
+template <uint8_t num_columns>
+struct is_composite_key<CompositeKey<num_columns>> : std::true_type {};
+
+template <typename T>
+constexpr static bool is_composite_key_v = is_composite_key<T>::value;
+
 enum class PrefetchingLocality { HIGH = 3, MEDIUM = 2, LOW = 1, NO = 0 };
 
 #ifdef __GNUC__
@@ -382,6 +410,10 @@ std::string data_type_to_str() {
     return "stringkey";
   }
 
+  if constexpr (is_composite_key_v<Type>) {
+    return "compositekey" + std::to_string(sizeof(Type) * 8);
+  }
+
   if constexpr (std::is_same_v<Type, benchmark::DummyTuple*>) {
     return "ptr_DummyTuple";
   }
@@ -390,6 +422,10 @@ std::string data_type_to_str() {
     return "DummyTuple";
   }
 
+  if constexpr (std::is_same_v<Type, hashmaps::NoValue>) {
+    return "NoValue";
+  }
+
 #ifdef HASHMAP_IS_X86
 #pragma GCC diagnostic push
 // The implications of this are discussed below, as here it is not important (because the checks works despite losing attributess)
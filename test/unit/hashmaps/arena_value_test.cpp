@@ -0,0 +1,169 @@
+#include "hashmap/hashmaps/arena_value.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/bucketing_simd.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/linear_probing_aos.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/misc/value_arena.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralArenaValueHashTableTest : public ::testing::Test {};
+
+template <class T>
+class StringArenaValueHashTableTest : public ::testing::Test {};
+
+class SpecificArenaValueHashTableTest : public ::testing::Test {};
+
+struct LargeTestValue {
+  uint64_t value1 = 0;
+  uint64_t value2 = 0;
+  uint64_t value3 = 0;
+  uint64_t value4 = 0;
+  uint64_t value5 = 0;
+  uint64_t value6 = 0;
+  uint64_t value7 = 0;
+  uint64_t value8 = 0;
+};
+
+typedef Types<ArenaValueHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>>>,
+              ArenaValueHashTable<uint32_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint32_t, uint32_t, StdHasher<uint32_t, false>>>,
+              ArenaValueHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>>, false>,
+              ArenaValueHashTable<uint64_t, uint64_t,
+                                  ChainedHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>>,
+              ArenaValueHashTable<uint64_t, uint64_t,
+                                  BucketingSIMDHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                                         SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralArenaValueHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralArenaValueHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralArenaValueHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralArenaValueHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralArenaValueHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralArenaValueHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralArenaValueHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralArenaValueHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+TEST_F(SpecificArenaValueHashTableTest, TestArenaChunks) {
+  // Tiny chunks to cross many chunk boundaries
+  ValueArena<LargeTestValue, false, 4 * sizeof(LargeTestValue)> arena;
+  EXPECT_EQ(arena.values_per_chunk, 4);
+
+  std::vector<const LargeTestValue*> references;
+  for (uint64_t i = 0; i < 100; ++i) {
+    const uint32_t slot = arena.allocate({i, i + 1, i + 2, i + 3, i + 4, i + 5, i + 6, i + 7});
+    EXPECT_EQ(slot, i);
+    references.push_back(&arena[slot]);
+  }
+  EXPECT_EQ(arena.size(), 100);
+  EXPECT_EQ(arena.num_chunks(), 25);
+
+  // Growing the arena does not move values
+  for (uint64_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(references[i], &arena[static_cast<uint32_t>(i)]);
+    ASSERT_EQ(references[i]->value1, i);
+    ASSERT_EQ(references[i]->value8, i + 7);
+  }
+
+  // reset keeps the chunks, release frees them
+  arena.reset();
+  EXPECT_EQ(arena.size(), 0);
+  EXPECT_EQ(arena.num_chunks(), 25);
+  EXPECT_EQ(arena.allocate({}), 0);
+
+  arena.release();
+  EXPECT_EQ(arena.size(), 0);
+  EXPECT_EQ(arena.num_chunks(), 0);
+  EXPECT_EQ(arena.allocated_bytes(), 0);
+}
+
+TEST_F(SpecificArenaValueHashTableTest, TestLargeValuesByReference) {
+  constexpr uint64_t num_keys = 50000;
+  ArenaValueHashTable<uint64_t, LargeTestValue, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>>> hashmap(
+      65536, 100, false);
+
+  // The underlying table only stores 32-bit slot ids next to the keys
+  EXPECT_EQ(hashmap.get_entry_size(), 16 + sizeof(LargeTestValue));
+
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    hashmap.insert(key, {key, 0, 0, 0, 0, 0, 0, key * 2});
+  }
+  EXPECT_EQ(hashmap.get_current_size(), num_keys);
+  EXPECT_EQ(hashmap.get_arena().size(), num_keys);
+  EXPECT_EQ(hashmap.lookup_ref(num_keys), nullptr);
+
+  const LargeTestValue* value = hashmap.lookup_ref(42);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(value->value1, 42);
+  EXPECT_EQ(value->value8, 84);
+
+  // Updates are done in place in the arena, i.e., do not allocate a new slot
+  hashmap.insert(42, {1337, 0, 0, 0, 0, 0, 0, 1337});
+  EXPECT_EQ(hashmap.get_arena().size(), num_keys);
+  EXPECT_EQ(hashmap.lookup_ref(42), value);
+  EXPECT_EQ(value->value1, 1337);
+
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    if (key != 42) {
+      ASSERT_EQ(hashmap.lookup(key).value8, key * 2);
+    }
+  }
+
+  const uint64_t allocated_bytes = hashmap.get_arena().allocated_bytes();
+  hashmap.reset();
+  EXPECT_EQ(hashmap.get_current_size(), 0);
+  EXPECT_EQ(hashmap.get_arena().size(), 0);
+  EXPECT_EQ(hashmap.get_arena().allocated_bytes(), allocated_bytes);
+  EXPECT_FALSE(hashmap.contains(1));
+
+  hashmap.insert(1, {7, 0, 0, 0, 0, 0, 0, 7});
+  EXPECT_EQ(hashmap.lookup(1).value1, 7);
+
+  hashmap.release();
+  EXPECT_EQ(hashmap.get_arena().allocated_bytes(), 0);
+  EXPECT_FALSE(hashmap.contains(1));
+}
+
+TEST_F(SpecificArenaValueHashTableTest, TestPrefault) {
+  ArenaValueHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>>> hashmap(1024, 100,
+                                                                                                                                    false);
+  std::vector<std::pair<uint64_t, uint64_t>> prefault_data = {{1, 1}, {2, 2}, {3, 3}};
+  hashmap.prefault_pregenerated(prefault_data);
+
+  EXPECT_EQ(hashmap.get_current_size(), 0);
+  EXPECT_EQ(hashmap.get_arena().size(), 0);
+  EXPECT_GE(hashmap.get_arena().allocated_bytes(), 1024 * sizeof(uint64_t));
+  EXPECT_FALSE(hashmap.contains(1));
+
+  hashmap.insert(1, 42);
+  EXPECT_EQ(hashmap.lookup(1), 42);
+}
+
+typedef Types<ArenaValueHashTable<StringKey, uint64_t, AutoPaddedLinearProbingAoSHashTable<StringKey, uint32_t, XXHasher<StringKey, false>>>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringArenaValueHashTableTest, StringHashTableTypes);
+
+TYPED_TEST(StringArenaValueHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringArenaValueHashTableTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringArenaValueHashTableTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringArenaValueHashTableTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringArenaValueHashTableTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringArenaValueHashTableTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
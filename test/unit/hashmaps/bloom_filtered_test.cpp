@@ -0,0 +1,125 @@
+#include "hashmap/hashmaps/bloom_filtered.hpp"
+
+#include <cstdint>
+
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/bucketing_simd.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/linear_probing_aos.hpp"
+#include "hashmap/misc/blocked_bloom_filter.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralBloomFilteredHashTableTest : public ::testing::Test {};
+
+template <class T>
+class StringBloomFilteredHashTableTest : public ::testing::Test {};
+
+class SpecificBloomFilteredHashTableTest : public ::testing::Test {};
+
+using FilteredLinearProbingTable =
+    BloomFilteredHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>>,
+                           StdHasher<uint64_t, false>>;
+
+typedef Types<FilteredLinearProbingTable,
+              BloomFilteredHashTable<uint32_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>>,
+                                     StdHasher<uint32_t, false>>,
+              BloomFilteredHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, false>>,
+                                     MurmurHasher<uint64_t, false>, 16, 0, true>,
+              BloomFilteredHashTable<uint64_t, uint64_t,
+                                     ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>,
+                                     StdHasher<uint64_t, false>, 4, 100>,
+              BloomFilteredHashTable<uint64_t, uint64_t,
+                                     BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8,
+                                                            128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+                                     StdHasher<uint64_t, false>>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralBloomFilteredHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBloomFilteredHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+TEST_F(SpecificBloomFilteredHashTableTest, TestFilterFalsePositiveRate) {
+  constexpr uint64_t num_keys = 100000;
+  BlockedBloomFilter<> filter(BlockedBloomFilter<>::cachelines_for(num_keys, 8));
+  EXPECT_GE(filter.size_in_bytes() * 8, num_keys * 8);
+
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    filter.insert(MurmurHasher<uint64_t, false>::static_hash(key));
+  }
+
+  uint64_t false_positives = 0;
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    ASSERT_TRUE(filter.may_contain(MurmurHasher<uint64_t, false>::static_hash(key)));
+    false_positives += filter.may_contain(MurmurHasher<uint64_t, false>::static_hash(key + num_keys)) ? 1 : 0;
+  }
+
+  // A split block Bloom filter with (at least) 8 bits per key has a false positive rate of roughly 2-3%
+  EXPECT_LT(false_positives, num_keys / 20);
+
+  filter.clear();
+  EXPECT_FALSE(filter.may_contain(MurmurHasher<uint64_t, false>::static_hash(0)));
+}
+
+TEST_F(SpecificBloomFilteredHashTableTest, TestFilterIsSkippedForHits) {
+  constexpr uint64_t num_keys = 1024;
+  FilteredLinearProbingTable hashmap(2048, 100, false);
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    hashmap.insert(key, key);
+  }
+
+  // Only hits: the filter does not reject anything, hence it should be bypassed after one sample interval
+  for (uint64_t i = 0; i < FilteredLinearProbingTable::sample_interval; ++i) {
+    ASSERT_EQ(hashmap.lookup(i % num_keys), i % num_keys);
+  }
+  EXPECT_TRUE(hashmap.is_filter_skipped());
+  EXPECT_EQ(hashmap.get_num_filter_checks(), FilteredLinearProbingTable::sample_interval);
+  EXPECT_EQ(hashmap.get_num_filter_rejections(), 0);
+
+  // Only misses: after the skip interval, the filter is measured again and used
+  for (uint64_t i = 0; i < FilteredLinearProbingTable::skip_interval + FilteredLinearProbingTable::sample_interval; ++i) {
+    ASSERT_FALSE(hashmap.contains(num_keys + i));
+  }
+  EXPECT_FALSE(hashmap.is_filter_skipped());
+  // Skipped lookups do not check the filter, and the filter has some false positives among the misses
+  EXPECT_EQ(hashmap.get_num_filter_checks(), 2 * FilteredLinearProbingTable::sample_interval);
+  EXPECT_GT(hashmap.get_num_filter_rejections(), FilteredLinearProbingTable::sample_interval * 9 / 10);
+  EXPECT_LE(hashmap.get_num_filter_rejections(), FilteredLinearProbingTable::sample_interval);
+
+  hashmap.reset();
+  EXPECT_EQ(hashmap.get_num_filter_checks(), 0);
+  EXPECT_FALSE(hashmap.is_filter_skipped());
+  EXPECT_FALSE(hashmap.contains(0));
+}
+
+typedef Types<BloomFilteredHashTable<StringKey, uint64_t, AutoPaddedLinearProbingAoSHashTable<StringKey, uint64_t, XXHasher<StringKey, false>>,
+                                     XXHasher<StringKey, false>>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringBloomFilteredHashTableTest, StringHashTableTypes);
+
+TYPED_TEST(StringBloomFilteredHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringBloomFilteredHashTableTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringBloomFilteredHashTableTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringBloomFilteredHashTableTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringBloomFilteredHashTableTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringBloomFilteredHashTableTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
@@ -0,0 +1,160 @@
+#include "hashmap/hashmaps/bucket_chained_simd.hpp"
+
+#include <array>
+#include <cstdint>
+
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/statichasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "unit/hashmaps/hashers.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralBucketChainedSIMDHashMapTest : public ::testing::Test {};
+
+template <class T>
+class StringBucketChainedSIMDHashMapTest : public ::testing::Test {};
+
+class SpecificBucketChainedSIMDHashMapTest : public ::testing::Test {};
+
+// We give all these hash maps the maximum extra budget, such that the smaller testcases with 4 elements can allocate a node
+typedef Types<BucketChainedSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>,
+              BucketChainedSIMDHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>, uint16_t, 6, 128, SIMDAlgorithm::NO_TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>,
+              BucketChainedSIMDHashTable<uint64_t, uint32_t, StdHasher<uint64_t, true>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, true, MemoryBudget::KeyValue, 255>,
+              BucketChainedSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>,
+              BucketChainedSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255, false,
+                                         hashing::FingerprintBucketBits::LSBLSB>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralBucketChainedSIMDHashMapTest, HashTableTypes);
+
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketChainedSIMDHashMapTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+using CollidingBucketChainedTable = BucketChainedSIMDHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>, uint16_t, 2, 128, SIMDAlgorithm::TESTZ,
+                                                               false, false, NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>;
+
+TEST_F(SpecificBucketChainedSIMDHashMapTest, TestBlackboxCrossBoundaryInsertion) { CrossBoundariesTestImpl<CollidingBucketChainedTable>(); }
+
+TEST_F(SpecificBucketChainedSIMDHashMapTest, TestWhiteboxCrossBoundaryInsertion) {
+  // All keys share one chain and fingerprint, two nodes with two slots each hold them, and the newer node is the head
+  CollidingBucketChainedTable hashmap(4, 100);
+  hashmap.insert(42, 0);
+  hashmap.insert(43, 1);
+  hashmap.insert(44, 2);
+  hashmap.insert(45, 3);
+
+  EXPECT_EQ(hashmap.get_num_used_nodes(), 2);
+  EXPECT_EQ(hashmap.find(42).node, hashmap.find(43).node);
+  EXPECT_EQ(hashmap.find(44).node, hashmap.find(45).node);
+  EXPECT_EQ(hashmap.find(44).node->next, hashmap.find(42).node);
+  EXPECT_EQ(hashmap.find(43).index_in_node, 1);
+  EXPECT_EQ(hashmap.find(45).index_in_node, 1);
+}
+
+TEST_F(SpecificBucketChainedSIMDHashMapTest, TestPointerUpdate) {
+  PointerUpdateTestImpl<BucketChainedSIMDHashTable<uint64_t, uint64_t*, TwoStaticHasher<uint64_t>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false,
+                                                   false, NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>>();
+}
+
+// 8-bit fingerprints fit 14 slots into a node of four cache lines, which needs larger tables than the other testcases
+TEST_F(SpecificBucketChainedSIMDHashMapTest, TestEightBitFingerprints) {
+  BucketChainedSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, uint8_t, 14, 128, SIMDAlgorithm::TESTZ, false, false,
+                             NEONAlgo::SSE2NEON, false, false, MemoryBudget::Bucket8FP>
+      hashmap(4096, 50);
+  EXPECT_EQ(sizeof(decltype(hashmap)::NodeT), 4 * utils::cacheline_size);
+
+  for (uint64_t key = 0; key < 2048; ++key) {
+    hashmap.insert(key * 13, key);
+  }
+
+  for (uint64_t key = 0; key < 2048; ++key) {
+    EXPECT_EQ(hashmap.lookup(key * 13), key);
+    EXPECT_FALSE(hashmap.contains(key * 13 + 1));
+  }
+}
+
+template <typename TableT>
+void ValidBudgetAtAllLoadFactorsTestImpl() {
+  const uint64_t max_elements = 1 << 16;
+  for (const uint8_t load_factor : std::array<uint8_t, 3>{50, 70, 90}) {
+    const uint64_t num_elements = max_elements * load_factor / 100;
+    TableT hashmap(max_elements, load_factor, false);
+    ASSERT_TRUE(hashmap.can_be_used());
+
+    for (uint64_t key = 0; key < num_elements; ++key) {
+      hashmap.insert(key * 7, key);
+    }
+    for (uint64_t key = 0; key < num_elements; ++key) {
+      EXPECT_EQ(hashmap.lookup(key * 7), key);
+    }
+    EXPECT_LE(hashmap.get_num_used_nodes() * sizeof(typename TableT::NodeT), TableT::calculate_memory_budget(max_elements));
+  }
+}
+
+TEST_F(SpecificBucketChainedSIMDHashMapTest, TestValidBudgetAtAllLoadFactors) {
+  // The configurations of benchmark set K, which get the budget of a bucketing table with 16-bit (8-bit) fingerprints
+  ValidBudgetAtAllLoadFactorsTestImpl<
+      BucketChainedSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                 NEONAlgo::SSE2NEON, false, false, MemoryBudget::Bucket16FP, 10, true>>();
+  ValidBudgetAtAllLoadFactorsTestImpl<
+      BucketChainedSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, uint8_t, 14, 128, SIMDAlgorithm::TESTZ, false, false,
+                                 NEONAlgo::SSE2NEON, false, false, MemoryBudget::Bucket8FP, 10, true>>();
+}
+
+TEST_F(SpecificBucketChainedSIMDHashMapTest, TestEqualMemoryBudget) {
+  // The directory and the nodes stay within the budget of a bucketing table with 16-bit fingerprints (plus 10%)
+  using TableT = BucketChainedSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>>;
+  const uint64_t max_elements = 1 << 16;
+  const auto [directory_size, num_nodes] = TableT::calculate_directory_buffer_size(max_elements, 50);
+
+  EXPECT_LE(directory_size * sizeof(void*) + num_nodes * sizeof(TableT::NodeT), TableT::calculate_memory_budget(max_elements));
+  EXPECT_GE(num_nodes, max_elements / 2 / 6 + std::min(directory_size, max_elements / 2));
+
+  TableT hashmap(max_elements, 50);
+  for (uint64_t key = 0; key < max_elements / 2; ++key) {
+    hashmap.insert(key, key + 1);
+  }
+  for (uint64_t key = 0; key < max_elements / 2; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), key + 1);
+  }
+  EXPECT_LE(hashmap.get_num_used_nodes(), num_nodes);
+}
+
+typedef Types<BucketChainedSIMDHashTable<StringKey, uint64_t, XXHasher<StringKey, false>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>,
+              BucketChainedSIMDHashTable<StringKey, uint64_t, StaticHasher<StringKey>, uint16_t, 6, 128, SIMDAlgorithm::TESTZ, false, false,
+                                         NEONAlgo::SSE2NEON, false, false, MemoryBudget::KeyValue, 255>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringBucketChainedSIMDHashMapTest, StringHashTableTypes);
+
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringBucketChainedSIMDHashMapTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
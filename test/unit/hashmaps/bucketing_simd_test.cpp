@@ -1,7 +1,10 @@
 #include "hashmap/hashmaps/bucketing_simd.hpp"
 
 #include <cstdint>
+#include <string>
 
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/murmurhasher.hpp"
 #include "hashmap/hashes/statichasher.hpp"
 #include "hashmap/hashes/stdhasher.hpp"
 #include "hashmap/hashes/xxhasher.hpp"
@@ -27,6 +30,9 @@ class StringBucketingSIMDHashTableHashMapTestA : public ::testing::Test {};
 
 class SpecificBucketingSIMDHashTableHashMapTestA : public ::testing::Test {};
 
+template <class T>
+class GeneralBucketingSIMDHashSetTest : public ::testing::Test {};
+
 template <class T>
 class GeneralBucketingSIMDHashTableHashMapTestB : public ::testing::Test {};
 
@@ -140,7 +146,46 @@ typedef Types<BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, fal
               BucketingSIMDHashTable<uint8_t, uint64_t, StdHasher<uint8_t, false>, uint8_t, KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,
                                      false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, true>,
               BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, true>, uint8_t, KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,
-                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, true>>
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, true>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::SECONDARY_BUCKET>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, true,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::SECONDARY_BUCKET>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint8_t, KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, true,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::STASH>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::STASH>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, SplitKeyValueStoringBucket, 8, 128,
+                                     SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>, uint8_t, SplitKeyValueStoringBucket, 16, 128,
+                                     SIMDAlgorithm::NO_TESTZ, false, false, NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, SplitKeyValueStoringBucket, 8, 128,
+                                     SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,
+                                     hashmap::utils::PrefetchingLocality::MEDIUM, false, true>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, SplitKeyValueStoringBucket, 8, 128,
+                                     SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,
+                                     hashmap::utils::PrefetchingLocality::MEDIUM, true, false, FingerprintBucketBits::MSBLSB, 0,
+                                     BucketOverflowPolicy::STASH>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::NEXT_BUCKET, uint64_t>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, true,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::STASH, uint64_t>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::NEXT_BUCKET, uint32_t, 1>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, SplitKeyValueStoringBucket, 8, 128,
+                                     SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,
+                                     hashmap::utils::PrefetchingLocality::MEDIUM, false, true, FingerprintBucketBits::MSBLSB, 0,
+                                     BucketOverflowPolicy::NEXT_BUCKET, uint32_t, 3>,
+              BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint8_t, KeyValueAoSStoringBucket, 16, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                     FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::SECONDARY_BUCKET, uint32_t, 1>>
     HashTableTypesA;
 
 TYPED_TEST_SUITE(GeneralBucketingSIMDHashTableHashMapTestA, HashTableTypesA);
@@ -152,6 +197,8 @@ TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestA, TestInsertAndLookup) { Ins
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestA, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestA, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestA, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestA, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestA, TestMerge) { MergeTestImpl<TypeParam>(); }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
@@ -196,9 +243,155 @@ TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestBucketOverflow) {
   EXPECT_EQ(hashmap.lookup(44), 1338);
 }
 
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestSecondaryBucketOverflow) {
+  BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 1, 128, SIMDAlgorithm::TESTZ, false, false,
+                         NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                         FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::SECONDARY_BUCKET>
+      hashmap(64, 0);
+
+  EXPECT_EQ(hashmap.get_num_buckets(), 64);
+  EXPECT_EQ(hashmap.get_num_stash_buckets(), 0);
+
+  hashmap.insert(42, 0);
+  hashmap.insert(43, 1);
+  hashmap.insert(44, 2);
+  EXPECT_TRUE(hashmap.get_ith_bucket(2)->is_overflowed());
+
+  uint64_t used_buckets = 0;
+  for (uint32_t i = 0; i < hashmap.get_num_buckets(); ++i) {
+    used_buckets += hashmap.get_ith_bucket(i)->get_num_entries();
+  }
+  EXPECT_EQ(used_buckets, 3);
+
+  EXPECT_EQ(hashmap.lookup(42), 0);
+  EXPECT_EQ(hashmap.lookup(43), 1);
+  EXPECT_EQ(hashmap.lookup(44), 2);
+  EXPECT_FALSE(hashmap.contains(45));
+
+  hashmap.insert(44, 1338);
+  EXPECT_EQ(hashmap.lookup(44), 1338);
+}
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestStashOverflow) {
+  BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 1, 128, SIMDAlgorithm::TESTZ, false, false,
+                         NEONAlgo::SSE2NEON, false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                         FingerprintBucketBits::MSBLSB, 0, BucketOverflowPolicy::STASH>
+      hashmap(64, 0);
+
+  EXPECT_EQ(hashmap.get_num_buckets(), 64);
+  EXPECT_EQ(hashmap.get_num_stash_buckets(), 4);
+
+  // The first overflowing key goes to the stash, the next one continues after the home bucket
+  hashmap.insert(42, 0);
+  hashmap.insert(43, 1);
+  hashmap.insert(44, 2);
+  EXPECT_TRUE(hashmap.get_ith_bucket(2)->is_overflowed());
+  EXPECT_EQ(hashmap.get_ith_bucket(2)->get_num_entries(), 1);
+  EXPECT_EQ(hashmap.get_ith_bucket(3)->get_num_entries(), 1);
+
+  uint64_t stash_entries = 0;
+  uint64_t overflowed_stash_buckets = 0;
+  for (uint32_t i = 0; i < hashmap.get_num_stash_buckets(); ++i) {
+    stash_entries += hashmap.get_ith_bucket(static_cast<uint32_t>(hashmap.get_num_buckets()) + i)->get_num_entries();
+    overflowed_stash_buckets += hashmap.get_ith_bucket(static_cast<uint32_t>(hashmap.get_num_buckets()) + i)->is_overflowed();
+  }
+  EXPECT_EQ(stash_entries, 1);
+  EXPECT_EQ(overflowed_stash_buckets, 1);
+
+  EXPECT_EQ(hashmap.lookup(42), 0);
+  EXPECT_EQ(hashmap.lookup(43), 1);
+  EXPECT_EQ(hashmap.lookup(44), 2);
+  EXPECT_FALSE(hashmap.contains(45));
+
+  hashmap.insert(43, 1338);
+  EXPECT_EQ(hashmap.lookup(43), 1338);
+}
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestSplitBucketOverflowAndReset) {
+  using HashTableT = BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, SplitKeyValueStoringBucket, 1, 128,
+                                            SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>;
+  // The bucket only contains the fill level, the overflow flag and the fingerprint vector, the table locates its keys and values
+  static_assert(sizeof(HashTableT::BucketT) == 32);
+
+  HashTableT hashmap(64, 0);
+  hashmap.insert(42, 0);
+  hashmap.insert(43, 1);
+  hashmap.insert(44, 2);
+  EXPECT_TRUE(hashmap.get_ith_bucket(2)->is_overflowed());
+  EXPECT_TRUE(hashmap.get_ith_bucket(3)->is_overflowed());
+  EXPECT_FALSE(hashmap.get_ith_bucket(4)->is_overflowed());
+  EXPECT_EQ(hashmap.get_entry(4, 0).first, 44);
+
+  EXPECT_EQ(hashmap.lookup(42), 0);
+  EXPECT_EQ(hashmap.lookup(43), 1);
+  EXPECT_EQ(hashmap.lookup(44), 2);
+  EXPECT_FALSE(hashmap.contains(45));
+
+  hashmap.reset();
+  EXPECT_FALSE(hashmap.get_ith_bucket(2)->is_overflowed());
+  EXPECT_FALSE(hashmap.contains(42));
+  hashmap.insert(43, 1338);
+  EXPECT_EQ(hashmap.get_entry(2, 0).first, 43);
+  EXPECT_EQ(hashmap.lookup(43), 1338);
+}
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestSelfOrganizingBuckets) {
+  // Every second hit outside of the first slot of the home bucket promotes the entry
+  using HashTableT = BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 4, 128,
+                                            SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,
+                                            hashmap::utils::PrefetchingLocality::MEDIUM, false, false, FingerprintBucketBits::MSBLSB, 0,
+                                            BucketOverflowPolicy::NEXT_BUCKET, uint32_t, 2>;
+  HashTableT hashmap(256, 0);
+  for (uint8_t key = 40; key < 46; ++key) {
+    hashmap.insert(key, key + 100U);
+  }
+  // Bucket 2 holds 40 to 43, 44 and 45 overflowed into bucket 3
+  EXPECT_EQ(hashmap.get_entry(2, 2).first, 42);
+  EXPECT_EQ(hashmap.get_entry(3, 0).first, 44);
+
+  // Within the home bucket, the entry moves one slot towards the front on every second hit
+  EXPECT_EQ(hashmap.lookup(42), 142);
+  EXPECT_EQ(hashmap.get_entry(2, 2).first, 42);
+  EXPECT_EQ(hashmap.lookup(42), 142);
+  EXPECT_EQ(hashmap.get_entry(2, 1).first, 42);
+  EXPECT_EQ(hashmap.get_entry(2, 2).first, 41);
+  EXPECT_TRUE(hashmap.contains(42));
+  EXPECT_TRUE(hashmap.contains(42));
+  EXPECT_EQ(hashmap.get_entry(2, 0).first, 42);
+
+  // Hits on the first slot of the home bucket neither move entries nor count towards the interval
+  EXPECT_EQ(hashmap.lookup(42), 142);
+  EXPECT_EQ(hashmap.get_entry(2, 0).first, 42);
+
+  // An overflowed entry swaps places with the last entry of its home bucket
+  EXPECT_EQ(hashmap.lookup(45), 145);
+  EXPECT_EQ(hashmap.lookup(45), 145);
+  EXPECT_EQ(hashmap.get_entry(2, 3).first, 45);
+  EXPECT_EQ(hashmap.get_entry(3, 1).first, 43);
+
+  for (uint8_t key = 40; key < 46; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), key + 100U);
+  }
+  EXPECT_FALSE(hashmap.contains(46));
+
+  hashmap.insert(43, 1338);
+  EXPECT_EQ(hashmap.lookup(43), 1338);
+  EXPECT_EQ(hashmap.get_current_size(), 6);
+}
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestParallelMerge) {
+  ParallelMergeTestImpl<BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                               SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>>();
+  // all keys hash into the same bucket, so every entry crosses the range boundaries and is merged sequentially
+  ParallelMergeTestImpl<BucketingSIMDHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                               SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>>();
+}
+
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestPointerUpdate) {
   PointerUpdateTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t*, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
                                                SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>>();
+  PointerUpdateTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t*, TwoStaticHasher<uint8_t>, uint16_t, SplitKeyValueStoringBucket, 8, 128,
+                                               SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>>();
 }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestExternalPointerUpdate) {
@@ -210,6 +403,8 @@ typedef Types<BucketingSIMDHashTable<StringKey, uint64_t, XXHasher<StringKey, fa
                                      SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
               BucketingSIMDHashTable<StringKey, uint64_t, StaticHasher<StringKey>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
                                      false, false, NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashTable<StringKey, uint64_t, XXHasher<StringKey, false>, uint16_t, SplitKeyValueStoringBucket, 8, 128,
+                                     SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
               BucketingSIMDHashTable<StringKey, uint64_t, XXHasher<StringKey, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
                                      SIMDAlgorithm::NO_TESTZ, false, false, NEONAlgo::SSE2NEON>,
               BucketingSIMDHashTable<StringKey, uint64_t, StaticHasher<StringKey>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
@@ -234,6 +429,79 @@ TYPED_TEST(StringBucketingSIMDHashTableHashMapTestA, TestUpdate) { StringUpdateT
 TYPED_TEST(StringBucketingSIMDHashTableHashMapTestA, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(StringBucketingSIMDHashTableHashMapTestA, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
 
+typedef Types<BucketingSIMDHashSet<uint64_t, StdHasher<uint64_t, false>, uint16_t, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashSet<uint32_t, StdHasher<uint32_t, false>, uint8_t, 16, 128, SIMDAlgorithm::NO_TESTZ, false, false,
+                                   NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashSet<uint64_t, StaticHasher<uint64_t>, uint16_t, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashSet<uint64_t, StdHasher<uint64_t, false>, uint16_t, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON,
+                                   false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false, FingerprintBucketBits::MSBLSB, 0,
+                                   BucketOverflowPolicy::STASH>,
+              BucketingSIMDHashSet<uint64_t, StaticHasher<uint64_t>, uint16_t, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON,
+                                   false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false, FingerprintBucketBits::MSBLSB, 0,
+                                   BucketOverflowPolicy::NEXT_BUCKET, uint32_t, 1>>
+    HashSetTypes;
+TYPED_TEST_SUITE(GeneralBucketingSIMDHashSetTest, HashSetTypes);
+
+TYPED_TEST(GeneralBucketingSIMDHashSetTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashSetTest, TestInsertAndContains) { SetInsertAndContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashSetTest, TestMerge) { SetMergeTestImpl<TypeParam>(); }
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestArbitraryCapacity) {
+  using FastRangeTableT = BucketingSIMDHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, finalizer::FASTRANGE>, uint16_t, KeyValueAoSStoringBucket,
+                                                 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,
+                                                 hashmap::utils::PrefetchingLocality::MEDIUM, false, false, FingerprintBucketBits::LSBLSB>;
+  using ModuloTableT = BucketingSIMDHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, finalizer::MODULO>, uint16_t, KeyValueAoSStoringBucket, 8,
+                                              128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>;
+  static_assert(FastRangeTableT::supports_arbitrary_capacity && ModuloTableT::supports_arbitrary_capacity);
+
+  ArbitraryCapacityTestImpl<FastRangeTableT>();
+  ArbitraryCapacityTestImpl<ModuloTableT>();
+  EXPECT_EQ(FastRangeTableT(3000, 50, false).get_num_buckets(), 375);
+  EXPECT_EQ(FastRangeTableT(3001, 50, false).get_num_buckets(), 376);
+}
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestBucketIndexWidth) {
+  using NarrowTableT = BucketingSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                              SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>;
+  using WideTableT = BucketingSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                            SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON, false, false,
+                                            hashmap::utils::PrefetchingLocality::MEDIUM, false, false, FingerprintBucketBits::MSBLSB, 0,
+                                            BucketOverflowPolicy::NEXT_BUCKET, uint64_t>;
+  // With 8 fingerprints per bucket, 32-bit indices address 2^35 slots at most, which leaves 2^36 slots to 64-bit indices
+  static_assert(NarrowTableT::max_capacity >= (1ULL << 34U) && NarrowTableT::max_capacity < (1ULL << 35U));
+  static_assert(WideTableT::max_capacity > (1ULL << 36U));
+  static_assert(sizeof(NarrowTableT::FindResult) < sizeof(WideTableT::FindResult));
+
+  WideTableT hashmap(1024, 50, false);
+  EXPECT_NE(hashmap.get_identifier().find("64BitBucketIdx"), std::string::npos);
+  EXPECT_NE(NarrowTableT(1024, 50, false).get_identifier().find("32BitBucketIdx"), std::string::npos);
+
+  // Probing state is 64 bits wide, the table behaves the same otherwise
+  for (uint64_t key = 0; key < 512; ++key) {
+    hashmap.insert(key * 31, key);
+  }
+  for (uint64_t key = 0; key < 512; ++key) {
+    EXPECT_EQ(hashmap.lookup(key * 31), key);
+    EXPECT_FALSE(hashmap.contains(key * 31 + 1));
+  }
+}
+
+TEST_F(SpecificBucketingSIMDHashTableHashMapTestA, TestKeyOnlyBucketSize) {
+  using HashSetT =
+      BucketingSIMDHashSet<uint64_t, StdHasher<uint64_t, false>, uint16_t, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>;
+  using HashTableT = BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                            SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>;
+  // Fill level and overflow flag (padded to the vector alignment) and the fingerprints take 32 bytes, followed by 8 keys (and values)
+  static_assert(sizeof(HashSetT::BucketT) == 32 + 8 * sizeof(uint64_t));
+  static_assert(sizeof(HashTableT::BucketT) == 32 + 8 * 2 * sizeof(uint64_t));
+  static_assert(KeyOnlyHashSet<HashSetT> && !KeyOnlyHashSet<HashTableT>);
+
+  HashSetT hashset(64, 0);
+  hashset.insert(42);
+  EXPECT_TRUE(hashset.contains(42));
+  EXPECT_EQ(hashset.lookup(42), NoValue{});
+}
+
 #ifdef __AVX2__
 
 typedef Types<BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 16, 256,
@@ -318,6 +586,7 @@ TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestB, TestInsertAndLookup) { Ins
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestB, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestB, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestB, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestB, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestB, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 16, 256,
@@ -592,6 +861,7 @@ TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestC, TestInsertAndLookup) { Ins
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestC, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestC, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestC, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestC, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestC, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 32, 512,
@@ -722,6 +992,7 @@ TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestD, TestInsertAndLookup) { Ins
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestD, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestD, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestD, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestD, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestD, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
@@ -820,6 +1091,7 @@ TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestE, TestInsertAndLookup) { Ins
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestE, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestE, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestE, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestE, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestE, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 32,
@@ -962,6 +1234,7 @@ TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestF, TestInsertAndLookup) { Ins
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestF, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestF, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestF, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralBucketingSIMDHashTableHashMapTestF, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
 
 TEST_F(SpecificBucketingSIMDHashTableHashMapTestF, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<BucketingSIMDHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
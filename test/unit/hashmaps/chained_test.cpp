@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "hashmap/hashes/murmurhasher.hpp"
 #include "hashmap/hashes/statichasher.hpp"
 #include "hashmap/hashes/stdhasher.hpp"
 #include "hashmap/hashes/xxhasher.hpp"
@@ -33,7 +34,10 @@ typedef Types<ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, f
               ChainedHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>,
               ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, true>, false, MemoryBudget::KeyValue, 100>,
               ChainedHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, false, MemoryBudget::KeyValue, 100>,
-              ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>>
+              ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>,
+              ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100, false, true>,
+              ChainedHashTable<uint32_t, uint64_t, StdHasher<uint32_t, true>, true, MemoryBudget::KeyValue, 100, false, true>,
+              ChainedHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, false, MemoryBudget::KeyValue, 100, false, true>>
     HashTableTypes;
 TYPED_TEST_SUITE(GeneralChainedHashMapTest, HashTableTypes);
 
@@ -44,6 +48,7 @@ TYPED_TEST(GeneralChainedHashMapTest, TestInsertAndLookup) { InsertAndLookupTest
 TYPED_TEST(GeneralChainedHashMapTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralChainedHashMapTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralChainedHashMapTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralChainedHashMapTest, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
 
 TEST_F(SpecificChainedHashMapTest, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<ChainedHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>, false, MemoryBudget::KeyValue, 100>>();
@@ -70,6 +75,96 @@ TEST_F(SpecificChainedHashMapTest, TestWhiteboxCrossBoundaryInsertion) {
   EXPECT_EQ(hashmap.find(45).previous_entry, PtrTo44);
 }
 
+// Exposes the directory to check the tags in the upper pointer bits
+class TaggedChainedHashTable
+    : public ChainedHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>, false, MemoryBudget::KeyValue, 100, false, true> {
+ public:
+  using ChainedHashTable::ChainedHashTable;
+  uintptr_t directory_entry(uint64_t directory_idx) { return reinterpret_cast<uintptr_t>(directory_[directory_idx]); }
+};
+
+TEST_F(SpecificChainedHashMapTest, TestTaggedDirectoryPrependsEntries) {
+  TaggedChainedHashTable hashmap(4, 100);
+  hashmap.insert(42, 0);
+  hashmap.insert(43, 1);
+  hashmap.insert(44, 2);
+  hashmap.insert(45, 3);
+
+  auto PtrTo43 = hashmap.find(43).entry;
+  auto PtrTo44 = hashmap.find(44).entry;
+  auto PtrTo45 = hashmap.find(45).entry;
+
+  // With tags, the last inserted entry is the head of the chain
+  EXPECT_EQ(hashmap.find(45).previous_entry, nullptr);
+  EXPECT_EQ(hashmap.find(44).previous_entry, PtrTo45);
+  EXPECT_EQ(hashmap.find(43).previous_entry, PtrTo44);
+  EXPECT_EQ(hashmap.find(42).previous_entry, PtrTo43);
+
+  for (uint64_t key = 42; key <= 45; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), key - 42);
+  }
+
+  // All keys share the TwoStaticHasher hash and thus the tag bits, but the tag must be set and the pointer must point to the head
+  const uintptr_t head = hashmap.directory_entry(2);
+  EXPECT_NE(head >> 48U, 0);
+  EXPECT_EQ(head & ((1ULL << 48U) - 1), reinterpret_cast<uintptr_t>(PtrTo45));
+  EXPECT_EQ(hashmap.directory_entry(0), 0);
+  EXPECT_EQ(hashmap.directory_entry(1), 0);
+  EXPECT_EQ(hashmap.directory_entry(3), 0);
+}
+
+TEST_F(SpecificChainedHashMapTest, TestTaggedDirectoryMisses) {
+  ChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100, false, true> hashmap(1024, 100);
+  for (uint64_t key = 0; key < 1024; ++key) {
+    hashmap.insert(key * 3, key);
+  }
+
+  for (uint64_t key = 0; key < 1024; ++key) {
+    EXPECT_EQ(hashmap.lookup(key * 3), key);
+    EXPECT_FALSE(hashmap.contains(key * 3 + 1));
+    EXPECT_FALSE(hashmap.contains(key * 3 + 2));
+  }
+}
+
+TEST_F(SpecificChainedHashMapTest, TestTaggedDirectoryCountsRejections) {
+  // The identity hasher gives constant tag bits for small keys, hence we need a mixing hasher for the tag to reject anything
+  ChainedHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100, false, true> hashmap(1024, 100);
+  for (uint64_t key = 0; key < 1024; ++key) {
+    hashmap.insert(key, key);
+  }
+
+  const uint64_t fill_checks = hashmap.get_num_filter_checks();
+  const uint64_t fill_rejections = hashmap.get_num_filter_rejections();
+  for (uint64_t key = 1024; key < 2048; ++key) {
+    EXPECT_FALSE(hashmap.contains(key));
+  }
+
+  const uint64_t checks = hashmap.get_num_filter_checks() - fill_checks;
+  const uint64_t rejections = hashmap.get_num_filter_rejections() - fill_rejections;
+  EXPECT_LE(checks, 1024);
+  EXPECT_GT(rejections, 0);
+  EXPECT_LE(rejections, checks);
+
+  hashmap.reset();
+  EXPECT_EQ(hashmap.get_num_filter_checks(), 0);
+  EXPECT_EQ(hashmap.get_num_filter_rejections(), 0);
+}
+
+TEST_F(SpecificChainedHashMapTest, TestArbitraryCapacity) {
+  using FastRangeTableT = ChainedHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, finalizer::FASTRANGE>>;
+  static_assert(FastRangeTableT::supports_arbitrary_capacity);
+  static_assert(!ChainedHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, false>>::supports_arbitrary_capacity);
+
+  ArbitraryCapacityTestImpl<FastRangeTableT>();
+  ArbitraryCapacityTestImpl<ChainedHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, finalizer::MODULO>, false, MemoryBudget::KeyValue, 100, false,
+                                             true>>();
+
+  // The directory is max_elements halved until directory and buffer fit into the budget, i.e., no power of two
+  const auto [directory_size, buffer_size] = FastRangeTableT::calculate_directory_buffer_size(3000, 50);
+  EXPECT_EQ(directory_size, 1500);
+  EXPECT_GE(buffer_size, 1500);
+}
+
 TEST_F(SpecificChainedHashMapTest, TestPointerUpdate) { PointerUpdateTestImpl<ChainedHashTable<uint64_t, uint64_t*, TwoStaticHasher<uint64_t>>>(); }
 
 TEST_F(SpecificChainedHashMapTest, TestExternalPointerUpdate) {
@@ -77,7 +172,8 @@ TEST_F(SpecificChainedHashMapTest, TestExternalPointerUpdate) {
 }
 
 typedef Types<ChainedHashTable<StringKey, uint64_t, XXHasher<StringKey, false>, false, MemoryBudget::KeyValue, 100>,
-              ChainedHashTable<StringKey, uint64_t, StaticHasher<StringKey>, false, MemoryBudget::KeyValue, 100>>
+              ChainedHashTable<StringKey, uint64_t, StaticHasher<StringKey>, false, MemoryBudget::KeyValue, 100>,
+              ChainedHashTable<StringKey, uint64_t, XXHasher<StringKey, false>, false, MemoryBudget::KeyValue, 100, false, true>>
     StringHashTableTypes;
 TYPED_TEST_SUITE(StringChainedHashMapTest, StringHashTableTypes);
 
@@ -27,6 +27,9 @@ class StringFingerprintingSIMDSOAHashMapTestA : public ::testing::Test {};
 
 class SpecificFingerprintingSIMDSOAHashMapTestA : public ::testing::Test {};
 
+template <class T>
+class GeneralFingerprintingSIMDSOAHashSetTest : public ::testing::Test {};
+
 template <class T>
 class GeneralFingerprintingSIMDSOAHashMapTestB : public ::testing::Test {};
 
@@ -170,6 +173,7 @@ TYPED_TEST(GeneralFingerprintingSIMDSOAHashMapTestA, TestInsertAndLookup) { Inse
 TYPED_TEST(GeneralFingerprintingSIMDSOAHashMapTestA, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralFingerprintingSIMDSOAHashMapTestA, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralFingerprintingSIMDSOAHashMapTestA, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralFingerprintingSIMDSOAHashMapTestA, TestMerge) { MergeTestImpl<TypeParam>(); }
 
 TEST_F(SpecificFingerprintingSIMDSOAHashMapTestA, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<FingerprintingSIMDSoAHashTable<uint8_t, uint64_t, TwoStaticHasher<uint8_t>, uint16_t, 128, SIMDAlgorithm::TESTZ, false,
@@ -229,6 +233,18 @@ TEST_F(SpecificFingerprintingSIMDSOAHashMapTestA, TestExternalPointerUpdate) {
                                                                false, false, NEONAlgo::SSE2NEON>>();
 }
 
+typedef Types<FingerprintingSIMDSoAHashSet<uint64_t, StdHasher<uint64_t, false>, uint16_t, 128, SIMDAlgorithm::TESTZ, false, false,
+                                           NEONAlgo::SSE2NEON>,
+              FingerprintingSIMDSoAHashSet<uint32_t, StdHasher<uint32_t, false>, uint8_t, 128, SIMDAlgorithm::NO_TESTZ, false, false,
+                                           NEONAlgo::SSE2NEON>,
+              FingerprintingSIMDSoAHashSet<uint64_t, StaticHasher<uint64_t>, uint16_t, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>>
+    HashSetTypes;
+TYPED_TEST_SUITE(GeneralFingerprintingSIMDSOAHashSetTest, HashSetTypes);
+
+TYPED_TEST(GeneralFingerprintingSIMDSOAHashSetTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralFingerprintingSIMDSOAHashSetTest, TestInsertAndContains) { SetInsertAndContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralFingerprintingSIMDSOAHashSetTest, TestMerge) { SetMergeTestImpl<TypeParam>(); }
+
 #ifdef __AVX2__
 
 typedef Types<
@@ -0,0 +1,150 @@
+#include "hashmap/hashmaps/growing_chained.hpp"
+
+#include <cstdint>
+
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/statichasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "unit/hashmaps/hashers.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralGrowingChainedHashMapTest : public ::testing::Test {};
+
+template <class T>
+class StringGrowingChainedHashMapTest : public ::testing::Test {};
+
+class SpecificGrowingChainedHashMapTest : public ::testing::Test {};
+
+// Small initial directories, such that the smaller testcases already split chains
+typedef Types<GrowingChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, true, 2>,
+              GrowingChainedHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>, false, false, 2>,
+              GrowingChainedHashTable<uint64_t, uint32_t, StdHasher<uint64_t, true>, true, true, 4, 50>,
+              GrowingChainedHashTable<uint64_t, uint64_t, StaticHasher<uint64_t>, false, true, 2>,
+              GrowingChainedHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, false, true, 1024, 200>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralGrowingChainedHashMapTest, HashTableTypes);
+
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralGrowingChainedHashMapTest, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
+
+TEST_F(SpecificGrowingChainedHashMapTest, TestBlackboxCrossBoundaryInsertion) {
+  CrossBoundariesTestImpl<GrowingChainedHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>, false, true, 4>>();
+}
+
+TEST_F(SpecificGrowingChainedHashMapTest, TestPointerUpdate) {
+  PointerUpdateTestImpl<GrowingChainedHashTable<uint64_t, uint64_t*, TwoStaticHasher<uint64_t>, false, true, 4>>();
+}
+
+// Far more inserts than the initial directory size and the max_elements hint, with updates in between
+template <class HashmapType>
+void GrowthTestImpl(uint64_t expected_relocations) {
+  HashmapType hashmap(16, 100);
+  constexpr uint64_t num_keys = 100000;
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    hashmap.insert(key * 7, key);
+    if (key % 1000 == 0) {
+      hashmap.insert(key * 7 / 2, key + 1);
+    }
+  }
+
+  EXPECT_GE(hashmap.get_directory_size(), num_keys);
+  EXPECT_EQ(hashmap.get_num_relocations(), expected_relocations);
+
+  // The updates hit the keys that are multiples of 500 below num_keys / 2
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    if (key % 500 == 0 && key < num_keys / 2) {
+      EXPECT_EQ(hashmap.lookup(key * 7), 2 * key + 1);
+    } else {
+      EXPECT_EQ(hashmap.lookup(key * 7), key);
+    }
+    EXPECT_FALSE(hashmap.contains(key * 7 + 1));
+  }
+
+  hashmap.reset();
+  EXPECT_EQ(hashmap.get_current_size(), 0);
+  EXPECT_EQ(hashmap.get_directory_size(), 16);
+  EXPECT_FALSE(hashmap.contains(7));
+}
+
+TEST_F(SpecificGrowingChainedHashMapTest, TestGrowthWithRelocation) {
+  // 16 slots double 12 times to 65536 slots on the way to 100000 slots, i.e., an average chain length of at most one
+  GrowthTestImpl<GrowingChainedHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, false, true, 16>>(12);
+}
+
+TEST_F(SpecificGrowingChainedHashMapTest, TestGrowthWithoutRelocation) {
+  GrowthTestImpl<GrowingChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, true>, false, false, 16>>(0);
+}
+
+// Exposes the directory to check that relocated chains are contiguous
+class RelocatingGrowingChainedHashTable : public GrowingChainedHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, true, 4, 300> {
+ public:
+  using GrowingChainedHashTable::GrowingChainedHashTable;
+
+  bool chains_are_contiguous() {
+    for (auto* head : directory_) {
+      for (auto* entry = head; entry != nullptr && entry->next != nullptr; entry = entry->next) {
+        if (entry->next != entry + 1) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+TEST_F(SpecificGrowingChainedHashMapTest, TestRelocationMakesChainsContiguous) {
+  RelocatingGrowingChainedHashTable hashmap(16, 100);
+
+  // With the identity hash, keys i and i + 4 share a chain of the initial directory. The first split happens at 4 * 3 + 1 entries, and
+  // the fourth split at 22 entries completes the doubling.
+  for (uint64_t key = 0; key < 12; ++key) {
+    hashmap.insert(key, key);
+  }
+  EXPECT_EQ(hashmap.get_directory_size(), 4);
+  EXPECT_FALSE(hashmap.chains_are_contiguous());
+
+  for (uint64_t key = 12; key < 22; ++key) {
+    hashmap.insert(key, key);
+  }
+  EXPECT_EQ(hashmap.get_directory_size(), 8);
+  EXPECT_EQ(hashmap.get_num_relocations(), 1);
+  EXPECT_TRUE(hashmap.chains_are_contiguous());
+
+  for (uint64_t key = 0; key < 22; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), key);
+  }
+}
+
+typedef Types<GrowingChainedHashTable<StringKey, uint64_t, XXHasher<StringKey, false>, false, true, 2>,
+              GrowingChainedHashTable<StringKey, uint64_t, StaticHasher<StringKey>, false, false, 2>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringGrowingChainedHashMapTest, StringHashTableTypes);
+
+TYPED_TEST(StringGrowingChainedHashMapTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringGrowingChainedHashMapTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringGrowingChainedHashMapTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringGrowingChainedHashMapTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringGrowingChainedHashMapTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringGrowingChainedHashMapTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringGrowingChainedHashMapTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
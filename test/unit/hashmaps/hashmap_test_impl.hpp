@@ -215,6 +215,40 @@ void ContainsOnFullHashMapImpl() {
   EXPECT_FALSE(hashmap.contains(47));
 }
 
+// Deduces the key type from contains, as not all tables export their template parameters
+template <class HashmapType, typename KeyT>
+KeyT key_type_of(bool (HashmapType::*)(const KeyT&));
+
+// Whatever the layout, the table has to hold at least the inserted keys and values. We stay below 256 keys for tables with 8-bit keys.
+template <class HashmapType>
+void MemoryUsageTestImpl() {
+  constexpr uint64_t num_keys = 200;
+  HashmapType hashmap(1024, 50);
+  using KeyT = decltype(key_type_of(&HashmapType::contains));
+  using ValueT = decltype(hashmap.lookup(0));
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    hashmap.insert(static_cast<KeyT>(key), static_cast<ValueT>(key));
+  }
+
+  EXPECT_GE(hashmap.memory_usage(), num_keys * (sizeof(KeyT) + sizeof(ValueT)));
+}
+
+// Tables with a modulo or fastrange hasher take capacities that are not a power of two
+template <class HashmapType>
+void ArbitraryCapacityTestImpl() {
+  constexpr uint64_t max_elements = 3000;
+  constexpr uint64_t num_keys = max_elements / 2;
+  HashmapType hashmap(max_elements, 50);
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    hashmap.insert(key * 7, key);
+  }
+
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    EXPECT_EQ(hashmap.lookup(key * 7), key);
+    EXPECT_FALSE(hashmap.contains(key * 7 + 1));
+  }
+}
+
 template <class HashmapType>
 void StringContainsOnFullHashMapImpl() {
   std::string str1 = "String1";
@@ -262,6 +296,55 @@ void StringContainsOnFullHashMapImpl() {
   std::free(reinterpret_cast<void*>(char5));
 }
 
+template <class HashmapType>
+void MergeTestImpl() {
+  HashmapType hashmap(64, 50);
+  HashmapType other(64, 50);
+
+  for (uint8_t key = 10; key < 30; ++key) {
+    hashmap.insert(key, 100);
+  }
+  for (uint8_t key = 0; key < 20; ++key) {
+    other.insert(key, key);
+  }
+
+  hashmap.merge_from(other, [](auto existing, auto incoming) { return static_cast<decltype(existing)>(existing + incoming); });
+
+  EXPECT_EQ(hashmap.get_current_size(), 30);
+  EXPECT_EQ(other.get_current_size(), 20);
+  for (uint8_t key = 0; key < 10; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), key);
+  }
+  for (uint8_t key = 10; key < 20; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), 100 + key);
+  }
+  for (uint8_t key = 20; key < 30; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), 100);
+  }
+  EXPECT_FALSE(hashmap.contains(30));
+}
+
+template <class HashmapType>
+void ParallelMergeTestImpl() {
+  HashmapType hashmap(4096, 50);
+  HashmapType other(4096, 50);
+
+  for (uint64_t key = 1000; key < 3000; ++key) {
+    hashmap.insert(key, 1);
+  }
+  for (uint64_t key = 0; key < 2000; ++key) {
+    other.insert(key, 2);
+  }
+
+  hashmap.parallel_merge_from(other, [](auto existing, auto incoming) { return static_cast<decltype(existing)>(existing + incoming); }, 4);
+
+  EXPECT_EQ(hashmap.get_current_size(), 3000);
+  for (uint64_t key = 0; key < 3000; ++key) {
+    EXPECT_EQ(hashmap.lookup(key), (key < 1000) ? 2 : ((key < 2000) ? 3 : 1));
+  }
+  EXPECT_FALSE(hashmap.contains(3000));
+}
+
 template <class HashmapType>
 void PointerUpdateTestImpl() {
   HashmapType hashmap(64, 7);
@@ -300,4 +383,48 @@ void PointerExternalUpdateTestImpl() {
   EXPECT_EQ(*hashmap.lookup(43), 4712);
 }
 
+template <class HashsetType>
+void SetInsertAndContainsTestImpl() {
+  HashsetType hashset(64, 50);
+  EXPECT_FALSE(hashset.contains(42));
+
+  for (uint8_t key = 1; key < 33; ++key) {
+    hashset.insert(key);
+  }
+  // Inserting an existing key does not add it a second time
+  hashset.insert(1);
+  EXPECT_EQ(hashset.get_current_size(), 32);
+
+  for (uint8_t key = 1; key < 33; ++key) {
+    EXPECT_TRUE(hashset.contains(key));
+  }
+  EXPECT_FALSE(hashset.contains(0));
+  EXPECT_FALSE(hashset.contains(33));
+
+  hashset.reset();
+  EXPECT_EQ(hashset.get_current_size(), 0);
+  EXPECT_FALSE(hashset.contains(1));
+}
+
+template <class HashsetType>
+void SetMergeTestImpl() {
+  HashsetType hashset(64, 50);
+  HashsetType other(64, 50);
+
+  for (uint8_t key = 10; key < 30; ++key) {
+    hashset.insert(key);
+  }
+  for (uint8_t key = 0; key < 20; ++key) {
+    other.insert(key);
+  }
+
+  hashset.merge_from(other, [](auto existing, auto) { return existing; });
+
+  EXPECT_EQ(hashset.get_current_size(), 30);
+  for (uint8_t key = 0; key < 30; ++key) {
+    EXPECT_TRUE(hashset.contains(key));
+  }
+  EXPECT_FALSE(hashset.contains(30));
+}
+
 }  // namespace hashmap
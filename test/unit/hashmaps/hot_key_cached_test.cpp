@@ -0,0 +1,136 @@
+#include "hashmap/hashmaps/hot_key_cached.hpp"
+
+#include <cstdint>
+
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/bucketing_simd.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/linear_probing_aos.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralHotKeyCachedHashTableTest : public ::testing::Test {};
+
+template <class T>
+class StringHotKeyCachedHashTableTest : public ::testing::Test {};
+
+class SpecificHotKeyCachedHashTableTest : public ::testing::Test {};
+
+using CachedLinearProbingTable =
+    HotKeyCachedHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>>,
+                          StdHasher<uint64_t, false>>;
+
+typedef Types<CachedLinearProbingTable,
+              HotKeyCachedHashTable<uint32_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>>,
+                                    StdHasher<uint32_t, false>, 1>,
+              HotKeyCachedHashTable<uint64_t, uint64_t,
+                                    ChainedHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>,
+                                    MurmurHasher<uint64_t, false>, 16>,
+              HotKeyCachedHashTable<uint64_t, uint64_t,
+                                    BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8,
+                                                           128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+                                    StdHasher<uint64_t, false>>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralHotKeyCachedHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralHotKeyCachedHashTableTest, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
+
+TEST_F(SpecificHotKeyCachedHashTableTest, TestAdmissionOnSecondAccess) {
+  CachedLinearProbingTable hashmap(1024, 50, false);
+  EXPECT_EQ(CachedLinearProbingTable::cache_size_in_bytes(), 512 * utils::cacheline_size);
+  hashmap.insert(42, 1);
+
+  // The first lookup only marks the key as candidate, the second one admits it, and the third one is answered by the cache
+  EXPECT_EQ(hashmap.lookup(42), 1);
+  EXPECT_EQ(hashmap.lookup(42), 1);
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 0);
+  EXPECT_EQ(hashmap.lookup(42), 1);
+  EXPECT_TRUE(hashmap.contains(42));
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 2);
+
+  // Misses are never cached
+  for (uint64_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(hashmap.lookup(43), 0);
+  }
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 2);
+
+  hashmap.reset();
+  EXPECT_FALSE(hashmap.contains(42));
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 0);
+}
+
+TEST_F(SpecificHotKeyCachedHashTableTest, TestInsertUpdatesCachedValue) {
+  CachedLinearProbingTable hashmap(1024, 50, false);
+  hashmap.insert(42, 1);
+  hashmap.lookup(42);
+  hashmap.lookup(42);
+
+  hashmap.insert(42, 1337);
+  EXPECT_EQ(hashmap.lookup(42), 1337);
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 1);
+}
+
+TEST_F(SpecificHotKeyCachedHashTableTest, TestEviction) {
+  // With a single set, the third admitted key replaces the least recently used one
+  HotKeyCachedHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>>,
+                        StdHasher<uint64_t, false>, 1>
+      hashmap(1024, 50, false);
+  for (uint64_t key = 1; key <= 3; ++key) {
+    hashmap.insert(key, key);
+  }
+
+  for (uint64_t key = 1; key <= 2; ++key) {
+    hashmap.lookup(key);
+    hashmap.lookup(key);
+  }
+  EXPECT_EQ(hashmap.lookup(1), 1);
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 1);
+
+  hashmap.lookup(3);
+  hashmap.lookup(3);
+  EXPECT_EQ(hashmap.lookup(1), 1);
+  EXPECT_EQ(hashmap.lookup(3), 3);
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 3);
+  EXPECT_EQ(hashmap.lookup(2), 2);
+  EXPECT_EQ(hashmap.get_num_cache_hits(), 3);
+}
+
+TEST_F(SpecificHotKeyCachedHashTableTest, TestPointerUpdate) {
+  PointerUpdateTestImpl<HotKeyCachedHashTable<uint64_t, uint64_t*,
+                                              AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t*, StdHasher<uint64_t, false>>,
+                                              StdHasher<uint64_t, false>>>();
+}
+
+typedef Types<HotKeyCachedHashTable<StringKey, uint64_t, AutoPaddedLinearProbingAoSHashTable<StringKey, uint64_t, XXHasher<StringKey, false>>,
+                                    XXHasher<StringKey, false>>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringHotKeyCachedHashTableTest, StringHashTableTypes);
+
+TYPED_TEST(StringHotKeyCachedHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringHotKeyCachedHashTableTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringHotKeyCachedHashTableTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringHotKeyCachedHashTableTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringHotKeyCachedHashTableTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringHotKeyCachedHashTableTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
@@ -51,6 +51,8 @@ TYPED_TEST(GeneralLinearProbingAoSHashMapTest, TestInsertAndLookup) { InsertAndL
 TYPED_TEST(GeneralLinearProbingAoSHashMapTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralLinearProbingAoSHashMapTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralLinearProbingAoSHashMapTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralLinearProbingAoSHashMapTest, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralLinearProbingAoSHashMapTest, TestMerge) { MergeTestImpl<TypeParam>(); }
 
 TEST_F(SpecificLinearProbingAoSHashMapTest, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>>>();
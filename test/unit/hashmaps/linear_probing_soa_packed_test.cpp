@@ -44,6 +44,7 @@ TYPED_TEST(GeneralLinearProbingPackedSoAHashMapTest, TestInsertAndLookup) { Inse
 TYPED_TEST(GeneralLinearProbingPackedSoAHashMapTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralLinearProbingPackedSoAHashMapTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralLinearProbingPackedSoAHashMapTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralLinearProbingPackedSoAHashMapTest, TestMerge) { MergeTestImpl<TypeParam>(); }
 
 TEST_F(SpecificLinearProbingPackedSoAHashMapTest, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<LinearProbingPackedSoAHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>>>();
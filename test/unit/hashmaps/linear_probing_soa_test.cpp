@@ -28,6 +28,9 @@ class StringLinearProbingSoAHashMapTest : public ::testing::Test {};
 
 class SpecificLinearProbingSoAHashMapTest : public ::testing::Test {};
 
+template <class T>
+class GeneralLinearProbingSoAHashSetTest : public ::testing::Test {};
+
 typedef Types<LinearProbingSoAHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>>,
               LinearProbingSoAHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>>,
               LinearProbingSoAHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>>,
@@ -44,6 +47,7 @@ TYPED_TEST(GeneralLinearProbingSoAHashMapTest, TestInsertAndLookup) { InsertAndL
 TYPED_TEST(GeneralLinearProbingSoAHashMapTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralLinearProbingSoAHashMapTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(GeneralLinearProbingSoAHashMapTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralLinearProbingSoAHashMapTest, TestMerge) { MergeTestImpl<TypeParam>(); }
 
 TEST_F(SpecificLinearProbingSoAHashMapTest, TestBlackboxCrossBoundaryInsertion) {
   CrossBoundariesTestImpl<LinearProbingSoAHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>>>();
@@ -83,4 +87,13 @@ TYPED_TEST(StringLinearProbingSoAHashMapTest, TestUpdate) { StringUpdateTestImpl
 TYPED_TEST(StringLinearProbingSoAHashMapTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
 TYPED_TEST(StringLinearProbingSoAHashMapTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
 
+typedef Types<LinearProbingSoAHashSet<uint64_t, StdHasher<uint64_t, false>>, LinearProbingSoAHashSet<uint32_t, StdHasher<uint32_t, false>>,
+              LinearProbingSoAHashSet<uint64_t, StaticHasher<uint64_t>>>
+    HashSetTypes;
+TYPED_TEST_SUITE(GeneralLinearProbingSoAHashSetTest, HashSetTypes);
+
+TYPED_TEST(GeneralLinearProbingSoAHashSetTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralLinearProbingSoAHashSetTest, TestInsertAndContains) { SetInsertAndContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralLinearProbingSoAHashSetTest, TestMerge) { SetMergeTestImpl<TypeParam>(); }
+
 }  // namespace hashmap
@@ -0,0 +1,134 @@
+#include "hashmap/hashmaps/perfect_hashing.hpp"
+
+#include <cstdint>
+
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "unit/hashmaps/hashers.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralPerfectHashTableTest : public ::testing::Test {};
+
+template <class T>
+class StringPerfectHashTableTest : public ::testing::Test {};
+
+class SpecificPerfectHashTableTest : public ::testing::Test {};
+
+typedef Types<PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>>, PerfectHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>>,
+              PerfectHashTable<uint64_t, uint32_t, StdHasher<uint64_t, false>>, PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, true>>,
+              PerfectHashTable<uint64_t, uint64_t, MurmurHasher<uint64_t, false>>, PerfectHashTable<uint64_t, uint64_t, XXHasher<uint64_t, false>>,
+              PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint8_t>,
+              PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, false, 1>,
+              PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint32_t, true, 8>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralPerfectHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralPerfectHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralPerfectHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralPerfectHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralPerfectHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralPerfectHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralPerfectHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralPerfectHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+TEST_F(SpecificPerfectHashTableTest, TestBuildAndRebuild) {
+  constexpr uint64_t num_keys = 100000;
+  PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>> hashmap(262144, 100, false);
+
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    hashmap.insert(key * 7, key);
+  }
+  hashmap.build();
+  EXPECT_EQ(hashmap.get_current_size(), num_keys);
+
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    ASSERT_EQ(hashmap.lookup(key * 7), key);
+    ASSERT_FALSE(hashmap.contains(key * 7 + 1));
+  }
+
+  // Updates of contained keys are done in place
+  hashmap.insert(42 * 7, 1337);
+  EXPECT_EQ(hashmap.lookup(42 * 7), 1337);
+
+  // New keys trigger a rebuild that keeps all existing entries
+  for (uint64_t key = num_keys; key < 2 * num_keys; ++key) {
+    hashmap.insert(key * 7, key);
+  }
+  EXPECT_EQ(hashmap.get_current_size(), 2 * num_keys);
+  EXPECT_EQ(hashmap.lookup(42 * 7), 1337);
+  for (uint64_t key = 0; key < 2 * num_keys; ++key) {
+    if (key != 42) {
+      ASSERT_EQ(hashmap.lookup(key * 7), key);
+    }
+  }
+}
+
+TEST_F(SpecificPerfectHashTableTest, TestDuplicateInsertsBeforeBuild) {
+  PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>> hashmap(16, 100, false);
+  hashmap.insert(1, 1);
+  hashmap.insert(2, 2);
+  hashmap.insert(1, 3);
+
+  EXPECT_EQ(hashmap.get_current_size(), 2);
+  EXPECT_EQ(hashmap.lookup(1), 3);
+  EXPECT_EQ(hashmap.lookup(2), 2);
+}
+
+TEST_F(SpecificPerfectHashTableTest, TestDuplicateInsertsDoNotFillTheDeltaBuffer) {
+  PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>> hashmap(4, 100, false);
+  hashmap.insert(1, 1);
+  hashmap.build();
+
+  // Only distinct keys count towards the capacity
+  for (uint64_t value = 0; value < 16; ++value) {
+    hashmap.insert(2, value);
+    hashmap.insert(3, value);
+  }
+  hashmap.insert(4, 4);
+
+  EXPECT_EQ(hashmap.get_current_size(), 4);
+  EXPECT_EQ(hashmap.lookup(1), 1);
+  EXPECT_EQ(hashmap.lookup(2), 15);
+  EXPECT_EQ(hashmap.lookup(3), 15);
+  EXPECT_EQ(hashmap.lookup(4), 4);
+  EXPECT_EQ(hashmap.get_current_size(), 4);
+}
+
+TEST_F(SpecificPerfectHashTableTest, TestReset) {
+  PerfectHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>> hashmap(64, 100, false);
+  hashmap.insert(1, 1);
+  EXPECT_TRUE(hashmap.contains(1));
+
+  hashmap.reset();
+  EXPECT_EQ(hashmap.get_current_size(), 0);
+  EXPECT_FALSE(hashmap.contains(1));
+
+  hashmap.insert(2, 2);
+  EXPECT_FALSE(hashmap.contains(1));
+  EXPECT_EQ(hashmap.lookup(2), 2);
+}
+
+typedef Types<PerfectHashTable<StringKey, uint64_t, XXHasher<StringKey, false>>> StringHashTableTypes;
+TYPED_TEST_SUITE(StringPerfectHashTableTest, StringHashTableTypes);
+
+TYPED_TEST(StringPerfectHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringPerfectHashTableTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringPerfectHashTableTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringPerfectHashTableTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringPerfectHashTableTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringPerfectHashTableTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
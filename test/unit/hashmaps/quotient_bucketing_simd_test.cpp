@@ -0,0 +1,120 @@
+#include "hashmap/hashmaps/quotient_bucketing_simd.hpp"
+
+#include <cstdint>
+
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashmaps/bucketing_simd.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralQuotientBucketingSIMDHashTableTest : public ::testing::Test {};
+
+template <class T>
+class GeneralQuotientBucketingSIMDHashSetTest : public ::testing::Test {};
+
+class SpecificQuotientBucketingSIMDHashTableTest : public ::testing::Test {};
+
+// The unit tests use small tables, hence the remainders need (almost) the full key width
+typedef Types<QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 8>, QuotientBucketingSIMDHashTable<uint32_t, uint64_t, uint16_t, 4>,
+              QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint8_t, 8, 16>,
+              QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 8, 8, 128, SIMDAlgorithm::NO_TESTZ>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralQuotientBucketingSIMDHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestCrossBoundaries) { CrossBoundariesTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralQuotientBucketingSIMDHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+typedef Types<QuotientBucketingSIMDHashTable<uint64_t, NoValue, uint16_t, 8>, QuotientBucketingSIMDHashTable<uint32_t, NoValue, uint16_t, 4>>
+    HashSetTypes;
+TYPED_TEST_SUITE(GeneralQuotientBucketingSIMDHashSetTest, HashSetTypes);
+
+TYPED_TEST(GeneralQuotientBucketingSIMDHashSetTest, TestInsertAndContains) { SetInsertAndContainsTestImpl<TypeParam>(); }
+
+TEST_F(SpecificQuotientBucketingSIMDHashTableTest, TestHashMatchesMultShift) {
+  using HashTableT = QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 8>;
+  EXPECT_EQ(HashTableT::multiplier, (MultShift64BHasher<uint64_t, false>::static_hash(1)));
+  EXPECT_EQ(static_cast<uint64_t>(HashTableT::multiplier * HashTableT::inverse_multiplier), 1);
+}
+
+TEST_F(SpecificQuotientBucketingSIMDHashTableTest, TestKeysAreRebuiltFromRemainders) {
+  constexpr uint64_t num_keys = 1024;
+  QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 8> hashmap(num_keys, 100, false);
+  for (uint64_t i = 0; i < num_keys; ++i) {
+    hashmap.insert(i * 0x9E3779B97F4A7C15ULL, i);
+  }
+
+  uint64_t num_entries = 0;
+  for (uint64_t bucket_idx = 0; bucket_idx < hashmap.get_num_buckets(); ++bucket_idx) {
+    for (uint16_t index_in_bucket = 0; index_in_bucket < hashmap.get_num_entries(bucket_idx); ++index_in_bucket, ++num_entries) {
+      const std::pair<uint64_t, uint64_t> entry = hashmap.get_entry(bucket_idx, index_in_bucket);
+      EXPECT_EQ(entry.first, entry.second * 0x9E3779B97F4A7C15ULL);
+    }
+  }
+  EXPECT_EQ(num_entries, num_keys);
+}
+
+TEST_F(SpecificQuotientBucketingSIMDHashTableTest, TestCompressedRemainders) {
+  // 2^13 buckets leave 19 remainder bits for 32-bit keys, which fit into 3 bytes with 5 bits for the displacement
+  constexpr uint64_t num_keys = 65536;
+  using HashTableT = QuotientBucketingSIMDHashTable<uint32_t, uint64_t, uint16_t, 3>;
+  HashTableT hashmap(num_keys, 100, false);
+  ASSERT_TRUE(hashmap.can_be_used());
+  EXPECT_EQ(hashmap.get_remainder_bits(), 19);
+  EXPECT_EQ(hashmap.get_max_displacement(), 31);
+
+  // Fill up to a load factor of 75%, which keeps the displacement well below the limit
+  constexpr uint32_t num_inserted = 3 * num_keys / 4;
+  for (uint32_t key = 0; key < num_inserted; ++key) {
+    hashmap.insert(key * 7, key);
+  }
+  EXPECT_EQ(hashmap.get_current_size(), num_inserted);
+
+  for (uint32_t key = 0; key < num_inserted; ++key) {
+    ASSERT_EQ(hashmap.lookup(key * 7), key);
+    ASSERT_FALSE(hashmap.contains(key * 7 + 1));
+  }
+
+  for (uint64_t bucket_idx = 0; bucket_idx < hashmap.get_num_buckets(); ++bucket_idx) {
+    for (uint16_t index_in_bucket = 0; index_in_bucket < hashmap.get_num_entries(bucket_idx); ++index_in_bucket) {
+      const std::pair<uint32_t, uint64_t> entry = hashmap.get_entry(bucket_idx, index_in_bucket);
+      ASSERT_EQ(entry.first, entry.second * 7);
+    }
+  }
+}
+
+TEST_F(SpecificQuotientBucketingSIMDHashTableTest, TestTooSmallTableCannotBeUsed) {
+  // 8 buckets leave 61 remainder bits, which do not fit into 5 bytes
+  QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 5> hashmap(64, 100, false);
+  EXPECT_FALSE(hashmap.can_be_used());
+
+  QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 8> full_width_hashmap(64, 100, false);
+  EXPECT_TRUE(full_width_hashmap.can_be_used());
+}
+
+TEST_F(SpecificQuotientBucketingSIMDHashTableTest, TestBucketIsSmallerThanKeyStoringBucket) {
+  using QuotientBucketT = QuotientBucketingSIMDHashTable<uint64_t, uint64_t, uint16_t, 5>::BucketT;
+  using KeyStoringBucketT = BucketingSIMDHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                                   SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>::BucketT;
+  EXPECT_LT(sizeof(QuotientBucketT), sizeof(KeyStoringBucketT));
+  // 16 bytes of fingerprints, 2 bytes of metadata, 40 bytes of remainders, and 64 bytes of values
+  EXPECT_EQ(sizeof(QuotientBucketT), 128);
+}
+
+}  // namespace hashmap
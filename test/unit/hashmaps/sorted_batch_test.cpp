@@ -0,0 +1,149 @@
+#include "hashmap/hashmaps/sorted_batch.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/bucketing_simd.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/linear_probing_aos.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralSortedBatchHashTableTest : public ::testing::Test {};
+
+template <class T>
+class StringSortedBatchHashTableTest : public ::testing::Test {};
+
+class SpecificSortedBatchHashTableTest : public ::testing::Test {};
+
+// Small groups, such that even the test tables are split into many groups
+using BatchedLinearProbingTable =
+    SortedBatchHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>>,
+                         MultShift64BHasher<uint64_t, false>, 1000, 1024>;
+
+template <class HashmapType>
+void SortedBatchMatchesLookupsTestImpl() {
+  HashmapType hashmap(16384, 50, false);
+  for (uint64_t key = 1; key <= 8192; ++key) {
+    hashmap.insert(key, key * 2);
+  }
+
+  // Half of the queries miss, and the last batch is only partially filled
+  std::mt19937_64 gen{42};
+  std::uniform_int_distribution<uint64_t> dist{1, 16384};
+  std::vector<uint64_t> queries(2500);
+  for (uint64_t& query : queries) {
+    query = dist(gen);
+  }
+
+  std::vector<uint64_t> results(HashmapType::batch_size);
+  for (uint64_t offset = 0; offset < queries.size(); offset += HashmapType::batch_size) {
+    const uint64_t count = std::min(HashmapType::batch_size, queries.size() - offset);
+    hashmap.lookup_sorted_batch(&queries[offset], count, results.data());
+    for (uint64_t i = 0; i < count; ++i) {
+      EXPECT_EQ(results[i], hashmap.lookup(queries[offset + i]));
+      EXPECT_EQ(results[i], queries[offset + i] <= 8192 ? queries[offset + i] * 2 : 0);
+    }
+  }
+}
+
+typedef Types<BatchedLinearProbingTable,
+              SortedBatchHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>>,
+                                   StdHasher<uint64_t, false>, 1>,
+              SortedBatchHashTable<uint64_t, uint64_t,
+                                   ChainedHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>, false, MemoryBudget::KeyValue, 100>,
+                                   MultShift64BHasher<uint64_t, false>, 512, 4096>,
+              SortedBatchHashTable<uint64_t, uint64_t,
+                                   BucketingSIMDHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, finalizer::FASTRANGE>, uint16_t,
+                                                          KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON,
+                                                          false, false, hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                                          FingerprintBucketBits::LSBMSB>,
+                                   MultShift64BHasher<uint64_t, finalizer::FASTRANGE>, 1000, 1024>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralSortedBatchHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralSortedBatchHashTableTest, TestSortedBatchMatchesLookups) { SortedBatchMatchesLookupsTestImpl<TypeParam>(); }
+
+TEST_F(SpecificSortedBatchHashTableTest, TestNumGroups) {
+  // The group count is a power of two that is capped by the batch size
+  BatchedLinearProbingTable hashmap(16384, 50, false);
+  EXPECT_EQ(BatchedLinearProbingTable::max_groups, 512);
+  EXPECT_GT(hashmap.num_groups(), 1);
+  EXPECT_LE(hashmap.num_groups(), BatchedLinearProbingTable::max_groups);
+  EXPECT_TRUE(utils::is_power_of_two(hashmap.num_groups()));
+
+  // A table that fits into a single group is probed in input order
+  SortedBatchHashTable<uint64_t, uint64_t, AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, false>>,
+                       MultShift64BHasher<uint64_t, false>, 1000, 1ULL << 40U>
+      single_group_hashmap(16384, 50, false);
+  EXPECT_EQ(single_group_hashmap.num_groups(), 1);
+}
+
+TEST_F(SpecificSortedBatchHashTableTest, TestSetBatch) {
+  using HashSetT = SortedBatchHashTable<uint64_t, NoValue,
+                                        BucketingSIMDHashSet<uint64_t, MultShift64BHasher<uint64_t, false>, uint16_t, 8, 128, SIMDAlgorithm::TESTZ,
+                                                             false, false, NEONAlgo::SSE2NEON, false, false,
+                                                             hashmap::utils::PrefetchingLocality::MEDIUM, false, false,
+                                                             FingerprintBucketBits::LSBMSB>,
+                                        MultShift64BHasher<uint64_t, false>, 64, 1024>;
+  static_assert(KeyOnlyHashSet<HashSetT>);
+
+  HashSetT hashset(16384, 50, false);
+  for (uint64_t key = 2; key <= 16384; key += 2) {
+    hashset.insert(key);
+  }
+
+  std::vector<uint64_t> queries(HashSetT::batch_size);
+  for (uint64_t i = 0; i < queries.size(); ++i) {
+    queries[i] = (i * 7919) % 16384 + 1;
+  }
+
+  bool results[HashSetT::batch_size];
+  hashset.lookup_sorted_batch(queries.data(), queries.size(), results);
+  for (uint64_t i = 0; i < queries.size(); ++i) {
+    EXPECT_EQ(results[i], queries[i] % 2 == 0);
+  }
+}
+
+TEST_F(SpecificSortedBatchHashTableTest, TestPointerUpdate) {
+  PointerUpdateTestImpl<SortedBatchHashTable<uint64_t, uint64_t*,
+                                             AutoPaddedLinearProbingAoSHashTable<uint64_t, uint64_t*, StdHasher<uint64_t, false>>,
+                                             StdHasher<uint64_t, false>>>();
+}
+
+typedef Types<SortedBatchHashTable<StringKey, uint64_t, AutoPaddedLinearProbingAoSHashTable<StringKey, uint64_t, XXHasher<StringKey, false>>,
+                                   XXHasher<StringKey, false>>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringSortedBatchHashTableTest, StringHashTableTypes);
+
+TYPED_TEST(StringSortedBatchHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(StringSortedBatchHashTableTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringSortedBatchHashTableTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringSortedBatchHashTableTest, TestUpdate) { StringUpdateTestImpl<TypeParam>(); }
+TYPED_TEST(StringSortedBatchHashTableTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(StringSortedBatchHashTableTest, TestContainsOnFullHashMap) { StringContainsOnFullHashMapImpl<TypeParam>(); }
+
+}  // namespace hashmap
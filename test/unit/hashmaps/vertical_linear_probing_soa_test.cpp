@@ -0,0 +1,157 @@
+#include "hashmap/hashmaps/vertical_linear_probing_soa.hpp"
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "unit/hashmaps/hashers.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralVerticalLinearProbingSoAHashTableTest : public ::testing::Test {};
+
+class SpecificVerticalLinearProbingSoAHashTableTest : public ::testing::Test {};
+
+// Inserts a batch with many duplicate keys, such that lanes collide on slots and updates, and checks that every key holds the value of its
+// last occurrence, as after sequential inserts (the slot placement may differ). Then looks up a batch of which about half misses. The small
+// batch size splits both into several chunks.
+template <class HashmapType>
+void BatchMatchesSequentialTestImpl() {
+  using KeyT = decltype(key_type_of(&HashmapType::contains));
+  HashmapType hashmap(4096, 50, false);
+
+  std::mt19937_64 gen{42};
+  std::uniform_int_distribution<uint64_t> dist{1, 2000};
+  std::vector<KeyT> keys(3000);
+  std::vector<uint64_t> values(keys.size());
+  std::unordered_map<KeyT, uint64_t> expected;
+  for (uint64_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<KeyT>(dist(gen));
+    values[i] = i + 1;
+    expected[keys[i]] = values[i];
+  }
+
+  hashmap.insert_batch(keys.data(), values.data(), keys.size());
+  EXPECT_EQ(hashmap.get_current_size(), expected.size());
+
+  std::vector<KeyT> queries(4000);
+  for (uint64_t i = 0; i < queries.size(); ++i) {
+    queries[i] = static_cast<KeyT>(i + 1);
+  }
+
+  std::vector<uint64_t> results(queries.size());
+  hashmap.lookup_batch(queries.data(), queries.size(), results.data());
+  for (uint64_t i = 0; i < queries.size(); ++i) {
+    const auto it = expected.find(queries[i]);
+    EXPECT_EQ(results[i], it == expected.end() ? 0 : it->second);
+    EXPECT_EQ(results[i], hashmap.lookup(queries[i]));
+  }
+}
+
+typedef Types<VerticalLinearProbingSoAHashTable<uint32_t, uint64_t, StdHasher<uint32_t, false>, false, 1000>,
+              VerticalLinearProbingSoAHashTable<uint64_t, uint64_t, StdHasher<uint64_t, false>, false, 1000>,
+              VerticalLinearProbingSoAHashTable<uint32_t, uint64_t, MultShift64BHasher<uint32_t, false>, false, 1000>,
+              VerticalLinearProbingSoAHashTable<uint64_t, uint64_t, MultShift64BHasher<uint64_t, true>, false, 1000>,
+              VerticalLinearProbingSoAHashTable<uint32_t, uint64_t, TwoStaticHasher<uint32_t>, false, 1000>,
+              VerticalLinearProbingSoAHashTable<uint64_t, uint64_t, TwoStaticHasher<uint64_t>>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralVerticalLinearProbingSoAHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestInitialization) { InitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestLargerInitialization) { LargeInitializationTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestMemoryUsage) { MemoryUsageTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralVerticalLinearProbingSoAHashTableTest, TestBatchMatchesSequential) { BatchMatchesSequentialTestImpl<TypeParam>(); }
+
+TEST_F(SpecificVerticalLinearProbingSoAHashTableTest, TestBatchOnFullHashMap) {
+  // All keys share one probing sequence around the whole table, i.e., misses only end after as many slots as there are elements
+  VerticalLinearProbingSoAHashTable<uint32_t, uint64_t, TwoStaticHasher<uint32_t>> hashmap(64, 100, false);
+  std::vector<uint32_t> keys(64);
+  std::vector<uint64_t> values(keys.size());
+  for (uint32_t i = 0; i < keys.size(); ++i) {
+    keys[i] = i + 1;
+    values[i] = i * 3;
+  }
+  hashmap.insert_batch(keys.data(), values.data(), keys.size());
+  EXPECT_EQ(hashmap.get_current_size(), 64);
+
+  std::vector<uint32_t> queries(128);
+  for (uint32_t i = 0; i < queries.size(); ++i) {
+    queries[i] = i + 1;
+  }
+  std::vector<uint64_t> results(queries.size());
+  hashmap.lookup_batch(queries.data(), queries.size(), results.data());
+  for (uint32_t i = 0; i < queries.size(); ++i) {
+    EXPECT_EQ(results[i], i < 64 ? i * 3 : 0);
+  }
+}
+
+TEST_F(SpecificVerticalLinearProbingSoAHashTableTest, TestSetBatch) {
+  using HashSetT = VerticalLinearProbingSoAHashSet<uint32_t, MultShift64BHasher<uint32_t, false>, false, 100>;
+  static_assert(KeyOnlyHashSet<HashSetT>);
+
+  HashSetT hashset(16384, 50, false);
+  std::vector<uint32_t> keys;
+  for (uint32_t key = 2; key <= 16384; key += 2) {
+    keys.push_back(key);
+    keys.push_back(key);
+  }
+  hashset.insert_batch(keys.data(), keys.size());
+  EXPECT_EQ(hashset.get_current_size(), 8192);
+
+  std::vector<uint32_t> queries(1000);
+  for (uint32_t i = 0; i < queries.size(); ++i) {
+    queries[i] = (i * 7919) % 16384 + 1;
+  }
+
+  bool results[1000];
+  hashset.lookup_batch(queries.data(), queries.size(), results);
+  for (uint32_t i = 0; i < queries.size(); ++i) {
+    EXPECT_EQ(results[i], queries[i] % 2 == 0);
+    EXPECT_EQ(results[i], hashset.contains(queries[i]));
+  }
+}
+
+TEST_F(SpecificVerticalLinearProbingSoAHashTableTest, TestPointerBatch) {
+  VerticalLinearProbingSoAHashTable<uint32_t, uint64_t*, StdHasher<uint32_t, false>> hashmap(64, 50, false);
+  uint64_t data[16];
+  std::vector<uint32_t> keys(16);
+  std::vector<uint64_t*> values(16);
+  for (uint32_t i = 0; i < 16; ++i) {
+    data[i] = i * 5;
+    keys[i] = i + 1;
+    values[i] = &data[i];
+  }
+  hashmap.insert_batch(keys.data(), values.data(), keys.size());
+
+  std::vector<uint32_t> queries{1, 16, 17, 8};
+  std::vector<uint64_t*> results(queries.size());
+  hashmap.lookup_batch(queries.data(), queries.size(), results.data());
+  EXPECT_EQ(results[0], &data[0]);
+  EXPECT_EQ(results[1], &data[15]);
+  EXPECT_EQ(results[2], nullptr);
+  EXPECT_EQ(*results[3], 35);
+}
+
+TEST_F(SpecificVerticalLinearProbingSoAHashTableTest, TestPointerUpdate) {
+  PointerUpdateTestImpl<VerticalLinearProbingSoAHashTable<uint64_t, uint64_t*, TwoStaticHasher<uint64_t>>>();
+}
+
+}  // namespace hashmap
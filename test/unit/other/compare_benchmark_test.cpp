@@ -0,0 +1,134 @@
+#include "benchmark/compare_benchmark.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace benchmark::compare;
+
+namespace hashmap {
+
+class CompareBenchmarkTest : public ::testing::Test {
+ protected:
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  std::filesystem::path write_csv(const std::vector<std::string>& lines) {
+    std::ofstream file(path_);
+    for (const std::string& line : lines) {
+      file << line << std::endl;
+    }
+    return path_;
+  }
+
+  std::filesystem::path path_ = std::filesystem::temp_directory_path() / "hashmap_compare_benchmark_test.csv";
+};
+
+TEST_F(CompareBenchmarkTest, TestSweepsOfTheSameTableAreGroupedSeparately) {
+  // Only the columns the comparison reads, in a different order than the read benchmark writes them
+  const RuntimeSamples samples = read_result_csv(write_csv({
+      "Hashmap,LoadFactor,SQR,Size,ThreadCount,Distribution,Workload,Runtime,ZipfFactor,Successful,MemoryBudget,BatchSize",
+      "Table,50,100,1000,1,dense,1,10,1.25,true,0,0",
+      "Table,50,100,1000,1,dense,1,11,1.25,true,0,0",
+      "Table,50,100,1000,1,dense,1,20,1.5,true,0,0",
+      "Table,50,100,1000,1,dense,1,30,1.25,true,150,0",
+      "Table,50,100,1000,1,dense,1,40,1.25,true,200,0",
+      "Table,50,100,1000,1,dense,1,50,1.25,true,0,8",
+      "Table,50,100,2000,1,dense,1,60,1.25,true,0,0",
+      "Table,50,100,1000,1,sparse,1,70,1.25,true,0,0",
+      "Table,50,100,1000,1,dense,2,80,1.25,true,0,0",
+      "Table,50,100,1000,1,dense,1,90,1.25,false,0,0",
+  }));
+
+  ASSERT_EQ(samples.size(), 8);
+  const ConfigurationKey base{"Table", "50", "100", "1", "1000", "dense", "1", "1.25", "0", "0"};
+  EXPECT_EQ(samples.at(base), (std::vector<double>{10, 11}));
+
+  ConfigurationKey zipf = base;
+  zipf.zipf_factor = "1.5";
+  EXPECT_EQ(samples.at(zipf), std::vector<double>{20});
+
+  ConfigurationKey budget = base;
+  budget.memory_budget = "200";
+  EXPECT_EQ(samples.at(budget), std::vector<double>{40});
+
+  ConfigurationKey batch = base;
+  batch.batch_size = "8";
+  EXPECT_EQ(samples.at(batch), std::vector<double>{50});
+
+  ConfigurationKey size = base;
+  size.hashtable_size = "2000";
+  EXPECT_EQ(samples.at(size), std::vector<double>{60});
+
+  EXPECT_EQ(configuration_details(batch), "Size=1000 Distribution=dense Workload=1 ZipfFactor=1.25 MemoryBudget=0 BatchSize=8");
+}
+
+TEST_F(CompareBenchmarkTest, TestWriteResultsLeaveReadColumnsEmpty) {
+  const RuntimeSamples samples = read_result_csv(write_csv({
+      "Hashmap,LoadFactor,Size,ThreadCount,Distribution,Runtime,Successful",
+      "Table,50,1000,1,dense,10,true",
+      "Table,50,4000,1,dense,20,true",
+  }));
+
+  ASSERT_EQ(samples.size(), 2);
+  EXPECT_EQ(samples.at({"Table", "50", "", "1", "1000", "dense", "", "", "", ""}), std::vector<double>{10});
+  EXPECT_EQ(samples.at({"Table", "50", "", "1", "4000", "dense", "", "", "", ""}), std::vector<double>{20});
+  EXPECT_EQ(configuration_details({"Table", "50", "", "1", "4000", "dense", "", "", "", ""}), "Size=4000 Distribution=dense");
+}
+
+TEST_F(CompareBenchmarkTest, TestMinPValue) {
+  const ComparisonOptions options;
+  // Exact tests: for groups of equal size, the observed split and its mirror image are the most extreme ones
+  EXPECT_DOUBLE_EQ(min_p_value(3, 3, options), 2.0 / 20);
+  EXPECT_DOUBLE_EQ(min_p_value(5, 5, options), 2.0 / 252);
+  EXPECT_DOUBLE_EQ(min_p_value(3, 4, options), 1.0 / 35);
+  // Sampled test
+  EXPECT_DOUBLE_EQ(min_p_value(20, 20, options), 1.0 / static_cast<double>(options.sampled_permutations + 1));
+}
+
+TEST_F(CompareBenchmarkTest, TestVerdicts) {
+  const ConfigurationKey regression{"Regression", "50", "100", "1", "1000", "dense", "1", "0", "0", "0"};
+  const ConfigurationKey win{"Win", "50", "100", "1", "1000", "dense", "1", "0", "0", "0"};
+  const ConfigurationKey unchanged{"Unchanged", "50", "100", "1", "1000", "dense", "1", "0", "0", "0"};
+  const ConfigurationKey underpowered{"Underpowered", "50", "100", "1", "1000", "dense", "1", "0", "0", "0"};
+  const ConfigurationKey baseline_only{"BaselineOnly", "50", "100", "1", "1000", "dense", "1", "0", "0", "0"};
+
+  const std::vector<double> runtimes{100, 101, 102, 103, 104, 105};
+  const RuntimeSamples baseline{
+      {regression, runtimes}, {win, runtimes}, {unchanged, runtimes}, {underpowered, {100, 101, 102}}, {baseline_only, runtimes}};
+  const RuntimeSamples candidate{{regression, {150, 151, 152, 153, 154, 155}},
+                                 {win, {70, 71, 72, 73, 74, 75}},
+                                 {unchanged, {100.5, 101.5, 102.5, 103.5, 104.5, 99.5}},
+                                 {underpowered, {200, 201, 202}}};
+
+  const ComparisonOptions options;
+  const std::vector<ComparisonResult> results = compare(baseline, candidate, options);
+  ASSERT_EQ(results.size(), 4);
+
+  for (const ComparisonResult& result : results) {
+    if (result.configuration == regression) {
+      EXPECT_EQ(result.verdict, Verdict::REGRESSION);
+      EXPECT_LT(result.p_value, options.alpha);
+      EXPECT_GT(result.ratio_ci_low, 1);
+    } else if (result.configuration == win) {
+      EXPECT_EQ(result.verdict, Verdict::WIN);
+      EXPECT_LT(result.p_value, options.alpha);
+      EXPECT_LT(result.ratio_ci_high, 1);
+    } else if (result.configuration == unchanged) {
+      EXPECT_EQ(result.verdict, Verdict::UNCHANGED);
+    } else {
+      // 3 runs per side cannot reach p < 0.05, however large the difference
+      EXPECT_EQ(result.configuration, underpowered);
+      EXPECT_EQ(result.verdict, Verdict::INSUFFICIENT_DATA);
+      EXPECT_GE(result.min_p_value, options.alpha);
+    }
+  }
+}
+
+}  // namespace hashmap
@@ -0,0 +1,147 @@
+#include "hashmap/misc/compositekey.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_set>
+
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/xxhasher.hpp"
+#include "hashmap/hashmaps/bucketing_simd.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/fingerprinting_simd_soa.hpp"
+#include "hashmap/hashmaps/linear_probing_aos.hpp"
+#include "hashmap/utils.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+template <class T>
+class GeneralCompositeKeyHashTableTest : public ::testing::Test {};
+
+class CompositeKeyTest : public ::testing::Test {};
+
+using Key192 = CompositeKey<3>;
+
+typedef Types<UnalignedLinearProbingAoSHashTable<Key128, uint64_t, XXHasher<Key128, false>>,
+              AutoPaddedLinearProbingAoSHashTable<Key128, uint64_t, MurmurHasher<Key128, false>>,
+              ChainedHashTable<Key128, uint64_t, StdHasher<Key128, false>, false, MemoryBudget::KeyValue, 100>,
+              FingerprintingSIMDSoAHashTable<Key128, uint64_t, XXHasher<Key128, false>, uint16_t, 128, SIMDAlgorithm::TESTZ, false, false,
+                                             NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, false, false,
+                                             FingerprintBucketBits::MSBLSB>,
+              BucketingSIMDHashTable<Key128, uint64_t, MultShift64BHasher<Key128, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128,
+                                     SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+              BucketingSIMDHashTable<Key192, uint64_t, XXHasher<Key192, false>, uint16_t, KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ,
+                                     false, false, NEONAlgo::SSE2NEON>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralCompositeKeyHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralCompositeKeyHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralCompositeKeyHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralCompositeKeyHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralCompositeKeyHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralCompositeKeyHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+// All keys share the first column, hence only a comparison of the full key tells them apart
+template <class HashmapType, class KeyT>
+void KeysDifferingInLaterColumnsTestImpl() {
+  constexpr uint64_t num_keys = 512;
+  HashmapType hashmap(1024, 50);
+
+  std::array<uint64_t, KeyT::column_count> columns{};
+  columns[0] = 42;
+  for (uint64_t i = 0; i < num_keys; ++i) {
+    columns[KeyT::column_count - 1] = i;
+    hashmap.insert(KeyT(columns), i);
+  }
+  EXPECT_EQ(hashmap.get_current_size(), num_keys);
+
+  for (uint64_t i = 0; i < num_keys; ++i) {
+    columns[KeyT::column_count - 1] = i;
+    EXPECT_EQ(hashmap.lookup(KeyT(columns)), i);
+  }
+
+  columns[KeyT::column_count - 1] = num_keys;
+  EXPECT_FALSE(hashmap.contains(KeyT(columns)));
+  // The integer 42 converts to (42, 0, ...), i.e., the first inserted key
+  EXPECT_EQ(hashmap.lookup(KeyT(42)), 0);
+}
+
+// Changing any single column has to change the hash
+template <class HasherT, class KeyT>
+void AllColumnsAreMixedTestImpl() {
+  std::array<uint64_t, KeyT::column_count> columns{};
+  for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+    columns[column] = 1000 + column;
+  }
+  const KeyT base_key(columns);
+
+  std::unordered_set<uint64_t> hashes{static_cast<uint64_t>(HasherT::static_hash(base_key))};
+  for (uint8_t column = 0; column < KeyT::column_count; ++column) {
+    std::array<uint64_t, KeyT::column_count> changed_columns = columns;
+    ++changed_columns[column];
+    hashes.insert(static_cast<uint64_t>(HasherT::static_hash(KeyT(changed_columns))));
+  }
+  EXPECT_EQ(hashes.size(), KeyT::column_count + 1);
+}
+
+TEST_F(CompositeKeyTest, TestEquality) {
+  EXPECT_EQ(Key128({1, 2}), Key128({1, 2}));
+  EXPECT_FALSE(Key128({1, 2}) == Key128({1, 3}));
+  EXPECT_FALSE(Key128({1, 2}) == Key128({2, 2}));
+  EXPECT_EQ(Key128(7), Key128({7, 0}));
+
+  EXPECT_EQ(Key192({1, 2, 3}), Key192({1, 2, 3}));
+  EXPECT_FALSE(Key192({1, 2, 3}) == Key192({1, 2, 4}));
+
+  EXPECT_TRUE(Key128({1, 5}) < Key128({2, 0}));
+  EXPECT_TRUE(Key128({1, 2}) < Key128({1, 3}));
+  EXPECT_FALSE(Key128({1, 3}) < Key128({1, 3}));
+
+  static_assert(sizeof(Key128) == 16 && sizeof(Key192) == 24);
+  static_assert(utils::is_composite_key_v<Key128> && !utils::is_composite_key_v<uint64_t>);
+  EXPECT_EQ(utils::data_type_to_str<Key128>(), "compositekey128");
+  EXPECT_EQ(fmt::format("{}", Key192({1, 2, 3})), "(1, 2, 3)");
+}
+
+TEST_F(CompositeKeyTest, TestAllColumnsAreMixed) {
+  AllColumnsAreMixedTestImpl<XXHasher<Key128, false>, Key128>();
+  AllColumnsAreMixedTestImpl<MurmurHasher<Key128, false>, Key128>();
+  AllColumnsAreMixedTestImpl<MultShift64BHasher<Key128, false>, Key128>();
+  AllColumnsAreMixedTestImpl<StdHasher<Key128, false>, Key128>();
+  AllColumnsAreMixedTestImpl<XXHasher<Key192, false>, Key192>();
+  AllColumnsAreMixedTestImpl<MurmurHasher<Key192, false>, Key192>();
+  AllColumnsAreMixedTestImpl<MultShift64BHasher<Key192, false>, Key192>();
+  AllColumnsAreMixedTestImpl<StdHasher<Key192, false>, Key192>();
+}
+
+TEST_F(CompositeKeyTest, TestMultShiftMatchesIntegerKeys) {
+  // A composite key with only its first column set hashes like the corresponding integer key
+  using CompositeHasher = MultShift64BHasher<Key128, false>;
+  using IntegerHasher = MultShift64BHasher<uint64_t, false>;
+  EXPECT_EQ(CompositeHasher::static_hash(Key128(12345)), IntegerHasher::static_hash(12345));
+}
+
+TEST_F(CompositeKeyTest, TestKeysDifferingInLaterColumns) {
+  KeysDifferingInLaterColumnsTestImpl<UnalignedLinearProbingAoSHashTable<Key128, uint64_t, XXHasher<Key128, false>>, Key128>();
+  KeysDifferingInLaterColumnsTestImpl<ChainedHashTable<Key128, uint64_t, MurmurHasher<Key128, false>, false, MemoryBudget::KeyValue, 100>,
+                                      Key128>();
+  KeysDifferingInLaterColumnsTestImpl<BucketingSIMDHashTable<Key128, uint64_t, MultShift64BHasher<Key128, false>, uint16_t,
+                                                             KeyValueAoSStoringBucket, 8, 128, SIMDAlgorithm::TESTZ, false, false,
+                                                             NEONAlgo::SSE2NEON>,
+                                      Key128>();
+  KeysDifferingInLaterColumnsTestImpl<BucketingSIMDHashTable<Key192, uint64_t, XXHasher<Key192, false>, uint16_t, KeyValueAoSStoringBucket, 8,
+                                                             128, SIMDAlgorithm::TESTZ, false, false, NEONAlgo::SSE2NEON>,
+                                      Key192>();
+}
+
+}  // namespace hashmap
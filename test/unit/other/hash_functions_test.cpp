@@ -0,0 +1,272 @@
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "hashmap/hashes/aeshasher.hpp"
+#include "hashmap/hashes/crc32hasher.hpp"
+#include "hashmap/hashes/identity.hpp"
+#include "hashmap/hashes/multshifthasher.hpp"
+#include "hashmap/hashes/murmurhasher.hpp"
+#include "hashmap/hashes/stdhasher.hpp"
+#include "hashmap/hashes/tabulationhasher.hpp"
+#include "hashmap/hashmaps/chained.hpp"
+#include "hashmap/hashmaps/fingerprinting_simd_soa.hpp"
+#include "hashmap/hashmaps/linear_probing_aos.hpp"
+#include "hashmap/misc/compositekey.hpp"
+#include "hashmap/misc/stringkey.hpp"
+#include "hashmap/utils.hpp"
+#include "unit/hashmaps/hashmap_test_impl.hpp"
+// Load gtest last, otherwise we get issues with the FAIL macro
+// clang-format off
+#include "gtest/gtest.h"
+// clang-format on
+
+using namespace hashmap::hashmaps;
+using namespace hashmap::hashing;
+using testing::Types;
+
+namespace hashmap {
+
+class HardwareHasherTest : public ::testing::Test {};
+
+template <class T>
+class GeneralHardwareHasherHashTableTest : public ::testing::Test {};
+
+template <class T>
+class StringHardwareHasherHashTableTest : public ::testing::Test {};
+
+class TabulationHasherTest : public ::testing::Test {};
+
+template <class T>
+class GeneralTabulationHashTableTest : public ::testing::Test {};
+
+class FinalizerTest : public ::testing::Test {};
+
+typedef Types<UnalignedLinearProbingAoSHashTable<uint64_t, uint64_t, CRC32Hasher<uint64_t, false>>,
+              UnalignedLinearProbingAoSHashTable<uint64_t, uint64_t, AESHasher<uint64_t, true>>,
+              ChainedHashTable<uint64_t, uint64_t, CRC32Hasher<uint64_t, false>, false, MemoryBudget::Bucket8FP, 100>,
+              ChainedHashTable<uint64_t, uint64_t, AESHasher<uint64_t, false>, false, MemoryBudget::Bucket16FP, 100>,
+              FingerprintingSIMDSoAHashTable<uint64_t, uint64_t, AESHasher<uint64_t, false>, uint16_t, 128, SIMDAlgorithm::TESTZ, false, false,
+                                             NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, false, false,
+                                             FingerprintBucketBits::MSBLSB>,
+              UnalignedLinearProbingAoSHashTable<Key128, uint64_t, CRC32Hasher<Key128, false>>,
+              UnalignedLinearProbingAoSHashTable<Key128, uint64_t, AESHasher<Key128, false>>>
+    HashTableTypes;
+TYPED_TEST_SUITE(GeneralHardwareHasherHashTableTest, HashTableTypes);
+
+TYPED_TEST(GeneralHardwareHasherHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHardwareHasherHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHardwareHasherHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHardwareHasherHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralHardwareHasherHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+typedef Types<UnalignedLinearProbingAoSHashTable<StringKey, uint64_t, CRC32Hasher<StringKey, false>>,
+              UnalignedLinearProbingAoSHashTable<StringKey, uint64_t, AESHasher<StringKey, false>>>
+    StringHashTableTypes;
+TYPED_TEST_SUITE(StringHardwareHasherHashTableTest, StringHashTableTypes);
+
+TYPED_TEST(StringHardwareHasherHashTableTest, TestContains) { StringContainsTestImpl<TypeParam>(); }
+TYPED_TEST(StringHardwareHasherHashTableTest, TestInsertAndLookup) { StringInsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(StringHardwareHasherHashTableTest, TestMultipleInserts) { StringMultipleInsertsTestImpl<TypeParam>(); }
+
+typedef Types<UnalignedLinearProbingAoSHashTable<uint64_t, uint64_t, TabulationHasher<uint64_t, false>>,
+              UnalignedLinearProbingAoSHashTable<uint64_t, uint64_t, TabulationHasher<uint64_t, true, true>>,
+              ChainedHashTable<uint64_t, uint64_t, TabulationHasher<uint64_t, false, true>, false, MemoryBudget::KeyValue, 100>,
+              FingerprintingSIMDSoAHashTable<uint64_t, uint64_t, TabulationHasher<uint64_t, false>, uint16_t, 128, SIMDAlgorithm::TESTZ, false,
+                                             false, NEONAlgo::SSE2NEON, false, false, utils::PrefetchingLocality::NO, false, false,
+                                             FingerprintBucketBits::MSBLSB>,
+              UnalignedLinearProbingAoSHashTable<Key128, uint64_t, TabulationHasher<Key128, false>>>
+    TabulationHashTableTypes;
+TYPED_TEST_SUITE(GeneralTabulationHashTableTest, TabulationHashTableTypes);
+
+TYPED_TEST(GeneralTabulationHashTableTest, TestContains) { ContainsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralTabulationHashTableTest, TestInsertAndLookup) { InsertAndLookupTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralTabulationHashTableTest, TestUpdate) { UpdateTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralTabulationHashTableTest, TestMultipleInserts) { MultipleInsertsTestImpl<TypeParam>(); }
+TYPED_TEST(GeneralTabulationHashTableTest, TestContainsOnFullHashMap) { ContainsOnFullHashMapImpl<TypeParam>(); }
+
+TEST_F(HardwareHasherTest, TestCRC32CMatchesSoftware) {
+  // CRC-32C of "12345678" with the usual initial value, without the final inversion
+  uint64_t word = 0;
+  std::memcpy(&word, "12345678", sizeof(uint64_t));
+  EXPECT_EQ(crc32c::update_scalar(0xFFFFFFFF, word), 0x9F787F65);
+  EXPECT_EQ(crc32c::update(0xFFFFFFFF, word), 0x9F787F65);
+
+  std::mt19937_64 gen(42);
+  for (uint64_t i = 0; i < 1000; ++i) {
+    const auto crc = static_cast<uint32_t>(gen());
+    const uint64_t value = gen();
+    EXPECT_EQ(crc32c::update(crc, value), crc32c::update_scalar(crc, value));
+  }
+}
+
+TEST_F(HardwareHasherTest, TestAESRoundMatchesSoftware) {
+  // First round of the FIPS-197 Appendix B example
+  const aes::ScalarBlock state = {0x19, 0x3d, 0xe3, 0xbe, 0xa0, 0xf4, 0xe2, 0x2b, 0x9a, 0xc6, 0x8d, 0x2a, 0xe9, 0xf8, 0x48, 0x08};
+  const aes::ScalarBlock round_key = {0xa0, 0xfa, 0xfe, 0x17, 0x88, 0x54, 0x2c, 0xb1, 0x23, 0xa3, 0x39, 0x39, 0x2a, 0x6c, 0x76, 0x05};
+  const aes::ScalarBlock expected = {0xa4, 0x9c, 0x7f, 0xf2, 0x68, 0x9f, 0x35, 0x2b, 0x6b, 0x5b, 0xea, 0x43, 0x02, 0x6a, 0x50, 0x49};
+  EXPECT_EQ(aes::round_scalar(state, round_key), expected);
+
+  std::mt19937_64 gen(42);
+  for (uint64_t i = 0; i < 1000; ++i) {
+    const std::array<uint64_t, 4> words = {gen(), gen(), gen(), gen()};
+    aes::ScalarBlock scalar_state;
+    aes::ScalarBlock scalar_key;
+    std::memcpy(scalar_state.data(), &words[0], scalar_state.size());
+    std::memcpy(scalar_key.data(), &words[2], scalar_key.size());
+
+    const aes::Block result = aes::round(aes::make_block(words[0], words[1]), aes::make_block(words[2], words[3]));
+    aes::ScalarBlock result_bytes;
+    std::memcpy(result_bytes.data(), &result, result_bytes.size());
+    EXPECT_EQ(result_bytes, aes::round_scalar(scalar_state, scalar_key));
+  }
+}
+
+template <class HasherT>
+void BatchMatchesSingleTestImpl() {
+  std::mt19937_64 gen(42);
+  std::vector<uint64_t> keys(1003);
+  for (uint64_t& key : keys) {
+    key = gen();
+  }
+
+  std::vector<uint64_t> hashes(keys.size());
+  HasherT::static_hash_batch(keys.data(), hashes.data(), keys.size());
+  for (uint64_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(hashes[i], HasherT::static_hash(keys[i]));
+  }
+
+  HasherT hasher(1024);
+  hasher.hash_batch(keys.data(), hashes.data(), keys.size());
+  for (uint64_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(hashes[i], hasher.hash(keys[i]));
+  }
+}
+
+TEST_F(HardwareHasherTest, TestBatchMatchesSingle) {
+  BatchMatchesSingleTestImpl<CRC32Hasher<uint64_t, false>>();
+  BatchMatchesSingleTestImpl<AESHasher<uint64_t, false>>();
+}
+
+// Dense keys and strings differing in a single character must not collide, and the fingerprint bits must not be constant
+template <class HasherT>
+void DistinctHashesTestImpl() {
+  constexpr uint64_t num_keys = 1U << 16U;
+  std::unordered_set<uint64_t> hashes;
+  std::unordered_set<uint64_t> fingerprints;
+  for (uint64_t key = 0; key < num_keys; ++key) {
+    const uint64_t hash = HasherT::static_hash(key);
+    hashes.insert(hash);
+    fingerprints.insert(hash >> 56U);
+  }
+  EXPECT_EQ(hashes.size(), num_keys);
+  EXPECT_EQ(fingerprints.size(), 256);
+}
+
+template <template <typename, hashing::Finalizer> class HasherT>
+void DistinctStringHashesTestImpl() {
+  char* string = reinterpret_cast<char*>(std::calloc(HASHMAP_STRINGKEY_SIZE, sizeof(char)));
+  std::memset(string, 'a', HASHMAP_STRINGKEY_SIZE - 1);
+  const StringKey key(string);
+
+  std::unordered_set<uint64_t> hashes{HasherT<StringKey, false>::static_hash(key)};
+  for (uint64_t position = 0; position < HASHMAP_STRINGKEY_SIZE - 1; ++position) {
+    string[position] = 'b';
+    hashes.insert(HasherT<StringKey, false>::static_hash(key));
+    string[position] = 'a';
+  }
+  EXPECT_EQ(hashes.size(), HASHMAP_STRINGKEY_SIZE);
+  std::free(string);
+}
+
+TEST_F(HardwareHasherTest, TestDistinctHashes) {
+  DistinctHashesTestImpl<CRC32Hasher<uint64_t, false>>();
+  DistinctHashesTestImpl<AESHasher<uint64_t, false>>();
+  DistinctStringHashesTestImpl<CRC32Hasher>();
+  DistinctStringHashesTestImpl<AESHasher>();
+}
+
+TEST_F(TabulationHasherTest, TestBatchMatchesSingle) {
+  BatchMatchesSingleTestImpl<TabulationHasher<uint64_t, false>>();
+  BatchMatchesSingleTestImpl<TabulationHasher<uint64_t, false, true>>();
+}
+
+TEST_F(TabulationHasherTest, TestDistinctHashes) {
+  DistinctHashesTestImpl<TabulationHasher<uint64_t, false>>();
+  DistinctHashesTestImpl<TabulationHasher<uint64_t, false, true>>();
+}
+
+// Keys that only differ in their upper 32 bits still spread over the buckets like random keys (about 1 - 1/e of the buckets are used)
+template <class HasherT>
+void StructuredKeysTestImpl() {
+  constexpr uint64_t num_buckets = 4096;
+  HasherT hasher(num_buckets);
+  std::unordered_set<uint64_t> buckets;
+  for (uint64_t i = 0; i < num_buckets; ++i) {
+    buckets.insert(hasher.hash(i << 32U));
+  }
+  EXPECT_GT(buckets.size(), 2400);
+}
+
+TEST_F(TabulationHasherTest, TestStructuredKeys) {
+  StructuredKeysTestImpl<TabulationHasher<uint64_t, false>>();
+  StructuredKeysTestImpl<TabulationHasher<uint64_t, false, true>>();
+  EXPECT_EQ((TabulationHasher<uint64_t, false>(2).get_identifier()), "TabulationBitHasher");
+  EXPECT_EQ((TabulationHasher<uint64_t, true, true>(2).get_identifier()), "TwistedTabulationModHasher");
+}
+
+TEST_F(FinalizerTest, TestFastRangeUsesMSBs) {
+  const IdentityHasher<uint64_t, finalizer::FASTRANGE> hasher(1000);
+  EXPECT_EQ(hasher.hash(0), 0);
+  EXPECT_EQ(hasher.hash(1ULL << 63U), 500);
+  EXPECT_EQ(hasher.hash(~0ULL), 999);
+  EXPECT_EQ(hasher.hash(999), 0);
+
+  // For powers of two, fastrange is the shift of multiply-shift hashing
+  const MultShift64BHasher<uint64_t, finalizer::FASTRANGE> fastrange_hasher(1024);
+  const MultShift64BHasher<uint64_t, finalizer::MASK> shift_hasher(1024);
+  for (uint64_t key = 0; key < 4096; ++key) {
+    EXPECT_EQ(fastrange_hasher.hash(key), shift_hasher.hash(key));
+  }
+}
+
+// Modulo and fastrange map into all buckets of a range that is not a power of two
+template <class HasherT>
+void ArbitraryRangeTestImpl() {
+  constexpr uint64_t num_buckets = 1000;
+  static_assert(HasherT::supports_arbitrary_range);
+  HasherT hasher(num_buckets);
+  std::unordered_set<uint64_t> buckets;
+  std::unordered_set<uint64_t> bucket_hash_buckets;
+  for (uint64_t key = 0; key < 16 * num_buckets; ++key) {
+    const uint64_t bucket = hasher.hash(key);
+    EXPECT_LT(bucket, num_buckets);
+    buckets.insert(bucket);
+
+    // Bucketing tables go through bucket_hash, which has to spread the keys just as well
+    const uint64_t fingerprinted_bucket = hasher.template bucket_hash<uint8_t, FingerprintBucketBits::LSBLSB>(key).bucket;
+    EXPECT_LT(fingerprinted_bucket, num_buckets);
+    bucket_hash_buckets.insert(fingerprinted_bucket);
+  }
+  EXPECT_EQ(buckets.size(), num_buckets);
+  EXPECT_EQ(bucket_hash_buckets.size(), num_buckets);
+}
+
+TEST_F(FinalizerTest, TestArbitraryRange) {
+  ArbitraryRangeTestImpl<MurmurHasher<uint64_t, finalizer::FASTRANGE>>();
+  ArbitraryRangeTestImpl<MurmurHasher<uint64_t, finalizer::MODULO>>();
+  ArbitraryRangeTestImpl<MultShift64BHasher<uint64_t, finalizer::FASTRANGE>>();
+  ArbitraryRangeTestImpl<MultShift128BHasher<uint64_t, finalizer::FASTRANGE>>();
+  ArbitraryRangeTestImpl<TabulationHasher<uint64_t, finalizer::FASTRANGE, true>>();
+  static_assert(!StdHasher<uint64_t, false>::supports_arbitrary_range);
+
+  EXPECT_EQ((StdHasher<uint64_t, false>(2).get_identifier()), "StdBitHasher");
+  EXPECT_EQ((StdHasher<uint64_t, true>(2).get_identifier()), "StdModHasher");
+  EXPECT_EQ((MurmurHasher<uint64_t, finalizer::FASTRANGE>(2).get_identifier()), "MurmurFastRangeHasher");
+}
+
+}  // namespace hashmap